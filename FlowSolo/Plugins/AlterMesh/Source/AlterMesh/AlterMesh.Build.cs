@@ -72,6 +72,8 @@ public class AlterMesh : ModuleRules
 			);
 		
 		
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "MikkTSpace");
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -1,6 +1,8 @@
 // Copyright 2023 Aechmea
 
 #include "AlterMesh.h"
+#include "AlterMeshResultCache.h"
+#include "AlterMeshWorkerPool.h"
 
 IMPLEMENT_MODULE(FAlterMeshModule, AlterMesh)void FAlterMeshModule::StartupModule()
 {
@@ -16,5 +18,8 @@ IMPLEMENT_MODULE(FAlterMeshModule, AlterMesh)void FAlterMeshModule::StartupModul
 
 void FAlterMeshModule::ShutdownModule()
 {
+	FAlterMeshWorkerPool::Shutdown();
+	FAlterMeshResultCache::Shutdown();
+
 	IModuleInterface::ShutdownModule();
 }
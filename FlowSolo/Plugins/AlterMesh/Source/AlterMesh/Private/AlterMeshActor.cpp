@@ -377,18 +377,7 @@ void AAlterMeshActor::CreateComponents(const TSharedPtr<FAlterMeshPrimitive>& Me
 	
 	for (FAlterMeshSection& Section : Mesh->Sections)
 	{
-		bool bContainsMaterial = OverrideMaterials.ContainsByPredicate([&Section](const FAlterMeshMaterial& Other)
-		{
-			return Section.MaterialName == Other.SlotName;
-		});
-
-		if (!bContainsMaterial)
-		{
-			FAlterMeshMaterial Override;
-			Override.Material = Section.Material;
-			Override.SlotName = Section.MaterialName;
-			OverrideMaterials.Add(Override);
-		}
+		AddOverrideMaterial(Section);
 
 		TriangleCount += Section.Instances.Num() * (Section.Indices.Num() / 3);
 		NewComponent->Sections.Add(MoveTemp(Section));
@@ -400,6 +389,51 @@ void AAlterMeshActor::CreateComponents(const TSharedPtr<FAlterMeshPrimitive>& Me
 	NewComponent->RegisterComponent();
 }
 
+bool AAlterMeshActor::ReuseComponent(const TSharedPtr<FAlterMeshPrimitive>& Mesh, bool bInstance, TArray<UAlterMeshComponent*>& OldComponents)
+{
+	const int32 ComponentIndex = OldComponents.IndexOfByPredicate([&Mesh, bInstance](const UAlterMeshComponent* Component)
+	{
+		return Component->IsVisible() == !bInstance && Component->HasSameGeometry(*Mesh);
+	});
+
+	if (ComponentIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Geometry buffers are kept, only the instances that changed are uploaded
+	UAlterMeshComponent* Component = OldComponents[ComponentIndex];
+	OldComponents.RemoveAtSwap(ComponentIndex);
+
+	for (int32 SectionIndex = 0; SectionIndex < Mesh->Sections.Num(); SectionIndex++)
+	{
+		FAlterMeshSection& Section = Mesh->Sections[SectionIndex];
+		AddOverrideMaterial(Section);
+
+		TriangleCount += Section.Instances.Num() * (Section.Indices.Num() / 3);
+		Component->UpdateInstances(SectionIndex, MoveTemp(Section.Instances));
+	}
+
+	AlterMeshComponents.Add(Component);
+	return true;
+}
+
+void AAlterMeshActor::AddOverrideMaterial(const FAlterMeshSection& Section)
+{
+	bool bContainsMaterial = OverrideMaterials.ContainsByPredicate([&Section](const FAlterMeshMaterial& Other)
+	{
+		return Section.MaterialName == Other.SlotName;
+	});
+
+	if (!bContainsMaterial)
+	{
+		FAlterMeshMaterial Override;
+		Override.Material = Section.Material;
+		Override.SlotName = Section.MaterialName;
+		OverrideMaterials.Add(Override);
+	}
+}
+
 FOnRefreshDelegate* AAlterMeshActor::GetOnRefreshDelegate()
 {
 	if (!BlenderInstance || !BlenderInstance->IsValid())
@@ -419,12 +453,10 @@ void AAlterMeshActor::StartInstance()
 {
 	if (Asset)
 	{
-		const FString PluginDir = IPluginManager::Get().FindPlugin(TEXT("AlterMesh"))->GetBaseDir();
-		const FString ScriptPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(PluginDir, FString("\\Source\\ThirdParty\\__init__.py")));
 		const FString FilePath = UAlterMeshLibrary::ConvertFilenameToFull(Asset->Get()->Filename.FilePath);
 
 		BlenderInstance = NewObject<UAlterMeshInstance>(this);
-		BlenderInstance->Initialize(FilePath, ScriptPath);
+		BlenderInstance->InitializeShared(FilePath);
 	}
 }
 
@@ -482,14 +514,9 @@ void AAlterMeshActor::OnImport(TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes)
 {
 	const double ImportTimestamp = FPlatformTime::Seconds();
 
-	// Clear old components
-	TArray<UAlterMeshComponent*> Components;
-	GetComponents<UAlterMeshComponent>(Components);
-	for (UAlterMeshComponent* Component : Components)
-	{
-		Component->DestroyComponent();
-	}
-	
+	// Old components are kept aside, the ones with unchanged geometry are reused
+	TArray<UAlterMeshComponent*> OldComponents;
+	GetComponents<UAlterMeshComponent>(OldComponents);
 	AlterMeshComponents.Empty();
 	
 	TriangleCount = 0;
@@ -506,7 +533,16 @@ void AAlterMeshActor::OnImport(TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes)
 		}
 
 		// Create components even if its a instance, converters may need it
-		CreateComponents(Mesh, bHasUnrealEquivalentAsset);
+		if (!ReuseComponent(Mesh, bHasUnrealEquivalentAsset, OldComponents))
+		{
+			CreateComponents(Mesh, bHasUnrealEquivalentAsset);
+		}
+	}
+
+	// Clear old components
+	for (UAlterMeshComponent* Component : OldComponents)
+	{
+		Component->DestroyComponent();
 	}
 
 	RefreshMaterials();
@@ -534,47 +570,52 @@ void AAlterMeshActor::OnComponentMaterialChanged(const UAlterMeshComponent* Comp
 
 void AAlterMeshActor::PlaceInstances(UObject* InObject, const TArray<FMatrix44f>& InInstances)
 {
-	if (InObject)
+	UBlueprint* Blueprint = Cast<UBlueprint>(InObject);
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject);
+	
+	if (Blueprint && Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(AActor::StaticClass()))
 	{
 		for (const FMatrix44f& Instance : InInstances)
 		{
-			UBlueprint* Blueprint = Cast<UBlueprint>(InObject);
-			UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject);
-
 			FTransform InstanceTransform = FTransform(FMatrix(Instance));
 			
-			if (Blueprint && Blueprint->GeneratedClass && Blueprint->GeneratedClass->IsChildOf(AActor::StaticClass()))
+			UChildActorComponent* CAC = NewObject<UChildActorComponent>(this);
+			CAC->SetChildActorClass(Blueprint->GeneratedClass.Get());
+			CAC->AttachToComponent(RootSceneComponent, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, false));
+			CAC->RegisterComponent();
+			CAC->SetRelativeTransform(InstanceTransform);
+			AssetInstanceComponents.Add(CAC);
+		}
+	}
+	else if (StaticMesh && InInstances.Num())
+	{
+		UInstancedStaticMeshComponent* ISM = nullptr;
+		
+		for (UActorComponent* Component : AssetInstanceComponents)
+		{
+			if (Cast<UInstancedStaticMeshComponent>(Component) && Cast<UInstancedStaticMeshComponent>(Component)->GetStaticMesh() == InObject)
 			{
-				UChildActorComponent* CAC = NewObject<UChildActorComponent>(this);
-				CAC->SetChildActorClass(Blueprint->GeneratedClass.Get());
-				CAC->AttachToComponent(RootSceneComponent, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, false));
-				CAC->RegisterComponent();
-				CAC->SetRelativeTransform(InstanceTransform);
-				AssetInstanceComponents.Add(CAC);
+				 ISM = Cast<UInstancedStaticMeshComponent>(Component);		
 			}
-			else if (StaticMesh)
-			{
-				UInstancedStaticMeshComponent* ISM = nullptr;
-				
-				for (UActorComponent* Component : AssetInstanceComponents)
-				{
-					if (Cast<UInstancedStaticMeshComponent>(Component) && Cast<UInstancedStaticMeshComponent>(Component)->GetStaticMesh() == InObject)
-					{
-						 ISM = Cast<UInstancedStaticMeshComponent>(Component);		
-					}
-				}
+		}
 
-				if (!ISM)
-				{
-					ISM = NewObject<UInstancedStaticMeshComponent>(this);
-					ISM->AttachToComponent(RootSceneComponent, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, false));
-					ISM->RegisterComponent();
-					ISM->SetStaticMesh(StaticMesh);
-					AssetInstanceComponents.Add(ISM);
-				}
+		if (!ISM)
+		{
+			ISM = NewObject<UInstancedStaticMeshComponent>(this);
+			ISM->AttachToComponent(RootSceneComponent, FAttachmentTransformRules(EAttachmentRule::SnapToTarget, false));
+			ISM->RegisterComponent();
+			ISM->SetStaticMesh(StaticMesh);
+			AssetInstanceComponents.Add(ISM);
+		}
 
-				ISM->AddInstance(InstanceTransform);
-			}
+		// Single update of the instance buffer instead of one per instance
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.Reserve(InInstances.Num());
+		for (const FMatrix44f& Instance : InInstances)
+		{
+			InstanceTransforms.Emplace(FMatrix(Instance));
 		}
+
+		ISM->AddInstances(InstanceTransforms, false);
 	}
 }
@@ -3,6 +3,7 @@
 #include "AlterMeshExport.h"
 #include "AlterMeshAsset.h"
 #include "AlterMeshParam.h"
+#include "AlterMeshResultCache.h"
 #include "EngineUtils.h"
 #include "LandscapeDataAccess.h"
 #include "LandscapeRender.h"
@@ -10,6 +11,7 @@
 #include "AlterMesh/AlterMesh.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "Hash/xxhash.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -29,46 +31,27 @@ void FAlterMeshExport::PreExport()
 
 void FAlterMeshExport::Export()
 {
-	if (AlterMeshHandle.IsValid() && WriteLock(AlterMeshHandle->Get()))
+	if (!AlterMeshHandle.IsValid())
 	{
-		const double StartTime = FPlatformTime::Seconds();
+		return;
+	}
 
-		// Params
-		TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-		TSharedPtr<FJsonObject> JsonParams = MakeShareable(new FJsonObject);
-		TArray<TSharedPtr<FJsonValue>> ParamsArray;
+	const double StartTime = FPlatformTime::Seconds();
 
-		// Write out new values
-		for (const FAlterMeshParamBase* Param : Params.GetTyped<FAlterMeshParamBase>())
+	if (WriteLock(AlterMeshHandle->Get()))
+	{
+		if (bStaged)
 		{
-			Param->SerializeJson(ParamsArray);
-		}
-
-		TArray<TSharedPtr<FJsonValue>> AttributesArray;
-
-		for (const FAlterMeshAttributeMapping& Mapping : Asset->Get()->AttributeMapping)
-		{			
-			TSharedPtr<FJsonObject> ParamEntry = MakeShareable(new FJsonObject);
-			ParamEntry->SetStringField(FString("AttributeName"), Mapping.From.ToString());
-			AttributesArray.Add(MakeShared<FJsonValueObject>(ParamEntry));
+			int64 EntryStart = 0;
+			for (const int64 EntryEnd : StagedEntryEnds)
+			{
+				Write(AlterMeshHandle->Get(), reinterpret_cast<const char*>(StagedData.GetData() + EntryStart), EntryEnd - EntryStart);
+				EntryStart = EntryEnd;
+			}
 		}
-		
-		JsonObject->SetArrayField(TEXT("Params"), ParamsArray);
-		JsonObject->SetNumberField(TEXT("Frame"), Params.Frame);
-		JsonObject->SetStringField(TEXT("Object"), Asset->Get()->ObjectName);
-		JsonObject->SetArrayField(TEXT("Attributes"), AttributesArray);
-		TSharedRef<FJsonValueArray> ParamsArrayValue = MakeShared<FJsonValueArray>(ParamsArray);
-
-		FString JsonString;
-		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
-		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
-
-		Write(AlterMeshHandle->Get(), TCHAR_TO_ANSI(*JsonString), JsonString.Len());
-
-		// Export non json data
-		for (const FAlterMeshParamBase* Param : Params.GetTyped<FAlterMeshParamBase>())
+		else
 		{
-			Param->Export(*this);
+			WriteParams(EWriteTarget::SharedMemory);
 		}
 
 		WriteUnlock(AlterMeshHandle->Get());
@@ -81,6 +64,98 @@ void FAlterMeshExport::Export()
 	}
 }
 
+uint64 FAlterMeshExport::Serialize()
+{
+	// Params are hashed exactly as Blender receives them, the rest only changes how the output is imported
+	FXxHash64Builder Builder;
+	Hasher = &Builder;
+	WriteParams(EWriteTarget::Hash);
+	Hasher = nullptr;
+
+	const UAlterMeshAsset* AlterMeshAsset = Asset->Get();
+	const uint64 AssetKey = FAlterMeshResultCache::GetAssetKey(AlterMeshAsset);
+	Builder.Update(&AssetKey, sizeof(AssetKey));
+
+	return Builder.Finalize().Hash;
+}
+
+void FAlterMeshExport::Stage()
+{
+	StagedData.Reset();
+	StagedEntryEnds.Reset();
+
+	WriteParams(EWriteTarget::Stage);
+	bStaged = true;
+}
+
+void FAlterMeshExport::WriteParams(EWriteTarget Target)
+{
+	WriteTarget = Target;
+
+	// Params
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	TArray<TSharedPtr<FJsonValue>> ParamsArray;
+
+	// Write out new values
+	for (const FAlterMeshParamBase* Param : Params.GetTyped<FAlterMeshParamBase>())
+	{
+		Param->SerializeJson(ParamsArray);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> AttributesArray;
+
+	for (const FAlterMeshAttributeMapping& Mapping : Asset->Get()->AttributeMapping)
+	{			
+		TSharedPtr<FJsonObject> ParamEntry = MakeShareable(new FJsonObject);
+		ParamEntry->SetStringField(FString("AttributeName"), Mapping.From.ToString());
+		AttributesArray.Add(MakeShared<FJsonValueObject>(ParamEntry));
+	}
+	
+	JsonObject->SetArrayField(TEXT("Params"), ParamsArray);
+	JsonObject->SetNumberField(TEXT("Frame"), Params.Frame);
+	JsonObject->SetStringField(TEXT("Object"), Asset->Get()->ObjectName);
+	JsonObject->SetArrayField(TEXT("Attributes"), AttributesArray);
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
+
+	WriteEntry(TCHAR_TO_ANSI(*JsonString), JsonString.Len());
+
+	// Export non json data
+	for (const FAlterMeshParamBase* Param : Params.GetTyped<FAlterMeshParamBase>())
+	{
+		Param->Export(*this);
+	}
+
+	WriteTarget = EWriteTarget::None;
+}
+
+void FAlterMeshExport::WriteEntry(const void* Data, int64 Size)
+{
+	switch (WriteTarget)
+	{
+	case EWriteTarget::Hash:
+		// Entry sizes are part of the key, the same bytes split differently are different params
+		Hasher->Update(Data, Size);
+		Hasher->Update(&Size, sizeof(Size));
+		break;
+
+	case EWriteTarget::Stage:
+		StagedData.Append(static_cast<const uint8*>(Data), Size);
+		StagedEntryEnds.Add(StagedData.Num());
+		break;
+
+	case EWriteTarget::SharedMemory:
+		Write(AlterMeshHandle->Get(), static_cast<const char*>(Data), Size);
+		break;
+
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
 void FAlterMeshExport::InvertUVs(TArray<FVector2f>& OutUVs)
 {
 	for (FVector2f& UV : OutUVs)
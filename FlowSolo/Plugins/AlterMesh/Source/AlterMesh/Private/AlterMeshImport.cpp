@@ -19,7 +19,7 @@
 #include "MeshUtilities.h"
 #endif
 
-using TUniqueVert = TTuple<FVector3f, FVector3f, FLinearColor, FVector2f, FVector2f, FVector2f, FVector2f>;
+#include "mikktspace.h"
 
 DEFINE_LOG_CATEGORY(LogAlterMeshImport)
 
@@ -32,7 +32,7 @@ void FAlterMeshImport::ImportMeshes(TArray<TSharedPtr<FAlterMeshPrimitive>>& Out
 		int32 NumMeshes = ReadValue<int32>();
 		int32 NumInstances = ReadValue<int32>();
 
-		if (NumMeshes < 1)
+		if (NumMeshes < 1 || IsCancelled())
 		{
 			ReadUnlock(AlterMeshHandle->Get());
 			return;
@@ -42,6 +42,11 @@ void FAlterMeshImport::ImportMeshes(TArray<TSharedPtr<FAlterMeshPrimitive>>& Out
 		TArray<TFuture<TSharedPtr<FAlterMeshPrimitive>>> FutureMeshes;
 		for (int32 MeshIndex = 0; MeshIndex < NumMeshes; MeshIndex++)
 		{
+			if (IsCancelled())
+			{
+				break;
+			}
+
 	 		TArrayView<FVector3f> Vertices = ReadArray<FVector3f>();
 			TArrayView<FVector3f> Normals = ReadArray<FVector3f>();
 			TArrayView<int32> Loops = ReadArray<int32>();
@@ -52,9 +57,12 @@ void FAlterMeshImport::ImportMeshes(TArray<TSharedPtr<FAlterMeshPrimitive>>& Out
 			int64 Hash = ReadValue<int64>();
 	 		TArrayView<int32> BlenderVersion = ReadArray<int32>();
 
-			MajorVersion = BlenderVersion[0];
-			MinorVersion = BlenderVersion[1];
-			PatchVersion = BlenderVersion[2];
+			if (BlenderVersion.Num() >= 3)
+			{
+				MajorVersion = BlenderVersion[0];
+				MinorVersion = BlenderVersion[1];
+				PatchVersion = BlenderVersion[2];
+			}
 			
 			TArray<TArrayView<FVector4f>> Attributes;
 			for (const FAlterMeshAttributeMapping& AttributeMapping : Asset->Get()->AttributeMapping)
@@ -84,86 +92,171 @@ void FAlterMeshImport::ImportMeshes(TArray<TSharedPtr<FAlterMeshPrimitive>>& Out
 			}
 		}
 
+		// Processing reads from the shared memory, wait for it before unlocking
 		for (const auto& FutureMesh : FutureMeshes)
 		{
 			OutMeshes.Add(FutureMesh.Get());
 		}
 
+		if (IsCancelled())
+		{
+			OutMeshes.Reset();
+			ReadUnlock(AlterMeshHandle->Get());
+			return;
+		}
+
 		// Import Instances
-		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++)
+		ImportInstances(NumInstances, OutMeshes);
+
+		SetupMaterials(OutMeshes);
+
+		if (CVarAlterMeshDebugProcessOutput.GetValueOnAnyThread())
 		{
-			uint64 PathId = ReadValue<uint64>();
-			FName AssetPath = *reinterpret_cast<FName*>(&PathId);
+			UE_LOG( LogAlterMeshImport, Log, TEXT( "Imported in %.4f sec(s)" ), FPlatformTime::Seconds() - StartTime);
+		}
 
-			AssetPath = FName(AssetPath.GetComparisonIndex(), AssetPath.GetComparisonIndex(), AssetPath.GetNumber());
-			
-			FMatrix44f LocalMatrix = ReadValue<FMatrix44f>();
-			FMatrix44f WorldMatrix = ReadValue<FMatrix44f>();
+		ReadUnlock(AlterMeshHandle->Get());
+	}
 
-			FMatrix44f InstanceMatrix;
+}
+
+void FAlterMeshImport::ImportInstances(int32 NumInstances, TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes)
+{
+	struct FInstanceRecord
+	{
+		FName AssetPath;
+		FMatrix44f Matrix;
+		int64 Hash;
+	};
+
+	// Reading has to stay sequential, shared memory entries are consumed in order
+	const bool bLocalSpace = Asset->Get()->CoordinateSpace == EAlterMeshCoordinateSpace::Local;
+	TArray<FInstanceRecord> Records;
+	Records.SetNumUninitialized(NumInstances);
+	for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++)
+	{
+		FInstanceRecord& Record = Records[InstanceIndex];
 
-			// Don't use matrix directly, needs to convert to UE
-			// Decompose to create new matrix
-			FTransform3f Transform(Asset->Get()->CoordinateSpace == EAlterMeshCoordinateSpace::Local ? LocalMatrix.GetTransposed() : WorldMatrix.GetTransposed());
+		uint64 PathId = ReadValue<uint64>();
+		FName AssetPath = *reinterpret_cast<FName*>(&PathId);
+		Record.AssetPath = FName(AssetPath.GetComparisonIndex(), AssetPath.GetComparisonIndex(), AssetPath.GetNumber());
 
-			FVector3f Location = ToUEMatrix.TransformVector(Transform.GetLocation());
-			Transform.SetLocation(Location);
+		const FMatrix44f LocalMatrix = ReadValue<FMatrix44f>();
+		const FMatrix44f WorldMatrix = ReadValue<FMatrix44f>();
+		Record.Matrix = bLocalSpace ? LocalMatrix : WorldMatrix;
+		Record.Hash = ReadValue<int64>();
+	}
 
-			FQuat4f Rotation = Transform.GetRotation();
-			Rotation = FQuat4f(Rotation.Y, Rotation.X, -Rotation.Z, Rotation.W);
-			Transform.SetRotation(Rotation);
+	// Index built once, instead of scanning all meshes for every instance
+	TMap<int64, TArray<int32, TInlineAllocator<1>>> MeshesByHash;
+	MeshesByHash.Reserve(Meshes.Num());
+	for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); MeshIndex++)
+	{
+		MeshesByHash.FindOrAdd(Meshes[MeshIndex]->Hash).Add(MeshIndex);
+	}
 
-			FVector3f Scale = Transform.GetScale3D();
-			Scale = FVector3f(Scale.Y, Scale.X, Scale.Z);
-			Transform.SetScale3D(Scale);
+	TArray<const TArray<int32, TInlineAllocator<1>>*> InstanceMeshes;
+	InstanceMeshes.SetNumUninitialized(NumInstances);
 
-			InstanceMatrix = Transform.ToMatrixWithScale();
+	ParallelFor(NumInstances, [&](const int32 InstanceIndex)
+	{
+		FInstanceRecord& Record = Records[InstanceIndex];
 
-			int64 Hash = ReadValue<int64>();
+		// Don't use matrix directly, needs to convert to UE
+		// Decompose to create new matrix
+		FTransform3f Transform(Record.Matrix.GetTransposed());
 
-			for (TSharedPtr<FAlterMeshPrimitive>& Mesh : OutMeshes)
+		FVector3f Location = ToUEMatrix.TransformVector(Transform.GetLocation());
+		Transform.SetLocation(Location);
+
+		FQuat4f Rotation = Transform.GetRotation();
+		Rotation = FQuat4f(Rotation.Y, Rotation.X, -Rotation.Z, Rotation.W);
+		Transform.SetRotation(Rotation);
+
+		FVector3f Scale = Transform.GetScale3D();
+		Scale = FVector3f(Scale.Y, Scale.X, Scale.Z);
+		Transform.SetScale3D(Scale);
+
+		Record.Matrix = Transform.ToMatrixWithScale();
+		InstanceMeshes[InstanceIndex] = MeshesByHash.Find(Record.Hash);
+	});
+
+	// Group transforms per mesh into contiguous arrays, keeping the order in which Blender sent them
+	TArray<int32> NumMeshInstances;
+	NumMeshInstances.AddZeroed(Meshes.Num());
+	for (const TArray<int32, TInlineAllocator<1>>* MeshIndices : InstanceMeshes)
+	{
+		if (MeshIndices)
+		{
+			for (const int32 MeshIndex : *MeshIndices)
 			{
-				if (Mesh->Hash == Hash)
-				{
-					if (AssetPath != NAME_None)
-					{
-						Mesh->AssetPath = AssetPath;
-						Mesh->bIsInstance = true;
-					}
-					
-					for (FAlterMeshSection& Section : Mesh->Sections)
-					{
-						Section.Instances.Add(InstanceMatrix);
-					}
-				}
+				NumMeshInstances[MeshIndex]++;
 			}
 		}
+	}
 
-		// Setup materials
-		for (TSharedPtr<FAlterMeshPrimitive>& Mesh : OutMeshes)
+	TArray<TArray<FMatrix44f>> MeshInstances;
+	MeshInstances.SetNum(Meshes.Num());
+	for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); MeshIndex++)
+	{
+		MeshInstances[MeshIndex].Reserve(NumMeshInstances[MeshIndex]);
+	}
+
+	for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++)
+	{
+		const TArray<int32, TInlineAllocator<1>>* MeshIndices = InstanceMeshes[InstanceIndex];
+		if (!MeshIndices)
 		{
-			for (FAlterMeshSection& Section : Mesh->Sections)
+			continue;
+		}
+
+		const FInstanceRecord& Record = Records[InstanceIndex];
+		for (const int32 MeshIndex : *MeshIndices)
+		{
+			if (Record.AssetPath != NAME_None)
 			{
-				UMaterialInterface* const* ParamMaterial = Asset->Get()->Materials.Find(Section.MaterialName);
-				if (ParamMaterial && *ParamMaterial)
-				{
-					Section.Material = *ParamMaterial;
-				}
-				else
-				{
-					Section.Material = UMaterial::GetDefaultMaterial(MD_Surface);
-				}
+				Meshes[MeshIndex]->AssetPath = Record.AssetPath;
+				Meshes[MeshIndex]->bIsInstance = true;
 			}
+
+			MeshInstances[MeshIndex].Add(Record.Matrix);
 		}
+	}
 
-		if (CVarAlterMeshDebugProcessOutput.GetValueOnAnyThread())
+	ParallelFor(Meshes.Num(), [&](const int32 MeshIndex)
+	{
+		TArray<FAlterMeshSection>& Sections = Meshes[MeshIndex]->Sections;
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
 		{
-			UE_LOG( LogAlterMeshImport, Log, TEXT( "Imported in %.4f sec(s)" ), FPlatformTime::Seconds() - StartTime);
+			if (SectionIndex == Sections.Num() - 1)
+			{
+				Sections[SectionIndex].Instances.Append(MoveTemp(MeshInstances[MeshIndex]));
+			}
+			else
+			{
+				Sections[SectionIndex].Instances.Append(MeshInstances[MeshIndex]);
+			}
 		}
+	});
+}
 
-		ReadUnlock(AlterMeshHandle->Get());
+void FAlterMeshImport::SetupMaterials(TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes) const
+{
+	for (TSharedPtr<FAlterMeshPrimitive>& Mesh : Meshes)
+	{
+		for (FAlterMeshSection& Section : Mesh->Sections)
+		{
+			UMaterialInterface* const* ParamMaterial = Asset->Get()->Materials.Find(Section.MaterialName);
+			if (ParamMaterial && *ParamMaterial)
+			{
+				Section.Material = *ParamMaterial;
+			}
+			else
+			{
+				Section.Material = UMaterial::GetDefaultMaterial(MD_Surface);
+			}
+		}
 	}
-
 }
 
 void FAlterMeshImport::ImportParams(TArray<FString>& OutObjects, TArray<FString>& OutObjectParams)
@@ -180,15 +273,182 @@ void FAlterMeshImport::ImportParams(TArray<FString>& OutObjects, TArray<FString>
 	}
 }
 
+void FAlterMeshImport::WeldVertices(TConstArrayView<FAlterMeshUniqueVert> Verts, TConstArrayView<uint32> Hashes, TArray<int32>& OutVertexIndices, TArray<int32>& OutUniqueLoops, bool bParallel)
+{
+	const int32 NumLoops = Verts.Num();
+	OutVertexIndices.SetNumUninitialized(NumLoops);
+	OutUniqueLoops.Reset();
+
+	// Not worth the overhead of scheduling, result is the same either way
+	constexpr int32 ChunkSize = 16384;
+	if (!bParallel || NumLoops <= ChunkSize)
+	{
+		TMap<FAlterMeshUniqueVert, int32> UniqueVertices;
+		UniqueVertices.Reserve(NumLoops);
+
+		for (int32 LoopIndex = 0; LoopIndex < NumLoops; LoopIndex++)
+		{
+			if (const int32* SplitVertLoopIndex = UniqueVertices.FindByHash(Hashes[LoopIndex], Verts[LoopIndex]))
+			{
+				OutVertexIndices[LoopIndex] = OutVertexIndices[*SplitVertLoopIndex];
+			}
+			else
+			{
+				OutVertexIndices[LoopIndex] = OutUniqueLoops.Add(LoopIndex);
+				UniqueVertices.AddByHash(Hashes[LoopIndex], Verts[LoopIndex], LoopIndex);
+			}
+		}
+
+		return;
+	}
+
+	// Identical verts have identical hashes, so each shard can be welded independently
+	// Loops are visited in ascending order inside a shard, which makes the first occurrence win like the serial path
+	const int32 NumShards = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 4, 1, 256);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumLoops, ChunkSize);
+
+	auto GetShard = [&Hashes, NumShards](const int32 LoopIndex)
+	{
+		// Scrambled so shards don't share the low bits used by the map buckets
+		return static_cast<int32>(((Hashes[LoopIndex] * 0x9E3779B97F4A7C15ull) >> 32) % NumShards);
+	};
+
+	// Counting sort of loops by shard, stable because chunks and loops inside them are ordered
+	TArray<int32> ChunkShardOffsets;
+	ChunkShardOffsets.AddZeroed(NumChunks * NumShards);
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+	{
+		int32* Counts = &ChunkShardOffsets[ChunkIndex * NumShards];
+		const int32 End = FMath::Min(NumLoops, (ChunkIndex + 1) * ChunkSize);
+		for (int32 LoopIndex = ChunkIndex * ChunkSize; LoopIndex < End; LoopIndex++)
+		{
+			Counts[GetShard(LoopIndex)]++;
+		}
+	});
+
+	TArray<int32> ShardStarts;
+	ShardStarts.SetNumUninitialized(NumShards + 1);
+
+	int32 Offset = 0;
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+	{
+		ShardStarts[ShardIndex] = Offset;
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+		{
+			const int32 Count = ChunkShardOffsets[ChunkIndex * NumShards + ShardIndex];
+			ChunkShardOffsets[ChunkIndex * NumShards + ShardIndex] = Offset;
+			Offset += Count;
+		}
+	}
+	ShardStarts[NumShards] = Offset;
+
+	TArray<int32> SortedLoops;
+	SortedLoops.SetNumUninitialized(NumLoops);
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+	{
+		int32* Offsets = &ChunkShardOffsets[ChunkIndex * NumShards];
+		const int32 End = FMath::Min(NumLoops, (ChunkIndex + 1) * ChunkSize);
+		for (int32 LoopIndex = ChunkIndex * ChunkSize; LoopIndex < End; LoopIndex++)
+		{
+			SortedLoops[Offsets[GetShard(LoopIndex)]++] = LoopIndex;
+		}
+	});
+
+	// First identical loop of each loop
+	TArray<int32> FirstLoops;
+	FirstLoops.SetNumUninitialized(NumLoops);
+
+	ParallelFor(NumShards, [&](const int32 ShardIndex)
+	{
+		TMap<FAlterMeshUniqueVert, int32> UniqueVertices;
+		UniqueVertices.Reserve(ShardStarts[ShardIndex + 1] - ShardStarts[ShardIndex]);
+
+		for (int32 SortedIndex = ShardStarts[ShardIndex]; SortedIndex < ShardStarts[ShardIndex + 1]; SortedIndex++)
+		{
+			const int32 LoopIndex = SortedLoops[SortedIndex];
+			if (const int32* FirstLoop = UniqueVertices.FindByHash(Hashes[LoopIndex], Verts[LoopIndex]))
+			{
+				FirstLoops[LoopIndex] = *FirstLoop;
+			}
+			else
+			{
+				FirstLoops[LoopIndex] = LoopIndex;
+				UniqueVertices.AddByHash(Hashes[LoopIndex], Verts[LoopIndex], LoopIndex);
+			}
+		}
+	});
+
+	// Vertex indices are assigned in loop order, same as the serial path
+	TArray<int32> ChunkVertexStarts;
+	ChunkVertexStarts.AddZeroed(NumChunks + 1);
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+	{
+		const int32 End = FMath::Min(NumLoops, (ChunkIndex + 1) * ChunkSize);
+		for (int32 LoopIndex = ChunkIndex * ChunkSize; LoopIndex < End; LoopIndex++)
+		{
+			ChunkVertexStarts[ChunkIndex + 1] += FirstLoops[LoopIndex] == LoopIndex;
+		}
+	});
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		ChunkVertexStarts[ChunkIndex + 1] += ChunkVertexStarts[ChunkIndex];
+	}
+
+	OutUniqueLoops.SetNumUninitialized(ChunkVertexStarts[NumChunks]);
+
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+	{
+		int32 VertIndex = ChunkVertexStarts[ChunkIndex];
+		const int32 End = FMath::Min(NumLoops, (ChunkIndex + 1) * ChunkSize);
+		for (int32 LoopIndex = ChunkIndex * ChunkSize; LoopIndex < End; LoopIndex++)
+		{
+			if (FirstLoops[LoopIndex] == LoopIndex)
+			{
+				OutUniqueLoops[VertIndex] = LoopIndex;
+				OutVertexIndices[LoopIndex] = VertIndex++;
+			}
+		}
+	});
+
+	ParallelFor(NumLoops, [&](const int32 LoopIndex)
+	{
+		if (FirstLoops[LoopIndex] != LoopIndex)
+		{
+			OutVertexIndices[LoopIndex] = OutVertexIndices[FirstLoops[LoopIndex]];
+		}
+	});
+}
+
 void FAlterMeshImport::CalculateTangents(FAlterMeshSection& Section)
 {
-	// todo is this even correct
-	// Low quality tangents
-	Section.Tangents.AddZeroed(Section.Vertices.Num());
-	Section.Bitangents.AddZeroed(Section.Vertices.Num());
+	const int32 NumVertices = Section.Vertices.Num();
+	const int32 NumTriangles = Section.Indices.Num() / 3;
+
+	Section.Tangents.SetNumZeroed(NumVertices);
+	Section.Bitangents.SetNumZeroed(NumVertices);
+
+	if (bHighQualityTangents)
+	{
+		CalculateMikkTSpaceTangents(Section);
+		return;
+	}
 
-	ParallelFor( Section.Indices.Num() / 3, [&Section] (int32 i)
+	// Per triangle basis, weighted by the corner angles when gathered
+	TArray<FVector3f> FaceTangents;
+	FaceTangents.SetNumUninitialized(NumTriangles);
+	TArray<FVector3f> FaceBitangents;
+	FaceBitangents.SetNumUninitialized(NumTriangles);
+	TArray<float> CornerAngles;
+	CornerAngles.SetNumUninitialized(NumTriangles * 3);
+
+	ParallelFor(NumTriangles, [&Section, &FaceTangents, &FaceBitangents, &CornerAngles](const int32 TriangleIndex)
 	{
+		const int32 i = TriangleIndex * 3;
+
 		const FVector3f V0 = Section.Vertices[Section.Indices[i+0]];
 		const FVector3f V1 = Section.Vertices[Section.Indices[i+1]];
 		const FVector3f V2 = Section.Vertices[Section.Indices[i+2]];
@@ -210,19 +470,156 @@ void FAlterMeshImport::CalculateTangents(FAlterMeshSection& Section)
 		{
 			r = 1.0f / Denominator ;
 		}
-		
-		const FVector3f Tangent = (DeltaPos1 * DeltaUV2.Y - DeltaPos2 * DeltaUV1.Y)*r;
-		const FVector3f Bitangent = (DeltaPos2 * DeltaUV1.X - DeltaPos1 * DeltaUV2.X)*r;
-
-		Section.Tangents[Section.Indices[i]] = Tangent;
-		Section.Bitangents[Section.Indices[i]] = Bitangent;
-		Section.Tangents[Section.Indices[i+1]] = Tangent;
-		Section.Bitangents[Section.Indices[i+1]] = Bitangent;
-		Section.Tangents[Section.Indices[i+2]] = Tangent;
-		Section.Bitangents[Section.Indices[i+2]] = Bitangent;
+
+		// Normalized so large UV islands don't outweigh small ones
+		FaceTangents[TriangleIndex] = ((DeltaPos1 * DeltaUV2.Y - DeltaPos2 * DeltaUV1.Y) * r).GetSafeNormal();
+		FaceBitangents[TriangleIndex] = ((DeltaPos2 * DeltaUV1.X - DeltaPos1 * DeltaUV2.X) * r).GetSafeNormal();
+
+		auto GetAngle = [](const FVector3f& A, const FVector3f& B)
+		{
+			return FMath::Acos(FMath::Clamp(A.GetSafeNormal() | B.GetSafeNormal(), -1.f, 1.f));
+		};
+
+		CornerAngles[i+0] = GetAngle(V1 - V0, V2 - V0);
+		CornerAngles[i+1] = GetAngle(V2 - V1, V0 - V1);
+		CornerAngles[i+2] = GetAngle(V0 - V2, V1 - V2);
 	});
 
-	return;
+	// Corners of each vertex, ordered by index so the sums don't depend on scheduling
+	TArray<int32> VertexCornerStarts;
+	VertexCornerStarts.AddZeroed(NumVertices + 1);
+	for (int32 Corner = 0; Corner < NumTriangles * 3; Corner++)
+	{
+		VertexCornerStarts[Section.Indices[Corner] + 1]++;
+	}
+
+	for (int32 VertIndex = 0; VertIndex < NumVertices; VertIndex++)
+	{
+		VertexCornerStarts[VertIndex + 1] += VertexCornerStarts[VertIndex];
+	}
+
+	TArray<int32> VertexCorners;
+	VertexCorners.SetNumUninitialized(NumTriangles * 3);
+	{
+		TArray<int32> Offsets(VertexCornerStarts.GetData(), NumVertices);
+		for (int32 Corner = 0; Corner < NumTriangles * 3; Corner++)
+		{
+			VertexCorners[Offsets[Section.Indices[Corner]]++] = Corner;
+		}
+	}
+
+	const bool bHasNormals = Section.Normals.Num() == NumVertices;
+
+	ParallelFor(NumVertices, [&](const int32 VertIndex)
+	{
+		FVector3f Tangent = FVector3f::ZeroVector;
+		FVector3f Bitangent = FVector3f::ZeroVector;
+
+		for (int32 CornerIndex = VertexCornerStarts[VertIndex]; CornerIndex < VertexCornerStarts[VertIndex + 1]; CornerIndex++)
+		{
+			const int32 Corner = VertexCorners[CornerIndex];
+			Tangent += FaceTangents[Corner / 3] * CornerAngles[Corner];
+			Bitangent += FaceBitangents[Corner / 3] * CornerAngles[Corner];
+		}
+
+		if (!bHasNormals)
+		{
+			Section.Tangents[VertIndex] = Tangent.GetSafeNormal();
+			Section.Bitangents[VertIndex] = Bitangent.GetSafeNormal();
+			return;
+		}
+
+		// Orthogonalize against the normal, keep handedness of the accumulated bitangent
+		const FVector3f Normal = Section.Normals[VertIndex];
+		Tangent = (Tangent - Normal * (Normal | Tangent)).GetSafeNormal();
+		if (Tangent.IsZero())
+		{
+			FVector3f Unused;
+			Normal.FindBestAxisVectors(Tangent, Unused);
+		}
+
+		const FVector3f Cross = Normal ^ Tangent;
+		Section.Tangents[VertIndex] = Tangent;
+		Section.Bitangents[VertIndex] = (Cross | Bitangent) < 0.f ? -Cross : Cross;
+	});
+}
+
+namespace AlterMeshMikkTSpace
+{
+	static FAlterMeshSection& GetSection(const SMikkTSpaceContext* Context)
+	{
+		return *static_cast<FAlterMeshSection*>(Context->m_pUserData);
+	}
+
+	static int GetNumFaces(const SMikkTSpaceContext* Context)
+	{
+		return GetSection(Context).Indices.Num() / 3;
+	}
+
+	static int GetNumVerticesOfFace(const SMikkTSpaceContext* Context, const int FaceIdx)
+	{
+		return 3;
+	}
+
+	static void GetPosition(const SMikkTSpaceContext* Context, float Position[3], const int FaceIdx, const int VertIdx)
+	{
+		const FAlterMeshSection& Section = GetSection(Context);
+		const FVector3f& Vertex = Section.Vertices[Section.Indices[FaceIdx * 3 + VertIdx]];
+		Position[0] = Vertex.X;
+		Position[1] = Vertex.Y;
+		Position[2] = Vertex.Z;
+	}
+
+	static void GetNormal(const SMikkTSpaceContext* Context, float Normal[3], const int FaceIdx, const int VertIdx)
+	{
+		const FAlterMeshSection& Section = GetSection(Context);
+		const FVector3f& VertexNormal = Section.Normals[Section.Indices[FaceIdx * 3 + VertIdx]];
+		Normal[0] = VertexNormal.X;
+		Normal[1] = VertexNormal.Y;
+		Normal[2] = VertexNormal.Z;
+	}
+
+	static void GetTexCoord(const SMikkTSpaceContext* Context, float UV[2], const int FaceIdx, const int VertIdx)
+	{
+		const FAlterMeshSection& Section = GetSection(Context);
+		const FVector2f& VertexUV = Section.UV0[Section.Indices[FaceIdx * 3 + VertIdx]];
+		UV[0] = VertexUV.X;
+		UV[1] = VertexUV.Y;
+	}
+
+	static void SetTSpaceBasic(const SMikkTSpaceContext* Context, const float Tangent[3], const float BitangentSign, const int FaceIdx, const int VertIdx)
+	{
+		FAlterMeshSection& Section = GetSection(Context);
+		const int32 VertIndex = Section.Indices[FaceIdx * 3 + VertIdx];
+		const FVector3f VertexTangent(Tangent[0], Tangent[1], Tangent[2]);
+
+		Section.Tangents[VertIndex] = VertexTangent;
+		Section.Bitangents[VertIndex] = (Section.Normals[VertIndex] ^ VertexTangent) * BitangentSign;
+	}
+}
+
+void FAlterMeshImport::CalculateMikkTSpaceTangents(FAlterMeshSection& Section)
+{
+	if (Section.Normals.Num() != Section.Vertices.Num())
+	{
+		return;
+	}
+
+	SMikkTSpaceInterface Interface;
+	Interface.m_getNumFaces = AlterMeshMikkTSpace::GetNumFaces;
+	Interface.m_getNumVerticesOfFace = AlterMeshMikkTSpace::GetNumVerticesOfFace;
+	Interface.m_getPosition = AlterMeshMikkTSpace::GetPosition;
+	Interface.m_getNormal = AlterMeshMikkTSpace::GetNormal;
+	Interface.m_getTexCoord = AlterMeshMikkTSpace::GetTexCoord;
+	Interface.m_setTSpaceBasic = AlterMeshMikkTSpace::SetTSpaceBasic;
+	Interface.m_setTSpace = nullptr;
+
+	SMikkTSpaceContext Context;
+	Context.m_pInterface = &Interface;
+	Context.m_pUserData = &Section;
+	Context.m_bIgnoreDegenerates = false;
+
+	genTangSpaceDefault(&Context);
 }
 
 TSharedPtr<FAlterMeshPrimitive> FAlterMeshImport::ProcessMesh(TArrayView<FVector3f> Vertices, TArrayView<FVector3f> Normals,
@@ -250,22 +647,13 @@ TSharedPtr<FAlterMeshPrimitive> FAlterMeshImport::ProcessMesh(TArrayView<FVector
 	});
 	
 	TArray<FVector3f> SplitVertices;
-	SplitVertices.Reserve(Vertices.Num());
 	TArray<FVector3f> SplitNormals;
-	SplitNormals.Reserve(Vertices.Num());
 	TArray<FVector2f> SplitUV0;
-	SplitUV0.Reserve(Vertices.Num());
 	TArray<FVector2f> SplitUV1;
-	SplitUV1.Reserve(Vertices.Num());
 	TArray<FVector2f> SplitUV2;
-	SplitUV2.Reserve(Vertices.Num());
 	TArray<FVector2f> SplitUV3;
-	SplitUV3.Reserve(Vertices.Num());
 	TArray<FColor> SplitColors;
-	SplitColors.Reserve(Vertices.Num());
 
-	TMultiMap<TUniqueVert, int32> UniqueVertices;
-	UniqueVertices.Reserve(Vertices.Num());
 	TArray<uint32> HashValues;
 	HashValues.AddUninitialized(Loops.Num());
 
@@ -304,7 +692,7 @@ TSharedPtr<FAlterMeshPrimitive> FAlterMeshImport::ProcessMesh(TArrayView<FVector
 			}
 		});
 	
-		TArray<TUniqueVert> HashedItems;
+		TArray<FAlterMeshUniqueVert> HashedItems;
 		HashedItems.AddUninitialized(Loops.Num());		
 		
 		bool bCornerIndexedNormals = MajorVersion >= 4 && MinorVersion >= 1;
@@ -312,7 +700,7 @@ TSharedPtr<FAlterMeshPrimitive> FAlterMeshImport::ProcessMesh(TArrayView<FVector
 		// Compute the hash values
 		ParallelFor(Loops.Num(), [&](const int32 i)
 		{
-			const TUniqueVert Vert = TUniqueVert(
+			const FAlterMeshUniqueVert Vert = FAlterMeshUniqueVert(
 			Vertices[Loops[i]],
 			Normals[bCornerIndexedNormals ? TriangleCorners[i] : i],
 			Colors[i],
@@ -326,28 +714,36 @@ TSharedPtr<FAlterMeshPrimitive> FAlterMeshImport::ProcessMesh(TArrayView<FVector
 		});
 
 		// Split verts
+		TArray<int32> VertexIndices;
+		TArray<int32> UniqueLoops;
+		WeldVertices(HashedItems, HashValues, VertexIndices, UniqueLoops);
+
+		const int32 NumSplitVertices = UniqueLoops.Num();
+		SplitVertices.SetNumUninitialized(NumSplitVertices);
+		SplitNormals.SetNumUninitialized(NumSplitVertices);
+		SplitColors.SetNumUninitialized(NumSplitVertices);
+		SplitUV0.SetNumUninitialized(NumSplitVertices);
+		SplitUV1.SetNumUninitialized(NumSplitVertices);
+		SplitUV2.SetNumUninitialized(NumSplitVertices);
+		SplitUV3.SetNumUninitialized(NumSplitVertices);
+
+		ParallelFor(NumSplitVertices, [&](const int32 VertIndex)
+		{
+			const int32 LoopIndex = UniqueLoops[VertIndex];
+			SplitVertices[VertIndex] = Vertices[Loops[LoopIndex]];
+			SplitNormals[VertIndex] = bCornerIndexedNormals ? Normals[TriangleCorners[LoopIndex]] : Normals[LoopIndex];
+			SplitColors[VertIndex] = Colors[LoopIndex].ToFColor(false);
+			SplitUV0[VertIndex] = UV0[LoopIndex];
+			SplitUV1[VertIndex] = UV1[LoopIndex];
+			SplitUV2[VertIndex] = UV2[LoopIndex];
+			SplitUV3[VertIndex] = UV3[LoopIndex];
+		});
+
+		// Triangulated faces share corners, last write wins as it did when welding serially
 		for (int32 LoopIndex = 0; LoopIndex < Loops.Num(); LoopIndex++)
-		{			
-			if (const int32* SplitVertLoopIndex = UniqueVertices.FindByHash(HashValues[LoopIndex], HashedItems[LoopIndex]))
-			{
-				Loops[LoopIndex] = Loops[*SplitVertLoopIndex];
-				CornerToVertexIndex[TriangleCorners[LoopIndex]] = CornerToVertexIndex[TriangleCorners[*SplitVertLoopIndex]];
-			}
-			else
-			{
-				const int32 NewVertIndex = SplitVertices.Add(Vertices[Loops[LoopIndex]]);
-
-				CornerToVertexIndex[TriangleCorners[LoopIndex]] = NewVertIndex;
-				Loops[LoopIndex] = NewVertIndex;
-				SplitNormals.Add(bCornerIndexedNormals ? Normals[TriangleCorners[LoopIndex]] : Normals[LoopIndex]);
-				SplitColors.Add(Colors[LoopIndex].ToFColor(false));
-				SplitUV0.Add(UV0[LoopIndex]);
-				SplitUV1.Add(UV1[LoopIndex]);
-				SplitUV2.Add(UV2[LoopIndex]);
-				SplitUV3.Add(UV3[LoopIndex]);
-				
-				UniqueVertices.AddByHash(HashValues[LoopIndex], HashedItems[LoopIndex], LoopIndex);
-			}
+		{
+			Loops[LoopIndex] = VertexIndices[LoopIndex];
+			CornerToVertexIndex[TriangleCorners[LoopIndex]] = VertexIndices[LoopIndex];
 		}
 	}
 	
@@ -3,23 +3,38 @@
 #include "AlterMeshInstance.h"
 
 #include "AlterMesh/AlterMesh.h"
+#include "AlterMeshActor.h"
 #include "AlterMeshAsset.h"
 #include "AlterMeshComponent.h"
 #include "AlterMeshExport.h"
 #include "AlterMeshImport.h"
+#include "AlterMeshResultCache.h"
 #include "AlterMeshSettings.h"
+#include "AlterMeshWorkerPool.h"
 #include "StructView.h"
-#include "Interfaces/IPluginManager.h"
-#include "Misc/Paths.h"
 #include "AlterMeshHandle.h"
 
-#include <Extern/AlterMesh.h>
-#pragma comment(lib, "AlterMesh.lib")
+void FAlterMeshRefreshCallbackTask::DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	// Newer refresh is pending, don't build components from outdated meshes
+	if (!Job->IsSuperseded())
+	{
+		Callback.ExecuteIfBound(Promise->GetFuture().Get());
+		OnRefreshDelegate.Broadcast();
+	}
 
-#if WITH_EDITOR
-#include "DirectoryWatcherModule.h"
-#include "IDirectoryWatcher.h"
-#endif
+	// Released even if instance is gone, so waiting instances aren't blocked
+	if (Job->Worker.IsValid() && FAlterMeshWorkerPool::IsAvailable())
+	{
+		FAlterMeshWorkerPool::Get().Release(Job->Worker);
+		Job->Worker.Reset();
+	}
+
+	if (Instance.IsValid())
+	{
+		Instance->OnRefreshFinished(Job);
+	}
+}
 
 UAlterMeshInstance::UAlterMeshInstance()
 {
@@ -35,14 +50,15 @@ void UAlterMeshInstance::Tick(float DeltaTime)
 	IdleTime += DeltaTime;
 	const float Timeout = GetDefault<UAlterMeshSettings>()->MaxIdleTime;
 
-	if (IdleTime > Timeout)
+	// Shared workers are closed by the pool
+	if (DedicatedWorker.IsValid() && IdleTime > Timeout)
 	{
 		CleanupProcess();
 	}
 
 	if (State != EAlterMeshInstanceState::Closed)
 	{
-		State = NumRefreshActions > 0 ? EAlterMeshInstanceState::Working : EAlterMeshInstanceState::Idle;
+		State = InFlightRefresh.IsValid() ? EAlterMeshInstanceState::Working : EAlterMeshInstanceState::Idle;
 	}
 }
 
@@ -63,106 +79,93 @@ void UAlterMeshInstance::RefreshSync(const FAlterMeshInputParams& InputParams, U
 
 void UAlterMeshInstance::RefreshAsync(const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback)
 {
+	if (InFlightRefresh.IsValid())
+	{
+		// Replaces the previous pending request, the in-flight one only finishes the Blender round-trip
+		IdleTime = 0.f;
+		*InFlightRefresh->Superseded = true;
+		PendingRefreshParams = InputParams;
+		PendingRefresh = FPendingRefresh{Asset, Callback};
+		return;
+	}
+
 	EnqueueRefreshTasks(InputParams, Asset, Callback, true);
 }
 
-#if	WITH_EDITOR
-void UAlterMeshInstance::OnAssetChanged(const TArray<FFileChangeData>& FileChangeDatas)
+void UAlterMeshInstance::OnRefreshFinished(const FAlterMeshRefreshJobPtr& Job)
 {
-	for (const FFileChangeData& FileChangeData : FileChangeDatas)
+	if (InFlightRefresh != Job)
 	{
-		if (FileChangeData.Filename == CachedFileName)
+		return;
+	}
+
+	InFlightRefresh.Reset();
+
+	if (PendingRefresh.IsSet())
+	{
+		FPendingRefresh Refresh = MoveTemp(PendingRefresh.GetValue());
+		PendingRefresh.Reset();
+
+		const FAlterMeshInputParams Params = MoveTemp(PendingRefreshParams);
+		PendingRefreshParams = FAlterMeshInputParams();
+
+		if (Refresh.Asset.IsValid() && IsValid())
 		{
-			CleanupProcess();
+			EnqueueRefreshTasks(Params, Refresh.Asset.Get(), Refresh.Callback, true);
 		}
 	}
 }
-#endif
 
 bool UAlterMeshInstance::Initialize(FString FilePath, FString ScriptPath)
 {
-	auto Quote = [](FString& In)
-	{
-		return TEXT("\"") + In + TEXT("\"");
-	};
-
 	// Cleanup last proc
 	CleanupProcess();
 
-	const UAlterMeshSettings* Settings = GetDefault<UAlterMeshSettings>();
-	if (Settings->ExecutablePath.FilePath.IsEmpty())
+	DedicatedWorker = MakeShared<FAlterMeshWorker, ESPMode::ThreadSafe>();
+	if (!DedicatedWorker->Launch(FilePath, ScriptPath))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Executable path was not set. Project settings -> AlterMesh -> Executable Path"));
+		DedicatedWorker.Reset();
 		return false;
 	}
 
-	FString Guid = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
-	FString Guid2 = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
-	AlterMeshHandle = MakeShared<FAlterMeshHandle>();
-	AlterMeshHandle->Set(Init(*Guid, *Guid2));
+	AlterMeshHandle = DedicatedWorker->AlterMeshHandle;
+	State = EAlterMeshInstanceState::Idle;
+	return true;
+}
+
+bool UAlterMeshInstance::InitializeShared(const FString& FilePath)
+{
+	CleanupProcess();
 
-	const FString URL = FPaths::ConvertRelativePathToFull(Settings->ExecutablePath.FilePath);
 	if (!FPaths::FileExists(FilePath))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Could not open file: %s"), *FilePath);
 		return false;
 	}
 
-#if WITH_EDITOR
-	CachedFileName = FilePath;
-	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>("DirectoryWatcher");
-	if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
-	{
-		// Watches for file change and restart instance
-		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(FPaths::GetPath(FilePath),
-		                                                          IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &UAlterMeshInstance::OnAssetChanged),
-		                                                          DirectoryWatcherHandle);
-	}
-#endif
-
-	const bool bInteractive = CVarAlterMeshDebugInteractive.GetValueOnGameThread() == 1;
-
-	const FString ProcParams = FString("--factory-startup ")
-		+ (bInteractive ? TEXT(" ") : TEXT(" -b "))
-		+ Quote(FilePath)
-		+ TEXT(" -P ") + Quote(ScriptPath)
-		+ TEXT(" -- ") + Guid2
-		+ TEXT(" ") + Guid;
-
-	BlenderProcess = MakeShareable(new FMonitoredProcess(URL, ProcParams, true));
-	BlenderProcess->OnOutput().BindUObject(this, &UAlterMeshInstance::OnProcOutput);
-	BlenderProcess->Launch();
-	BlenderProcess->SetSleepInterval(0.01f);
-
+	SharedFilePath = FilePath;
 	State = EAlterMeshInstanceState::Idle;
 	return true;
 }
 
 void UAlterMeshInstance::CleanupProcess()
 {
-	if (BlenderProcess.IsValid())
-	{
-		BlenderProcess->Cancel(true);
-		BlenderProcess.Reset();
-	}
+	// Shared workers stay in the pool, in-flight refresh releases its worker when finished
+	DedicatedWorker.Reset();
+	AlterMeshHandle.Reset();
+	SharedFilePath.Reset();
 
 	State = EAlterMeshInstanceState::Closed;
 }
 
 bool UAlterMeshInstance::IsValid()
 {
-	return BlenderProcess.IsValid() && BlenderProcess->Update();
-}
-
-void UAlterMeshInstance::OnProcOutput(FString Output) const
-{
-	if (CVarAlterMeshDebugProcessOutput.GetValueOnAnyThread())
+	if (DedicatedWorker.IsValid())
 	{
-		if (!Output.IsEmpty())
-		{
-			UE_LOG(LogAlterMeshImport, Log, TEXT("%s"), *Output);
-		}
+		return DedicatedWorker->IsRunning();
 	}
+
+	return !SharedFilePath.IsEmpty();
 }
 
 void UAlterMeshInstance::EnqueueRefreshTasks(const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback, bool bAsync)
@@ -172,40 +175,139 @@ void UAlterMeshInstance::EnqueueRefreshTasks(const FAlterMeshInputParams& InputP
 		return;
 	}
 
-	FAlterMeshExport Exporter(AlterMeshHandle, InputParams, Asset, GetTypedOuter<AActor>());
-	FAlterMeshImport Importer(AlterMeshHandle, Asset);
-	
 	if (!bAsync)
 	{
+		TArray<TSharedPtr<FAlterMeshPrimitive>> OutMeshes;
+
+		FAlterMeshExport Exporter(nullptr, InputParams, Asset, GetTypedOuter<AActor>());
 		Exporter.PreExport();
+
+		// Cache is checked before leasing, hits don't need Blender at all
+		uint64 ResultKey = 0;
+		if (FAlterMeshResultCache::IsEnabled())
+		{
+			ResultKey = FAlterMeshResultCache::GetResultKey(Exporter.Serialize(), UsesHighQualityTangents());
+
+			if (FAlterMeshResultCache::Get().Find(ResultKey, OutMeshes))
+			{
+				FAlterMeshImport(nullptr, Asset).SetupMaterials(OutMeshes);
+				Callback.ExecuteIfBound(OutMeshes);
+				return;
+			}
+		}
+
+		// Sync refreshes can't wait for other instances, may temporarily exceed the worker limit
+		FAlterMeshWorkerPtr Worker = DedicatedWorker.IsValid() ? nullptr : FAlterMeshWorkerPool::Get().TryLease(SharedFilePath, true);
+		const TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> Handle = Worker.IsValid() ? Worker->AlterMeshHandle : AlterMeshHandle;
+		if (!Handle.IsValid())
+		{
+			return;
+		}
+
+		FAlterMeshImport Importer(Handle, Asset);
+		Importer.bHighQualityTangents = UsesHighQualityTangents();
+
+		Exporter.SetHandle(Handle);
 		Exporter.Export();
-		TArray<TSharedPtr<FAlterMeshPrimitive>> OutMeshes;
-		Importer.ImportMeshes(OutMeshes);	
+		Importer.ImportMeshes(OutMeshes);
+
+		if (Worker.IsValid())
+		{
+			FAlterMeshWorkerPool::Get().Release(Worker);
+		}
+
+		if (ResultKey != 0 && OutMeshes.Num())
+		{
+			FAlterMeshResultCache::Get().Add(ResultKey, OutMeshes);
+		}
+
 		Callback.ExecuteIfBound(OutMeshes);		
 		return;
 	}
 	
-	// Current and pending refresh
-	if (NumRefreshActions >= 2)
+	IdleTime = 0.f;
+
+	// Export tasks run after this call returns, the previous in-flight refresh has finished already
+	InFlightRefreshParams = InputParams;
+	
+	InFlightRefresh = MakeShared<FAlterMeshRefreshJob, ESPMode::ThreadSafe>();
+	InFlightRefresh->bHighQualityTangents = UsesHighQualityTangents();
+	State = EAlterMeshInstanceState::Working;
+
+	// Cache is checked before leasing, hits neither wait for a worker nor start Blender
+	if (FAlterMeshResultCache::IsEnabled())
 	{
+		FAlterMeshExport Exporter(nullptr, InFlightRefreshParams, Asset, GetTypedOuter<AActor>());
+		Exporter.PreExport();
+		InFlightRefresh->ResultKey = FAlterMeshResultCache::GetResultKey(Exporter.Serialize(), InFlightRefresh->bHighQualityTangents);
+
+		TArray<TSharedPtr<FAlterMeshPrimitive>> CachedMeshes;
+		if (FAlterMeshResultCache::Get().Find(InFlightRefresh->ResultKey, CachedMeshes))
+		{
+			FAlterMeshImport(nullptr, Asset).SetupMaterials(CachedMeshes);
+
+			TSharedPtr<TMeshPromise> Promise = MakeShared<TMeshPromise>();
+			Promise->SetValue(MoveTemp(CachedMeshes));
+			TGraphTask<FAlterMeshRefreshCallbackTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Callback, OnRefreshDelegate, this, Promise, InFlightRefresh);
+			return;
+		}
+	}
+
+	if (DedicatedWorker.IsValid())
+	{
+		DispatchRefreshTasks(AlterMeshHandle, InFlightRefreshParams, Asset, Callback);
 		return;
 	}
-	
-	IdleTime = 0.f;
-	
-	NumRefreshActions++;
-	State = EAlterMeshInstanceState::Working;	
 
-	// Export params	
-	FGraphEventArray PreExportPrerequisites;
-	if (PreviousTask.IsValid())
+	// Waits in the pool queue if all workers of the file are busy
+	const FAlterMeshRefreshJobPtr Job = InFlightRefresh;
+	const TWeakObjectPtr<UAlterMeshAssetInterface> WeakAsset = Asset;
+
+	const bool bLeased = FAlterMeshWorkerPool::Get().Lease(SharedFilePath, FOnAlterMeshWorkerLeased::CreateWeakLambda(this,
+		[this, Job, WeakAsset, Callback](FAlterMeshWorkerPtr Worker)
+		{
+			// No worker could be launched for the file, finishes without meshes
+			if (!Worker.IsValid())
+			{
+				OnRefreshFinished(Job);
+				return;
+			}
+
+			Job->Worker = Worker;
+
+			// Superseded while waiting, the pending refresh will lease its own worker
+			if (Job->IsSuperseded() || !WeakAsset.IsValid())
+			{
+				FAlterMeshWorkerPool::Get().Release(Worker);
+				Job->Worker.Reset();
+				OnRefreshFinished(Job);
+				return;
+			}
+
+			DispatchRefreshTasks(Worker->AlterMeshHandle, InFlightRefreshParams, WeakAsset.Get(), Callback);
+		}));
+
+	if (!bLeased)
 	{
-		PreExportPrerequisites.Add(PreviousTask);
+		InFlightRefresh.Reset();
 	}
-	
+}
+
+bool UAlterMeshInstance::UsesHighQualityTangents() const
+{
+	const AAlterMeshActor* Actor = GetTypedOuter<AAlterMeshActor>();
+	return Actor && Actor->bHighQualityTangents;
+}
+
+void UAlterMeshInstance::DispatchRefreshTasks(const TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe>& Handle, const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback)
+{
+	FAlterMeshExport Exporter(Handle, InputParams, Asset, GetTypedOuter<AActor>());
+	FAlterMeshImport Importer(Handle, Asset);
+
+	// Export params
 	TSharedPtr<TMeshPromise> Promise = MakeShared<TMeshPromise>();
 	
-	FGraphEventRef PreExportTask = TGraphTask<FAlterMeshRefreshPreExportTask>::CreateTask(&PreExportPrerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Exporter);
+	FGraphEventRef PreExportTask = TGraphTask<FAlterMeshRefreshPreExportTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Exporter, InFlightRefresh);
 
 	if (!FTaskGraphInterface::Get().IsThreadProcessingTasks(ENamedThreads::GameThread))
 	{
@@ -213,15 +315,13 @@ void UAlterMeshInstance::EnqueueRefreshTasks(const FAlterMeshInputParams& InputP
 	}	
 	
 	FGraphEventArray ExportPrerequisites({PreExportTask});
-	FGraphEventRef ExportTask = TGraphTask<FAlterMeshRefreshExportTask>::CreateTask(&ExportPrerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Exporter);
+	FGraphEventRef ExportTask = TGraphTask<FAlterMeshRefreshExportTask>::CreateTask(&ExportPrerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Exporter, InFlightRefresh);
 
 	// Import meshes
 	FGraphEventArray ImportPrerequisites({ ExportTask });
-	FGraphEventRef ImportTask = TGraphTask<FAlterMeshRefreshImportTask>::CreateTask(&ImportPrerequisites,  ENamedThreads::AnyThread).ConstructAndDispatchWhenReady(Importer, Promise);
+	FGraphEventRef ImportTask = TGraphTask<FAlterMeshRefreshImportTask>::CreateTask(&ImportPrerequisites,  ENamedThreads::AnyThread).ConstructAndDispatchWhenReady(Importer, Promise, InFlightRefresh);
 
 	// Build components		
 	FGraphEventArray CallbackPrerequisites({ ImportTask });
-	FGraphEventRef CallbackTask = TGraphTask<FAlterMeshRefreshCallbackTask>::CreateTask(&CallbackPrerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Callback, OnRefreshDelegate, NumRefreshActions, Promise);
-
-	PreviousTask = CallbackTask;
+	TGraphTask<FAlterMeshRefreshCallbackTask>::CreateTask(&CallbackPrerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Callback, OnRefreshDelegate, this, Promise, InFlightRefresh);
 }
@@ -0,0 +1,412 @@
+﻿// Copyright 2023 Aechmea
+
+#include "AlterMeshResultCache.h"
+
+#include "AlterMeshAsset.h"
+#include "AlterMeshLibrary.h"
+#include "AlterMeshSettings.h"
+#include "Async/Async.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+
+namespace AlterMeshResultCache
+{
+	static constexpr uint32 Magic = 0x434D4D41; // AMMC
+	static constexpr uint32 Version = 1;
+}
+
+TUniquePtr<FAlterMeshResultCache> FAlterMeshResultCache::Instance;
+
+FAlterMeshResultCache& FAlterMeshResultCache::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = MakeUnique<FAlterMeshResultCache>();
+	}
+
+	return *Instance;
+}
+
+void FAlterMeshResultCache::Shutdown()
+{
+	Instance.Reset();
+}
+
+bool FAlterMeshResultCache::IsEnabled()
+{
+	return GetDefault<UAlterMeshSettings>()->bCacheResults;
+}
+
+bool FAlterMeshResultCache::Find(uint64 Key, TArray<TSharedPtr<FAlterMeshPrimitive>>& OutMeshes)
+{
+	if (!IsEnabled())
+	{
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (FEntry* Entry = Entries.Find(Key))
+		{
+			Entry->LastAccess = ++AccessCounter;
+			for (const TSharedPtr<FAlterMeshPrimitive>& Mesh : Entry->Meshes)
+			{
+				OutMeshes.Add(CopyMesh(*Mesh));
+			}
+
+			return true;
+		}
+	}
+
+	if (!GetDefault<UAlterMeshSettings>()->bPersistResultCache)
+	{
+		return false;
+	}
+
+	TArray<uint8> Data;
+	const FString Filename = GetCacheFilename(Key);
+	if (!FFileHelper::LoadFileToArray(Data, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	// Modification time is the last access for TrimDisk
+	IFileManager::Get().SetTimeStamp(*Filename, FDateTime::UtcNow());
+
+	FMemoryReader MemoryReader(Data);
+	FNameAsStringProxyArchive Reader(MemoryReader);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != AlterMeshResultCache::Magic || Version != AlterMeshResultCache::Version)
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes;
+	SerializeMeshes(Reader, Meshes);
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FAlterMeshPrimitive>& Mesh : Meshes)
+	{
+		OutMeshes.Add(CopyMesh(*Mesh));
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	AddToMemory(Key, MoveTemp(Meshes));
+	return true;
+}
+
+void FAlterMeshResultCache::Add(uint64 Key, const TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FAlterMeshPrimitive>> CachedMeshes;
+	for (const TSharedPtr<FAlterMeshPrimitive>& Mesh : Meshes)
+	{
+		TSharedPtr<FAlterMeshPrimitive> CachedMesh = CopyMesh(*Mesh);
+
+		// Don't keep UObjects alive, materials are assigned again on hit
+		for (FAlterMeshSection& Section : CachedMesh->Sections)
+		{
+			Section.Material = nullptr;
+		}
+
+		CachedMeshes.Add(CachedMesh);
+	}
+
+	if (GetDefault<UAlterMeshSettings>()->bPersistResultCache)
+	{
+		TArray<uint8> Data;
+		FMemoryWriter MemoryWriter(Data);
+		FNameAsStringProxyArchive Writer(MemoryWriter);
+
+		uint32 Magic = AlterMeshResultCache::Magic;
+		uint32 Version = AlterMeshResultCache::Version;
+		Writer << Magic << Version;
+		SerializeMeshes(Writer, CachedMeshes);
+
+		// Writes to a temporary file first, so concurrent reads never see partial data
+		// Unique per write, concurrent adds of the same key would otherwise write the same file
+		const int64 MaxDiskSize = static_cast<int64>(GetDefault<UAlterMeshSettings>()->MaxResultCacheDiskSize * 1024 * 1024);
+		Async(EAsyncExecution::ThreadPool, [Filename = GetCacheFilename(Key), Data = MoveTemp(Data), MaxDiskSize]()
+		{
+			const FString TempFilename = FString::Printf(TEXT("%s.%s.tmp"), *Filename, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+			if (FFileHelper::SaveArrayToFile(Data, *TempFilename))
+			{
+				if (!IFileManager::Get().Move(*Filename, *TempFilename, true, true))
+				{
+					IFileManager::Get().Delete(*TempFilename, false, false, true);
+				}
+			}
+
+			TrimDisk(MaxDiskSize);
+		});
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	AddToMemory(Key, MoveTemp(CachedMeshes));
+}
+
+void FAlterMeshResultCache::Clear()
+{
+	FScopeLock Lock(&CriticalSection);
+	Entries.Empty();
+	TotalSize = 0;
+}
+
+void FAlterMeshResultCache::AddToMemory(uint64 Key, TArray<TSharedPtr<FAlterMeshPrimitive>>&& Meshes)
+{
+	if (FEntry* Existing = Entries.Find(Key))
+	{
+		TotalSize -= Existing->Size;
+	}
+
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Meshes = MoveTemp(Meshes);
+	Entry.LastAccess = ++AccessCounter;
+	Entry.Size = 0;
+	for (const TSharedPtr<FAlterMeshPrimitive>& Mesh : Entry.Meshes)
+	{
+		Entry.Size += GetAllocatedSize(*Mesh);
+	}
+
+	TotalSize += Entry.Size;
+	Trim();
+}
+
+void FAlterMeshResultCache::Trim()
+{
+	const int64 MaxSize = static_cast<int64>(GetDefault<UAlterMeshSettings>()->MaxResultCacheMemory * 1024 * 1024);
+
+	// Least recently used first, entry just added is kept even if larger than the budget
+	while (TotalSize > MaxSize && Entries.Num() > 1)
+	{
+		uint64 OldestKey = 0;
+		uint64 OldestAccess = MAX_uint64;
+		for (const TPair<uint64, FEntry>& Entry : Entries)
+		{
+			if (Entry.Value.LastAccess < OldestAccess)
+			{
+				OldestAccess = Entry.Value.LastAccess;
+				OldestKey = Entry.Key;
+			}
+		}
+
+		TotalSize -= Entries.FindChecked(OldestKey).Size;
+		Entries.Remove(OldestKey);
+	}
+}
+
+TSharedPtr<FAlterMeshPrimitive> FAlterMeshResultCache::CopyMesh(FAlterMeshPrimitive& Mesh)
+{
+	TSharedPtr<FAlterMeshPrimitive> OutMesh = MakeShared<FAlterMeshPrimitive>();
+	OutMesh->bIsInstance = Mesh.bIsInstance;
+	OutMesh->AssetPath = Mesh.AssetPath;
+	OutMesh->Hash = Mesh.Hash;
+
+	for (FAlterMeshSection& Section : Mesh.Sections)
+	{
+		OutMesh->Sections.Add(Section.Copy());
+	}
+
+	return OutMesh;
+}
+
+int64 FAlterMeshResultCache::GetAllocatedSize(const FAlterMeshPrimitive& Mesh)
+{
+	int64 Size = sizeof(FAlterMeshPrimitive);
+	for (const FAlterMeshSection& Section : Mesh.Sections)
+	{
+		Size += sizeof(FAlterMeshSection)
+			+ Section.Vertices.GetAllocatedSize()
+			+ Section.Normals.GetAllocatedSize()
+			+ Section.Tangents.GetAllocatedSize()
+			+ Section.Bitangents.GetAllocatedSize()
+			+ Section.Indices.GetAllocatedSize()
+			+ Section.UV0.GetAllocatedSize()
+			+ Section.UV1.GetAllocatedSize()
+			+ Section.UV2.GetAllocatedSize()
+			+ Section.UV3.GetAllocatedSize()
+			+ Section.Colors.GetAllocatedSize()
+			+ Section.Instances.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+uint64 FAlterMeshResultCache::GetAssetKey(const UAlterMeshAsset* Asset)
+{
+	if (!Asset)
+	{
+		return 0;
+	}
+
+	// Timestamp and size instead of the file contents, .blend files can be hundreds of MB
+	const FString FilePath = UAlterMeshLibrary::ConvertFilenameToFull(Asset->Filename.FilePath);
+	const FFileStatData StatData = IFileManager::Get().GetStatData(*FilePath);
+	const int64 Ticks = StatData.ModificationTime.GetTicks();
+
+	FXxHash64Builder Builder;
+	Builder.Update(*FilePath, FilePath.Len() * sizeof(TCHAR));
+	Builder.Update(&Ticks, sizeof(Ticks));
+	Builder.Update(&StatData.FileSize, sizeof(StatData.FileSize));
+	Builder.Update(*Asset->ObjectName, Asset->ObjectName.Len() * sizeof(TCHAR));
+	Builder.Update(&Asset->CoordinateSpace, sizeof(Asset->CoordinateSpace));
+
+	for (const FAlterMeshAttributeMapping& Mapping : Asset->AttributeMapping)
+	{
+		const FString From = Mapping.From.ToString();
+		Builder.Update(*From, From.Len() * sizeof(TCHAR));
+		Builder.Update(&Mapping.FromChannel, sizeof(Mapping.FromChannel));
+		Builder.Update(&Mapping.To, sizeof(Mapping.To));
+		Builder.Update(&Mapping.ToChannel, sizeof(Mapping.ToChannel));
+	}
+
+	const uint32 Version = AlterMeshResultCache::Version;
+	Builder.Update(&Version, sizeof(Version));
+
+	return Builder.Finalize().Hash;
+}
+
+uint64 FAlterMeshResultCache::GetResultKey(uint64 ExportKey, bool bHighQualityTangents)
+{
+	FXxHash64Builder Builder;
+	Builder.Update(&ExportKey, sizeof(ExportKey));
+	Builder.Update(&bHighQualityTangents, sizeof(bHighQualityTangents));
+	return Builder.Finalize().Hash;
+}
+
+FString FAlterMeshResultCache::GetCacheDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AlterMesh"), TEXT("ResultCache"));
+}
+
+FString FAlterMeshResultCache::GetCacheFilename(uint64 Key)
+{
+	return FPaths::Combine(GetCacheDirectory(), FString::Printf(TEXT("%016llx.bin"), Key));
+}
+
+void FAlterMeshResultCache::TrimDisk(int64 MaxSize)
+{
+	struct FCacheFile
+	{
+		FString Filename;
+		int64 Size;
+		FDateTime LastAccess;
+	};
+
+	// Leftovers of writes interrupted by a crash
+	const FDateTime StaleTempTime = FDateTime::UtcNow() - FTimespan::FromHours(1.0);
+
+	TArray<FCacheFile> Files;
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStat(*GetCacheDirectory(), [&](const TCHAR* Filename, const FFileStatData& StatData)
+	{
+		if (StatData.bIsDirectory)
+		{
+			return true;
+		}
+
+		if (FPaths::GetExtension(Filename) == TEXT("tmp"))
+		{
+			if (StatData.ModificationTime < StaleTempTime)
+			{
+				IFileManager::Get().Delete(Filename, false, false, true);
+			}
+			return true;
+		}
+
+		Files.Add({Filename, StatData.FileSize, StatData.ModificationTime});
+		TotalSize += StatData.FileSize;
+		return true;
+	});
+
+	if (TotalSize <= MaxSize)
+	{
+		return;
+	}
+
+	// Also removes results of .blend files that changed since, their keys are never requested again
+	Files.Sort([](const FCacheFile& A, const FCacheFile& B)
+	{
+		return A.LastAccess < B.LastAccess;
+	});
+
+	for (const FCacheFile& File : Files)
+	{
+		if (TotalSize <= MaxSize)
+		{
+			break;
+		}
+
+		if (IFileManager::Get().Delete(*File.Filename, false, false, true))
+		{
+			TotalSize -= File.Size;
+		}
+	}
+}
+
+void FAlterMeshResultCache::SerializeMeshes(FArchive& Ar, TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes)
+{
+	int32 NumMeshes = Meshes.Num();
+	Ar << NumMeshes;
+
+	if (NumMeshes < 0)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	for (int32 MeshIndex = 0; MeshIndex < NumMeshes && !Ar.IsError(); MeshIndex++)
+	{
+		if (Ar.IsLoading())
+		{
+			Meshes.Add(MakeShared<FAlterMeshPrimitive>());
+		}
+
+		FAlterMeshPrimitive& Mesh = *Meshes[MeshIndex];
+		Ar << Mesh.bIsInstance;
+		Ar << Mesh.AssetPath;
+		Ar << Mesh.Hash;
+
+		int32 NumSections = Mesh.Sections.Num();
+		Ar << NumSections;
+
+		for (int32 SectionIndex = 0; SectionIndex < NumSections && !Ar.IsError(); SectionIndex++)
+		{
+			if (Ar.IsLoading())
+			{
+				Mesh.Sections.Add(FAlterMeshSection());
+			}
+
+			FAlterMeshSection& Section = Mesh.Sections[SectionIndex];
+			Ar << Section.Vertices;
+			Ar << Section.Normals;
+			Ar << Section.Tangents;
+			Ar << Section.Bitangents;
+			Ar << Section.Indices;
+			Ar << Section.UV0;
+			Ar << Section.UV1;
+			Ar << Section.UV2;
+			Ar << Section.UV3;
+			Ar << Section.Colors;
+			Ar << Section.MaterialName;
+			Ar << Section.Hash;
+			Ar << Section.Instances;
+		}
+	}
+}
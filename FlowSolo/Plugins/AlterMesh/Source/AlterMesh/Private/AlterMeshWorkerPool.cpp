@@ -0,0 +1,383 @@
+﻿// Copyright 2023 Aechmea
+
+#include "AlterMeshWorkerPool.h"
+
+#include "AlterMesh/AlterMesh.h"
+#include "AlterMeshImport.h"
+#include "AlterMeshInstance.h"
+#include "AlterMeshSettings.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+
+#include <Extern/AlterMesh.h>
+#pragma comment(lib, "AlterMesh.lib")
+
+#if WITH_EDITOR
+#include "DirectoryWatcherModule.h"
+#endif
+
+TUniquePtr<FAlterMeshWorkerPool> FAlterMeshWorkerPool::Instance;
+
+// Seconds between launch attempts once a launch failed, waiting requests would otherwise relaunch every tick
+static constexpr double LaunchRetryDelay = 5.0;
+
+FAlterMeshWorker::~FAlterMeshWorker()
+{
+	if (BlenderProcess.IsValid())
+	{
+		BlenderProcess->Cancel(true);
+		BlenderProcess.Reset();
+	}
+}
+
+bool FAlterMeshWorker::Launch(const FString& InFilePath, const FString& ScriptPath)
+{
+	auto Quote = [](const FString& In)
+	{
+		return TEXT("\"") + In + TEXT("\"");
+	};
+
+	const UAlterMeshSettings* Settings = GetDefault<UAlterMeshSettings>();
+	if (Settings->ExecutablePath.FilePath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Executable path was not set. Project settings -> AlterMesh -> Executable Path"));
+		return false;
+	}
+
+	if (!FPaths::FileExists(InFilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not open file: %s"), *InFilePath);
+		return false;
+	}
+
+	FilePath = InFilePath;
+
+	FString Guid = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
+	FString Guid2 = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
+	AlterMeshHandle = MakeShared<FAlterMeshHandle>();
+	AlterMeshHandle->Set(Init(*Guid, *Guid2));
+
+	// Blender loads the same library, a stale build would corrupt every exchange
+	if (GetProtocolVersion(AlterMeshHandle->Get()) != ALTERMESH_PROTOCOL_VERSION)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AlterMesh library doesn't match protocol version %d, rebuild Source/Extern/AlterMesh.dll"), ALTERMESH_PROTOCOL_VERSION);
+		AlterMeshHandle.Reset();
+		return false;
+	}
+
+	const FString URL = FPaths::ConvertRelativePathToFull(Settings->ExecutablePath.FilePath);
+	const bool bInteractive = CVarAlterMeshDebugInteractive.GetValueOnGameThread() == 1;
+
+	const FString ProcParams = FString("--factory-startup ")
+		+ (bInteractive ? TEXT(" ") : TEXT(" -b "))
+		+ Quote(InFilePath)
+		+ TEXT(" -P ") + Quote(ScriptPath)
+		+ TEXT(" -- ") + Guid2
+		+ TEXT(" ") + Guid;
+
+	BlenderProcess = MakeShareable(new FMonitoredProcess(URL, ProcParams, true));
+	BlenderProcess->OnOutput().BindStatic(&FAlterMeshWorker::OnProcOutput);
+	BlenderProcess->Launch();
+
+	// Only used to forward the output, data goes through the shared memory
+	BlenderProcess->SetSleepInterval(0.1f);
+
+	return true;
+}
+
+bool FAlterMeshWorker::IsRunning() const
+{
+	return BlenderProcess.IsValid() && BlenderProcess->Update();
+}
+
+void FAlterMeshWorker::OnProcOutput(FString Output)
+{
+	if (CVarAlterMeshDebugProcessOutput.GetValueOnAnyThread())
+	{
+		if (!Output.IsEmpty())
+		{
+			UE_LOG(LogAlterMeshImport, Log, TEXT("%s"), *Output);
+		}
+	}
+}
+
+FAlterMeshWorkerPool& FAlterMeshWorkerPool::Get()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FAlterMeshWorkerPool>(new FAlterMeshWorkerPool());
+	}
+
+	return *Instance;
+}
+
+void FAlterMeshWorkerPool::Shutdown()
+{
+	Instance.Reset();
+}
+
+FAlterMeshWorkerPool::FAlterMeshWorkerPool()
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAlterMeshWorkerPool::Tick));
+}
+
+FAlterMeshWorkerPool::~FAlterMeshWorkerPool()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+#if WITH_EDITOR
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>("DirectoryWatcher"))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			for (const TPair<FString, FDelegateHandle>& WatchedDirectory : WatchedDirectories)
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedDirectory.Key, WatchedDirectory.Value);
+			}
+		}
+	}
+#endif
+}
+
+FString FAlterMeshWorkerPool::GetScriptPath()
+{
+	const FString PluginDir = IPluginManager::Get().FindPlugin(TEXT("AlterMesh"))->GetBaseDir();
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(PluginDir, FString("\\Source\\ThirdParty\\__init__.py")));
+}
+
+FAlterMeshWorkerPtr FAlterMeshWorkerPool::TryLease(const FString& FilePath, bool bAllowOverflow)
+{
+	if (FilePath.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	FFileWorkers& FileWorkers = Files.FindOrAdd(FilePath);
+
+	for (const FAlterMeshWorkerPtr& Worker : FileWorkers.Workers)
+	{
+		if (!Worker->bLeased && !Worker->bStale && Worker->IsRunning())
+		{
+			Worker->bLeased = true;
+			return Worker;
+		}
+	}
+
+	// Dead workers are removed by the tick, count only the live ones
+	const int32 NumRunning = FileWorkers.Workers.FilterByPredicate([](const FAlterMeshWorkerPtr& Worker)
+	{
+		return Worker->bLeased || Worker->IsRunning();
+	}).Num();
+
+	const int32 MaxWorkers = FMath::Max(1, GetDefault<UAlterMeshSettings>()->MaxWorkersPerFile);
+	if (NumRunning >= MaxWorkers && !bAllowOverflow)
+	{
+		return nullptr;
+	}
+
+	if (FPlatformTime::Seconds() < FileWorkers.NextLaunchTime)
+	{
+		return nullptr;
+	}
+
+	FAlterMeshWorkerPtr NewWorker = MakeShared<FAlterMeshWorker, ESPMode::ThreadSafe>();
+	if (!NewWorker->Launch(FilePath, GetScriptPath()))
+	{
+		FileWorkers.NextLaunchTime = FPlatformTime::Seconds() + LaunchRetryDelay;
+		return nullptr;
+	}
+
+#if WITH_EDITOR
+	WatchDirectory(FilePath);
+#endif
+
+	NewWorker->bLeased = true;
+	FileWorkers.Workers.Add(NewWorker);
+	return NewWorker;
+}
+
+bool FAlterMeshWorkerPool::Lease(const FString& FilePath, FOnAlterMeshWorkerLeased OnLeased)
+{
+	if (FAlterMeshWorkerPtr Worker = TryLease(FilePath))
+	{
+		OnLeased.ExecuteIfBound(Worker);
+		return true;
+	}
+
+	// Nothing to wait for if worker can't be launched at all
+	FFileWorkers& FileWorkers = Files.FindOrAdd(FilePath);
+	if (FileWorkers.Workers.Num() == 0)
+	{
+		return false;
+	}
+
+	FileWorkers.Waiting.Add(OnLeased);
+	return true;
+}
+
+void FAlterMeshWorkerPool::Release(const FAlterMeshWorkerPtr& Worker)
+{
+	if (!Worker.IsValid())
+	{
+		return;
+	}
+
+	Worker->bLeased = false;
+	Worker->IdleTime = 0.f;
+
+	FFileWorkers* FileWorkers = Files.Find(Worker->FilePath);
+	if (!FileWorkers)
+	{
+		return;
+	}
+
+	const int32 MaxWorkers = FMath::Max(1, GetDefault<UAlterMeshSettings>()->MaxWorkersPerFile);
+	const bool bOverflow = FileWorkers->Workers.Num() > MaxWorkers && FileWorkers->Waiting.Num() == 0;
+	if (Worker->bStale || bOverflow || !Worker->IsRunning())
+	{
+		FileWorkers->Workers.Remove(Worker);
+	}
+
+	ServeWaiting(Worker->FilePath);
+}
+
+void FAlterMeshWorkerPool::ServeWaiting(const FString& FilePath)
+{
+	FFileWorkers* FileWorkers = Files.Find(FilePath);
+	while (FileWorkers && FileWorkers->Waiting.Num() > 0)
+	{
+		FOnAlterMeshWorkerLeased OnLeased = FileWorkers->Waiting[0];
+		FileWorkers->Waiting.RemoveAt(0);
+
+		// Instance has been destroyed while waiting
+		if (!OnLeased.IsBound())
+		{
+			continue;
+		}
+
+		FAlterMeshWorkerPtr Worker = TryLease(FilePath);
+		if (!Worker.IsValid())
+		{
+			FileWorkers = Files.Find(FilePath);
+
+			const bool bHasRunningWorkers = FileWorkers->Workers.ContainsByPredicate([](const FAlterMeshWorkerPtr& FileWorker)
+			{
+				return FileWorker->bLeased || FileWorker->IsRunning();
+			});
+
+			if (bHasRunningWorkers)
+			{
+				FileWorkers->Waiting.Insert(OnLeased, 0);
+				break;
+			}
+
+			// Nothing will be released and launching failed, requests would wait forever
+			TArray<FOnAlterMeshWorkerLeased> Failed = MoveTemp(FileWorkers->Waiting);
+			FileWorkers->Waiting.Reset();
+
+			OnLeased.Execute(nullptr);
+			for (const FOnAlterMeshWorkerLeased& FailedOnLeased : Failed)
+			{
+				FailedOnLeased.ExecuteIfBound(nullptr);
+			}
+			break;
+		}
+
+		OnLeased.Execute(Worker);
+
+		// Callback might have leased or released workers
+		FileWorkers = Files.Find(FilePath);
+	}
+}
+
+void FAlterMeshWorkerPool::CloseWorkers(const FString& FilePath)
+{
+	if (FFileWorkers* FileWorkers = Files.Find(FilePath))
+	{
+		for (const FAlterMeshWorkerPtr& Worker : FileWorkers->Workers)
+		{
+			Worker->bStale = true;
+		}
+
+		FileWorkers->Workers.RemoveAll([](const FAlterMeshWorkerPtr& Worker)
+		{
+			return !Worker->bLeased;
+		});
+	}
+}
+
+bool FAlterMeshWorkerPool::Tick(float DeltaTime)
+{
+	const float Timeout = GetDefault<UAlterMeshSettings>()->MaxIdleTime;
+
+	TArray<FString> FilesWithWaiting;
+	for (auto It = Files.CreateIterator(); It; ++It)
+	{
+		FFileWorkers& FileWorkers = It.Value();
+		FileWorkers.Workers.RemoveAll([DeltaTime, Timeout](const FAlterMeshWorkerPtr& Worker)
+		{
+			if (Worker->bLeased)
+			{
+				return false;
+			}
+
+			Worker->IdleTime += DeltaTime;
+			return Worker->IdleTime > Timeout || !Worker->IsRunning();
+		});
+
+		if (FileWorkers.Workers.Num() == 0 && FileWorkers.Waiting.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+		else if (FileWorkers.Waiting.Num() > 0)
+		{
+			FilesWithWaiting.Add(It.Key());
+		}
+	}
+
+	// Replaces workers which died while requests were waiting, callbacks may add new files so it's done after iterating
+	for (const FString& FilePath : FilesWithWaiting)
+	{
+		ServeWaiting(FilePath);
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+void FAlterMeshWorkerPool::WatchDirectory(const FString& FilePath)
+{
+	const FString Directory = FPaths::GetPath(FilePath);
+	if (WatchedDirectories.Contains(Directory))
+	{
+		return;
+	}
+
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>("DirectoryWatcher");
+	if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+	{
+		// Watches for file change and restart workers
+		FDelegateHandle Handle;
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(Directory,
+		                                                          IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FAlterMeshWorkerPool::OnDirectoryChanged),
+		                                                          Handle);
+		WatchedDirectories.Add(Directory, Handle);
+	}
+}
+
+void FAlterMeshWorkerPool::OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges)
+{
+	for (const FFileChangeData& FileChange : FileChanges)
+	{
+		const FString ChangedFile = FPaths::ConvertRelativePathToFull(FileChange.Filename);
+		for (const TPair<FString, FFileWorkers>& File : Files)
+		{
+			if (FPaths::IsSamePath(File.Key, ChangedFile))
+			{
+				CloseWorkers(File.Key);
+				break;
+			}
+		}
+	}
+}
+#endif
@@ -4,125 +4,229 @@
 
 #include "EngineUtils.h"
 #include "Landscape.h"
+#include "LandscapeComponent.h"
 #include "LandscapeDataAccess.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Texture2D.h"
+#include "Hash/xxhash.h"
 
-void UAlterMeshGeometryLandscape::Export(FAlterMeshExport& Exporter)
+#if WITH_EDITOR
+namespace AlterMeshLandscape
 {
-	Super::Export(Exporter);
+	// Quads with a visibility weight below this are exported
+	constexpr int32 VisThreshold = 170;
 
-#if WITH_EDITOR
-	ALandscape* Landscape = nullptr;
-	for (AActor* Actor : FActorRange(GetWorld()))
+	// Texture source id is regenerated whenever the source is written to, which landscape edits do
+	FGuid GetTextureSourceId(const UTexture2D* Texture)
 	{
-		if (Cast<ALandscape>(Actor))
-		{
-			Landscape = Cast<ALandscape>(Actor);
-		}
+		return Texture ? Texture->Source.GetId() : FGuid();
 	}
 
-	if (!Landscape)
+	uint64 GetComponentKey(ULandscapeComponent* Component, int32 ExportLOD)
 	{
-		return;
+		FXxHash64Builder Builder;
+
+		const FGuid HeightmapId = GetTextureSourceId(Component->GetHeightmap());
+		Builder.Update(&HeightmapId, sizeof(HeightmapId));
+
+		for (const FWeightmapLayerAllocationInfo& AllocInfo : Component->GetWeightmapLayerAllocations())
+		{
+			if (AllocInfo.LayerInfo == ALandscapeProxy::VisibilityLayer
+				&& Component->GetWeightmapTextures().IsValidIndex(AllocInfo.WeightmapTextureIndex))
+			{
+				const FGuid WeightmapId = GetTextureSourceId(Component->GetWeightmapTextures()[AllocInfo.WeightmapTextureIndex]);
+				Builder.Update(&WeightmapId, sizeof(WeightmapId));
+				Builder.Update(&AllocInfo.WeightmapTextureChannel, sizeof(AllocInfo.WeightmapTextureChannel));
+			}
+		}
+
+		const FMatrix RelativeMatrix = Component->GetRelativeTransform().ToMatrixWithScale();
+		const FVector Scale = Component->GetComponentTransform().GetScale3D();
+		const FIntPoint SectionBase = Component->GetSectionBase();
+		Builder.Update(&RelativeMatrix, sizeof(RelativeMatrix));
+		Builder.Update(&Scale, sizeof(Scale));
+		Builder.Update(&SectionBase, sizeof(SectionBase));
+		Builder.Update(&ExportLOD, sizeof(ExportLOD));
+
+		return Builder.Finalize().Hash;
 	}
+}
+#endif
 
-	int32 MinX = MAX_int32, MinY = MAX_int32;
-	int32 MaxX = MIN_int32, MaxY = MIN_int32;
+void UAlterMeshGeometryLandscape::Export(FAlterMeshExport& Exporter)
+{
+	Super::Export(Exporter);
 
-	// Find range of entire landscape
-	for (int32 ComponentIndex = 0; ComponentIndex < Landscape->LandscapeComponents.Num(); ComponentIndex++)
+#if WITH_EDITOR
+	ALandscape* Landscape = FindLandscape();
+	if (!Landscape)
 	{
-		ULandscapeComponent* Component = Landscape->LandscapeComponents[ComponentIndex];
-		Component->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+		return;
 	}
 
 	// Create and fill in the vertex position data source.
 	const int32 ComponentSizeQuads = ((Landscape->ComponentSizeQuads + 1) >> Landscape->ExportLOD) - 1;
 	const float ScaleFactor = (float)Landscape->ComponentSizeQuads / (float)ComponentSizeQuads;
-	const int32 NumComponents = Landscape->LandscapeComponents.Num();
 	const int32 VertexCountPerComponent = FMath::Square(ComponentSizeQuads + 1);
-	const int32 VertexCount = NumComponents * VertexCountPerComponent;
-	const int32 TriangleCount = NumComponents * FMath::Square(ComponentSizeQuads) * 2;
-
-	TArray<uint8> VisibilityData;
-	VisibilityData.Empty(VertexCount);
-	VisibilityData.AddZeroed(VertexCount);
 
-	TArray<uint32> Indices;
-	TArray<FVector3f> Vertices;
-	TArray<FVector3f> Normals;
-	TArray<FVector2f> UVs;
-
-	for (int32 ComponentIndex = 0, SelectedComponentIndex = 0; ComponentIndex < Landscape->LandscapeComponents.Num(); ComponentIndex++)
+	// Drop components that were removed since last export
+	for (auto It = ComponentCache.CreateIterator(); It; ++It)
 	{
-		ULandscapeComponent* Component = Landscape->LandscapeComponents[ComponentIndex];
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
 
-		if (MaxDistance > 0 && FVector::Distance(Component->Bounds.Origin, Exporter.Location) > MaxDistance)
+	// Components in range, in the same order as the landscape
+	TArray<ULandscapeComponent*> Components;
+	TArray<uint64> Keys;
+	for (ULandscapeComponent* Component : Landscape->LandscapeComponents)
+	{
+		if (!Component || (MaxDistance > 0 && FVector::Distance(Component->Bounds.Origin, Exporter.Location) > MaxDistance))
 		{
 			continue;
 		}
-		
-		FLandscapeComponentDataInterface CDI(Component, Landscape->ExportLOD);
-		const int32 BaseVertIndex = SelectedComponentIndex++ * VertexCountPerComponent;
 
-		TArray<FWeightmapLayerAllocationInfo>& ComponentWeightmapLayerAllocations = Component->GetWeightmapLayerAllocations();
-		TArray<uint8> CompVisData;
-		for (int32 AllocIdx = 0; AllocIdx < ComponentWeightmapLayerAllocations.Num(); AllocIdx++)
+		Components.Add(Component);
+		Keys.Add(AlterMeshLandscape::GetComponentKey(Component, Landscape->ExportLOD));
+		ComponentCache.FindOrAdd(Component);
+	}
+
+	// Only components whose heightmap, visibility or transform changed are extracted again
+	TArray<FAlterMeshLandscapeComponentData*> ComponentData;
+	TArray<int32> DirtyComponents;
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		FAlterMeshLandscapeComponentData& Data = ComponentCache.FindChecked(Components[ComponentIndex]);
+		if (Data.Key != Keys[ComponentIndex] || Data.Vertices.Num() != VertexCountPerComponent)
 		{
-			FWeightmapLayerAllocationInfo& AllocInfo = ComponentWeightmapLayerAllocations[AllocIdx];
-			if (AllocInfo.LayerInfo == ALandscapeProxy::VisibilityLayer)
-			{
-				CDI.GetWeightmapTextureData(AllocInfo.LayerInfo, CompVisData);
-			}
+			Data.Key = Keys[ComponentIndex];
+			DirtyComponents.Add(ComponentIndex);
 		}
 
-		if (CompVisData.Num() > 0)
+		ComponentData.Add(&Data);
+	}
+
+	// Data interfaces lock the textures, create them here and only read from them in parallel
+	TArray<TUniquePtr<FLandscapeComponentDataInterface>> DataInterfaces;
+	TArray<TArray<uint8>> VisibilityData;
+	DataInterfaces.SetNum(DirtyComponents.Num());
+	VisibilityData.SetNum(DirtyComponents.Num());
+
+	for (int32 DirtyIndex = 0; DirtyIndex < DirtyComponents.Num(); DirtyIndex++)
+	{
+		ULandscapeComponent* Component = Components[DirtyComponents[DirtyIndex]];
+		DataInterfaces[DirtyIndex] = MakeUnique<FLandscapeComponentDataInterface>(Component, Landscape->ExportLOD);
+
+		for (const FWeightmapLayerAllocationInfo& AllocInfo : Component->GetWeightmapLayerAllocations())
 		{
-			for (int32 i = 0; i < VertexCountPerComponent; ++i)
+			if (AllocInfo.LayerInfo == ALandscapeProxy::VisibilityLayer)
 			{
-				VisibilityData[BaseVertIndex + i] = CompVisData[CDI.VertexIndexToTexel(i)];
+				DataInterfaces[DirtyIndex]->GetWeightmapTextureData(AllocInfo.LayerInfo, VisibilityData[DirtyIndex]);
 			}
 		}
+	}
+
+	const FMatrix44f NormalMatrix = Exporter.ToBlenderMatrix.GetMatrixWithoutScale().Inverse().GetTransposed();
+
+	ParallelFor(DirtyComponents.Num(), [&](const int32 DirtyIndex)
+	{
+		ULandscapeComponent* Component = Components[DirtyComponents[DirtyIndex]];
+		FLandscapeComponentDataInterface& CDI = *DataInterfaces[DirtyIndex];
+		const TArray<uint8>& CompVisData = VisibilityData[DirtyIndex];
+		FAlterMeshLandscapeComponentData& Data = *ComponentData[DirtyComponents[DirtyIndex]];
+
+		const FTransform RelativeTransform = Component->GetRelativeTransform();
+		const FVector Scale = Component->GetComponentTransform().GetScale3D();
+		const FIntPoint SectionBase = Component->GetSectionBase();
+
+		Data.Vertices.SetNumUninitialized(VertexCountPerComponent);
+		Data.Normals.SetNumUninitialized(VertexCountPerComponent);
+		Data.UVs.SetNumUninitialized(VertexCountPerComponent);
+
+		TArray<uint8> VertexVisibility;
+		VertexVisibility.SetNumZeroed(VertexCountPerComponent);
 
 		for (int32 VertIndex = 0; VertIndex < VertexCountPerComponent; VertIndex++)
 		{
 			int32 VertX, VertY;
 			CDI.VertexIndexToXY(VertIndex, VertX, VertY);
-			
-			FVector Vertex = CDI.GetLocalVertex(VertX, VertY);
 
-			Vertex = Component->GetRelativeTransform().TransformPosition(Vertex);
-			
-			Vertices.Add(Exporter.ToBlenderMatrix.TransformPosition(FVector3f(Vertex)));
+			const FVector Vertex = RelativeTransform.TransformPosition(CDI.GetLocalVertex(VertX, VertY));
+			Data.Vertices[VertIndex] = Exporter.ToBlenderMatrix.TransformPosition(FVector3f(Vertex));
 
 			FVector Normal, TangentX, TangentY;
 			CDI.GetLocalTangentVectors(VertX, VertY, TangentX, TangentY, Normal);
-			Normal /= Component->GetComponentTransform().GetScale3D();
-			FVector3f TransformedNormal = Exporter.ToBlenderMatrix.GetMatrixWithoutScale().Inverse().GetTransposed().TransformVector(FVector3f(Normal)).GetSafeNormal();
-			Normals.Add(TransformedNormal);
+			Normal /= Scale;
+			Data.Normals[VertIndex] = NormalMatrix.TransformVector(FVector3f(Normal)).GetSafeNormal();
 
-			FVector2f UV = FVector2f(VertX * ScaleFactor + Component->GetSectionBase().X, VertY * ScaleFactor + Component->GetSectionBase().Y);
-			UVs.Add(UV);
-		}
+			Data.UVs[VertIndex] = FVector2f(VertX * ScaleFactor + SectionBase.X, VertY * ScaleFactor + SectionBase.Y);
 
-		const int32 VisThreshold = 170;
+			if (CompVisData.Num() > 0)
+			{
+				VertexVisibility[VertIndex] = CompVisData[CDI.VertexIndexToTexel(VertIndex)];
+			}
+		}
 
+		Data.Indices.Reset();
 		for (int32 Y = 0; Y < ComponentSizeQuads; Y++)
 		{
 			for (int32 X = 0; X < ComponentSizeQuads; X++)
 			{
-				if (VisibilityData[BaseVertIndex + Y * (ComponentSizeQuads + 1) + X] < VisThreshold)
+				if (VertexVisibility[Y * (ComponentSizeQuads + 1) + X] < AlterMeshLandscape::VisThreshold)
 				{
-					Indices.Add(BaseVertIndex + (X + 0) + (Y + 0)*(ComponentSizeQuads + 1));
-					Indices.Add(BaseVertIndex + (X + 1) + (Y + 1)*(ComponentSizeQuads + 1));
-					Indices.Add(BaseVertIndex + (X + 1) + (Y + 0)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 0) + (Y + 0)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 1) + (Y + 1)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 1) + (Y + 0)*(ComponentSizeQuads + 1));
 
-					Indices.Add(BaseVertIndex + (X + 0) + (Y + 0)*(ComponentSizeQuads + 1));
-					Indices.Add(BaseVertIndex + (X + 0) + (Y + 1)*(ComponentSizeQuads + 1));
-					Indices.Add(BaseVertIndex + (X + 1) + (Y + 1)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 0) + (Y + 0)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 0) + (Y + 1)*(ComponentSizeQuads + 1));
+					Data.Indices.Add((X + 1) + (Y + 1)*(ComponentSizeQuads + 1));
 				}
 			}
 		}
+	});
+
+	// Unlocks the textures
+	DataInterfaces.Empty();
+
+	// Concatenate components, each one starts at a fixed vertex offset and a prefix sum of index counts
+	TArray<int32> BaseIndices;
+	BaseIndices.SetNumUninitialized(Components.Num());
+	int32 NumIndices = 0;
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ComponentIndex++)
+	{
+		BaseIndices[ComponentIndex] = NumIndices;
+		NumIndices += ComponentData[ComponentIndex]->Indices.Num();
 	}
+
+	const int32 VertexCount = Components.Num() * VertexCountPerComponent;
+
+	TArray<uint32> Indices;
+	TArray<FVector3f> Vertices;
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+	Indices.SetNumUninitialized(NumIndices);
+	Vertices.SetNumUninitialized(VertexCount);
+	Normals.SetNumUninitialized(VertexCount);
+	UVs.SetNumUninitialized(VertexCount);
+
+	ParallelFor(Components.Num(), [&](const int32 ComponentIndex)
+	{
+		const FAlterMeshLandscapeComponentData& Data = *ComponentData[ComponentIndex];
+		const int32 BaseVertIndex = ComponentIndex * VertexCountPerComponent;
+
+		FMemory::Memcpy(Vertices.GetData() + BaseVertIndex, Data.Vertices.GetData(), VertexCountPerComponent * sizeof(FVector3f));
+		FMemory::Memcpy(Normals.GetData() + BaseVertIndex, Data.Normals.GetData(), VertexCountPerComponent * sizeof(FVector3f));
+		FMemory::Memcpy(UVs.GetData() + BaseVertIndex, Data.UVs.GetData(), VertexCountPerComponent * sizeof(FVector2f));
+
+		uint32* ComponentIndices = Indices.GetData() + BaseIndices[ComponentIndex];
+		for (int32 Index = 0; Index < Data.Indices.Num(); Index++)
+		{
+			ComponentIndices[Index] = BaseVertIndex + Data.Indices[Index];
+		}
+	});
 	
 	TArray<int32> MaterialIndices;
 	MaterialIndices.AddZeroed(Indices.Num() / 3);	
@@ -161,14 +265,39 @@ void UAlterMeshGeometryLandscape::Export(FAlterMeshExport& Exporter)
 
 bool UAlterMeshGeometryLandscape::ShouldExport()
 {
-	ALandscape* Landscape = nullptr;
-	for (AActor* Actor : FActorRange(GetWorld()))
+	return !!FindLandscape();
+}
+
+void UAlterMeshGeometryLandscape::Cleanup()
+{
+	Super::Cleanup();
+
+	CachedLandscape.Reset();
+	ComponentCache.Empty();
+}
+
+ALandscape* UAlterMeshGeometryLandscape::FindLandscape()
+{
+	UWorld* World = GetWorld();
+	if (ALandscape* Landscape = CachedLandscape.Get())
+	{
+		if (Landscape->GetWorld() == World)
+		{
+			return Landscape;
+		}
+	}
+
+	CachedLandscape.Reset();
+	ComponentCache.Empty();
+
+	if (World)
 	{
-		if (Cast<ALandscape>(Actor))
+		// Last one found, same as scanning every actor
+		for (TActorIterator<ALandscape> It(World); It; ++It)
 		{
-			Landscape = Cast<ALandscape>(Actor);
+			CachedLandscape = *It;
 		}
 	}
 
-	return !!Landscape;
+	return CachedLandscape.Get();
 }
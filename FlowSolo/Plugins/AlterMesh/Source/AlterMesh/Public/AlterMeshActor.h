@@ -187,6 +187,10 @@ private:
 	
 	void OnComponentMaterialChanged(const UAlterMeshComponent* Component, int32 ElementIndex, UMaterialInterface* Material);	
 	void OnImport(TArray<TSharedPtr<FAlterMeshPrimitive>>);
+
+	// Takes a component with the same geometry out of OldComponents and updates its instances, returns false if there is none
+	bool ReuseComponent(const TSharedPtr<FAlterMeshPrimitive>& Mesh, bool bInstance, TArray<UAlterMeshComponent*>& OldComponents);
+	void AddOverrideMaterial(const struct FAlterMeshSection& Section);
 	void StartInstance();
 };
 
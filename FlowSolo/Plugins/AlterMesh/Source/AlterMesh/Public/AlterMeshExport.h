@@ -8,6 +8,7 @@
 #include <Extern/AlterMesh.h>
 
 #include "AlterMeshHandle.h"
+#include "Hash/xxhash.h"
 
 #pragma comment(lib, "AlterMesh.lib")
 
@@ -35,6 +36,19 @@ public:
 	void PreExport();
 	void Export();
 
+	// Hashes params exactly as Blender would receive them, streaming them without touching the shared memory or keeping a copy
+	// Returns key of the result, same key means Blender would produce the same meshes
+	uint64 Serialize();
+
+	// Copies params into a staging buffer, so Export can run outside of the game thread
+	// Without it, Export streams params straight into the shared memory
+	void Stage();
+
+	bool IsStaged() const { return bStaged; }
+
+	// Params can be serialized before a Blender process is assigned
+	void SetHandle(const TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe>& InAlterMeshHandle) { AlterMeshHandle = InAlterMeshHandle; }
+
 	// Helper
 	FMatrix44f ToBlenderMatrix = FTransform3f(FRotator3f(0,90,0), FVector3f::ZeroVector, FVector3f(-0.01,0.01,0.01)).ToMatrixWithScale();
 
@@ -42,14 +56,14 @@ public:
 	template<typename T>
 	void WriteArray(TArray<T>& InArray)
 	{
-		Write(AlterMeshHandle->Get(), reinterpret_cast<const char*>(InArray.GetData()), InArray.Num() * sizeof(T));
+		WriteEntry(InArray.GetData(), InArray.Num() * sizeof(T));
 	}
 
 	// Helper function to write a single value
 	template<typename T>
 	void WriteSingle(const T& InValue)
 	{
-		Write(AlterMeshHandle->Get(), reinterpret_cast<const char*>(&InValue), sizeof(T));
+		WriteEntry(&InValue, sizeof(T));
 	}
 
 	void InvertUVs(TArray<FVector2f>& OutUVs);
@@ -69,5 +83,25 @@ private:
 	TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> AlterMeshHandle = nullptr;
 
 	const TWeakObjectPtr<UAlterMeshAssetInterface> Asset;
-	
+
+	enum class EWriteTarget : uint8
+	{
+		None,
+		Hash,
+		Stage,
+		SharedMemory,
+	};
+
+	// Writes the json and every param to the current target
+	void WriteParams(EWriteTarget Target);
+
+	// Each write is a separate entry in the shared memory, keep the boundaries
+	void WriteEntry(const void* Data, int64 Size);
+
+	EWriteTarget WriteTarget = EWriteTarget::None;
+	FXxHash64Builder* Hasher = nullptr;
+
+	TArray64<uint8> StagedData;
+	TArray<int64> StagedEntryEnds;
+	bool bStaged = false;
 };
\ No newline at end of file
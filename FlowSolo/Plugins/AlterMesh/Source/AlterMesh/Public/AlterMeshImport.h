@@ -6,6 +6,7 @@
 #include "AlterMeshAsset.h"
 #include "Async/ParallelFor.h"
 
+#include <atomic>
 #include <Extern/AlterMesh.h>
 
 #include "AlterMeshHandle.h"
@@ -13,6 +14,18 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAlterMeshImport, Log, All);
 
+using FAlterMeshCancellationToken = TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe>;
+
+// Attributes which make a vertex unique, corners with identical values are welded
+using FAlterMeshUniqueVert = TTuple<FVector3f, FVector3f, FLinearColor, FVector2f, FVector2f, FVector2f, FVector2f>;
+
+// Scalar a block must be made of to be read as T, math types are read from blocks of their components
+template<typename T> struct TAlterMeshBlockElement { using Type = T; };
+template<typename T> struct TAlterMeshBlockElement<UE::Math::TVector2<T>> { using Type = T; };
+template<typename T> struct TAlterMeshBlockElement<UE::Math::TVector<T>> { using Type = T; };
+template<typename T> struct TAlterMeshBlockElement<UE::Math::TVector4<T>> { using Type = T; };
+template<typename T> struct TAlterMeshBlockElement<UE::Math::TMatrix<T>> { using Type = T; };
+
 enum class EAlterMeshAttributeIndexing : uint8
 {
 	Vertex,
@@ -30,6 +43,12 @@ public:
 	void ImportMeshes(TArray<TSharedPtr<FAlterMeshPrimitive>>& OutMeshes);
 	void ImportParams(TArray<FString>& OutObjects, TArray<FString>& OutObjectParams);
 
+	// Reads instance transforms and appends them to the sections of the meshes with matching hash
+	void ImportInstances(int32 NumInstances, TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes);
+
+	// Assigns materials of the asset by slot name, also used for meshes coming from FAlterMeshResultCache
+	void SetupMaterials(TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes) const;
+
 	template <typename T1, typename T2>
 	static void ContainerSwizzle(uint8 NumComponents, T1& FromContainer, uint8 FromBitmask, T2& ToContainer, uint8 ToBitmask);
 	
@@ -38,32 +57,105 @@ public:
 								TArrayView<int32> CornerToVertexIndex, TArrayView<int32> MaterialIndices, TArrayView<TCHAR> UsedMaterialsJson,
 								int64 Hash, TArray<TArrayView<FVector4f>> Attributes, TArray<EAlterMeshAttributeIndexing> AttributeIndexing);
 
+	// Maps every loop to the vertex of the first identical loop, OutUniqueLoops are the loops each vertex was created from
+	// Parallel path is deterministic and produces the same result as the serial one
+	static void WeldVertices(TConstArrayView<FAlterMeshUniqueVert> Verts, TConstArrayView<uint32> Hashes, TArray<int32>& OutVertexIndices, TArray<int32>& OutUniqueLoops, bool bParallel = true);
+
+	// Deterministic regardless of scheduling, uses MikkTSpace when bHighQualityTangents is set
 	void CalculateTangents(FAlterMeshSection& Section);
 
+	// Same tangents as static meshes built by unreal, single threaded per section
+	static void CalculateMikkTSpaceTangents(FAlterMeshSection& Section);
+
+	// @see AAlterMeshActor::bHighQualityTangents
+	bool bHighQualityTangents = false;
+
+	// Result is no longer needed, Blender output is still consumed but meshes aren't processed
+	FAlterMeshCancellationToken CancellationToken;
+	bool IsCancelled() const { return CancellationToken.IsValid() && *CancellationToken; }
+
 	inline static FMatrix44f ToUEMatrix = FTransform3f(FRotator3f(0,90,0), FVector3f::ZeroVector, FVector3f(-100,100,100)).ToMatrixWithScale();
 
+	// View into the shared memory, valid until the read lock is released
 	template<typename T>
 	TArrayView<T> ReadArray()
 	{
-		void* Address;
-		uint64 Length;
-		Read(AlterMeshHandle->Get(), &Address, &Length);
-		//check(Length % sizeof(T) == 0)
+		void* Address = nullptr;
+		size_t Length = 0;
+		uint32 Type = ALTERMESH_BLOCK_BYTES;
+		ReadBlock(AlterMeshHandle->Get(), &Address, &Length, &Type, nullptr);
+
+		if (!IsValidBlock<T>(Address, Length, Type))
+		{
+			return TArrayView<T>();
+		}
+
 		return TArrayView<T, int32>((T*)Address, Length/sizeof(T));
 	}
 
+	// Default value if the block isn't exactly one T
 	template<typename T>
 	T ReadValue()
 	{
-		void* Address;
-		uint64 Length;
-		Read(AlterMeshHandle->Get(), &Address, &Length);
-		//check(Length == sizeof(T))
+		void* Address = nullptr;
+		size_t Length = 0;
+		uint32 Type = ALTERMESH_BLOCK_BYTES;
+		ReadBlock(AlterMeshHandle->Get(), &Address, &Length, &Type, nullptr);
+
 		T Out{};
-		FPlatformMemory::Memcpy(&Out, Address, Length);
+		if (Length != sizeof(T) || !IsValidBlock<T>(Address, Length, Type))
+		{
+			UE_LOG(LogAlterMeshImport, Warning, TEXT("Unexpected block, type %u with %llu bytes"), Type, (uint64)Length);
+			return Out;
+		}
+
+		FPlatformMemory::Memcpy(&Out, Address, sizeof(T));
 		return Out;
 	}
 
+	// Typed blocks must be made of the same scalar as T, untyped blocks are only checked for size
+	template<typename T>
+	static bool IsValidBlock(const void* Address, size_t Length, uint32 Type)
+	{
+		return Address
+			&& Length % sizeof(T) == 0
+			&& IsAligned(Address, alignof(T))
+			&& IsValidBlockType<typename TAlterMeshBlockElement<T>::Type>(Type);
+	}
+
+	template<typename TElement>
+	static bool IsValidBlockType(uint32 Type)
+	{
+		const uint32 Kind = ALTERMESH_BLOCK_KIND(Type);
+		if (Kind == ALTERMESH_BLOCK_BYTES)
+		{
+			return true;
+		}
+
+		if (ALTERMESH_BLOCK_ELEMENT_SIZE(Type) != sizeof(TElement))
+		{
+			return false;
+		}
+
+		if constexpr (std::is_same_v<TElement, bool>)
+		{
+			return Kind == ALTERMESH_BLOCK_BOOL;
+		}
+		else if constexpr (std::is_floating_point_v<TElement>)
+		{
+			return Kind == ALTERMESH_BLOCK_FLOAT;
+		}
+		else if constexpr (std::is_integral_v<TElement>)
+		{
+			// Same bits either way, strings and hashes don't care about the sign
+			return Kind == ALTERMESH_BLOCK_INT || Kind == ALTERMESH_BLOCK_UINT;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
 private:
 
 	// Handle to the AlterMesh library
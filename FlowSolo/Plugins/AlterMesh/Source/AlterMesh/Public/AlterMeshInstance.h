@@ -8,17 +8,13 @@
 #include "AlterMeshHandle.h"
 #include "AlterMeshImport.h"
 #include "AlterMeshParam.h"
+#include "AlterMeshResultCache.h"
 #include "AlterMeshSection.h"
+#include "AlterMeshWorkerPool.h"
 #include "Tickable.h"
-#include "Misc/MonitoredProcess.h"
 #include "Async/Future.h"
 #include "Templates/SharedPointer.h"
 
-#if WITH_EDITOR
-#include "DirectoryWatcherModule.h"
-#include "IDirectoryWatcher.h"
-#endif
-
 #include "AlterMeshInstance.generated.h"
 
 class UAlterMeshAsset;
@@ -42,10 +38,35 @@ DECLARE_MULTICAST_DELEGATE(FOnRefreshDelegate);
 
 using TMeshPromise = TPromise<TArray<TSharedPtr<FAlterMeshPrimitive>>>;
 
+// State of a single async refresh, shared by its tasks
+struct FAlterMeshRefreshJob
+{
+	// Set when a newer refresh has been requested, results of this one are outdated
+	FAlterMeshCancellationToken Superseded = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+
+	// Parameters have been sent to Blender, its output has to be consumed even if superseded
+	bool bExported = false;
+
+	// Key of FAlterMeshResultCache, computed before leasing a worker
+	uint64 ResultKey = 0;
+	bool bHighQualityTangents = false;
+
+	// Found in FAlterMeshResultCache, Blender wasn't involved
+	bool bCacheHit = false;
+	TArray<TSharedPtr<FAlterMeshPrimitive>> CachedMeshes;
+
+	// Leased from FAlterMeshWorkerPool, released once the refresh finishes. Not set for dedicated instances
+	FAlterMeshWorkerPtr Worker;
+
+	bool IsSuperseded() const { return *Superseded; }
+};
+
+using FAlterMeshRefreshJobPtr = TSharedPtr<FAlterMeshRefreshJob, ESPMode::ThreadSafe>;
+
 struct FAlterMeshRefreshPreExportTask
 {
-	FAlterMeshRefreshPreExportTask(FAlterMeshExport Exporter)
-		: Exporter(Exporter)
+	FAlterMeshRefreshPreExportTask(FAlterMeshExport Exporter, FAlterMeshRefreshJobPtr Job)
+		: Exporter(Exporter), Job(Job)
 	{
 
 	}
@@ -56,16 +77,20 @@ struct FAlterMeshRefreshPreExportTask
 
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
-		Exporter.PreExport();
+		if (!Job->IsSuperseded())
+		{
+			Exporter.PreExport();
+		}
 	}
 
 	FAlterMeshExport Exporter;
+	FAlterMeshRefreshJobPtr Job;
 };
 
 struct FAlterMeshRefreshExportTask
 {
-	FAlterMeshRefreshExportTask(FAlterMeshExport Exporter)
-		: Exporter(Exporter)
+	FAlterMeshRefreshExportTask(FAlterMeshExport Exporter, FAlterMeshRefreshJobPtr Job)
+		: Exporter(Exporter), Job(Job)
 	{
 
 	}
@@ -76,18 +101,36 @@ struct FAlterMeshRefreshExportTask
 
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
-		Exporter.Export();
+		// Superseded before reaching Blender, skip the round-trip entirely
+		if (Job->IsSuperseded())
+		{
+			return;
+		}
+
+		// Checked again, the same result might have been added while waiting for a worker
+		if (Job->ResultKey != 0)
+		{
+			Job->bCacheHit = FAlterMeshResultCache::Get().Find(Job->ResultKey, Job->CachedMeshes);
+		}
+
+		if (!Job->bCacheHit)
+		{
+			Exporter.Export();
+			Job->bExported = true;
+		}
 	}
 
 	FAlterMeshExport Exporter;
+	FAlterMeshRefreshJobPtr Job;
 };
 
 struct FAlterMeshRefreshImportTask
 {
-	FAlterMeshRefreshImportTask(FAlterMeshImport Importer, TSharedPtr<TMeshPromise> Promise)
-		: Promise(Promise), Importer(Importer)
+	FAlterMeshRefreshImportTask(FAlterMeshImport Importer, TSharedPtr<TMeshPromise> Promise, FAlterMeshRefreshJobPtr Job)
+		: Promise(Promise), Importer(Importer), Job(Job)
 	{
-
+		this->Importer.CancellationToken = Job->Superseded;
+		this->Importer.bHighQualityTangents = Job->bHighQualityTangents;
 	}
 
 	FORCEINLINE TStatId GetStatId() const { return TStatId(); }
@@ -97,17 +140,32 @@ struct FAlterMeshRefreshImportTask
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
 		TArray<TSharedPtr<FAlterMeshPrimitive>> OutMeshes;
-		Importer.ImportMeshes(OutMeshes);
+		if (Job->bCacheHit)
+		{
+			OutMeshes = MoveTemp(Job->CachedMeshes);
+			Importer.SetupMaterials(OutMeshes);
+		}
+		else if (Job->bExported)
+		{
+			Importer.ImportMeshes(OutMeshes);
+
+			// Empty result means import failed or was cancelled
+			if (Job->ResultKey != 0 && OutMeshes.Num() && !Importer.IsCancelled())
+			{
+				FAlterMeshResultCache::Get().Add(Job->ResultKey, OutMeshes);
+			}
+		}
 		Promise->SetValue(OutMeshes);
 	}
 	
 	const TSharedPtr<TMeshPromise> Promise;
 	FAlterMeshImport Importer;
+	FAlterMeshRefreshJobPtr Job;
 };
 
 struct FAlterMeshRefreshCallbackTask
-{	FAlterMeshRefreshCallbackTask(FImportMeshCallback Callback, FOnRefreshDelegate OnRefreshDelegate, uint8& NumActions, const TSharedPtr<TMeshPromise> Promise)
-		: OnRefreshDelegate(OnRefreshDelegate), Callback(Callback), Promise(Promise), ActionCounterRef(NumActions)
+{	FAlterMeshRefreshCallbackTask(FImportMeshCallback Callback, FOnRefreshDelegate OnRefreshDelegate, TWeakObjectPtr<class UAlterMeshInstance> Instance, const TSharedPtr<TMeshPromise> Promise, FAlterMeshRefreshJobPtr Job)
+		: OnRefreshDelegate(OnRefreshDelegate), Callback(Callback), Promise(Promise), Instance(Instance), Job(Job)
 	{
 		
 	}
@@ -116,22 +174,19 @@ struct FAlterMeshRefreshCallbackTask
 	ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
 	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
 
-	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
-	{
-		Callback.ExecuteIfBound(Promise->GetFuture().Get());
-		OnRefreshDelegate.Broadcast();
-		ActionCounterRef--;
-	}
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent);
 	
 	FOnRefreshDelegate OnRefreshDelegate;
 	FImportMeshCallback Callback;
 	
 	const TSharedPtr<TMeshPromise> Promise;
 	
-	uint8& ActionCounterRef;
+	TWeakObjectPtr<class UAlterMeshInstance> Instance;
+	FAlterMeshRefreshJobPtr Job;
 };
 
-// A instance of blender
+// Frontend of blender for a single actor, runs the refreshes on workers leased from FAlterMeshWorkerPool
+// Factories use a dedicated worker instead, to run custom scripts
 UCLASS(BlueprintType, Blueprintable)
 class ALTERMESH_API UAlterMeshInstance : public UObject, public FTickableGameObject
 {
@@ -147,39 +202,58 @@ public:
 	virtual bool IsTickableWhenPaused() const override { return false; }
 	virtual bool IsTickableInEditor() const override { return true; }
 
-	// We will allow at most 2 refresh actions stacked, just yeet the rest
-	// for animations use a Sync action
-	uint8 NumRefreshActions;	
-	FGraphEventRef PreviousTask;
-
 	void RefreshSync(const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, TArray<TSharedPtr<FAlterMeshPrimitive>>& OutMeshes);
+
+	// At most one async refresh is in flight, requests received meanwhile are folded into a single pending one
+	// and the in-flight refresh is cancelled, so latest parameters win. For animations use a Sync action
 	void RefreshAsync(const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback);
 
+	// Called by FAlterMeshRefreshCallbackTask, starts the pending refresh
+	void OnRefreshFinished(const FAlterMeshRefreshJobPtr& Job);
+
 	void CleanupProcess();
 	bool IsValid();
-	void OnProcOutput(FString Output) const;
 
-	TSharedPtr<FMonitoredProcess> BlenderProcess;
-	
+	// Handle of the dedicated worker, shared instances get the handle of the leased worker for each refresh
 	TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> AlterMeshHandle;
 
 	float IdleTime;
 
 	FOnRefreshDelegate OnRefreshDelegate;
 
+	// Launches a dedicated blender process running ScriptPath, used by factories
 	bool Initialize(FString FilePath, FString ScriptPath);
 
+	// Refreshes will run on the workers of FAlterMeshWorkerPool
+	bool InitializeShared(const FString& FilePath);
+
 	EAlterMeshInstanceState State;
 private:
-	
-	FDelegateHandle DirectoryWatcherHandle;
-	FString CachedFileName;
 
-#if	WITH_EDITOR
-	void OnAssetChanged(const TArray<FFileChangeData>& FileChangeDatas);
-#endif
+	FAlterMeshWorkerPtr DedicatedWorker;
+
+	// Set for instances using FAlterMeshWorkerPool
+	FString SharedFilePath;
 	
 	FCriticalSection CriticalSection;
+
+	struct FPendingRefresh
+	{
+		TWeakObjectPtr<UAlterMeshAssetInterface> Asset;
+		FImportMeshCallback Callback;
+	};
+
+	FAlterMeshRefreshJobPtr InFlightRefresh;
+	TOptional<FPendingRefresh> PendingRefresh;
+
+	// Copies of the params, async refreshes outlive the caller's call and the caller might reallocate its params meanwhile
+	UPROPERTY(Transient)
+	FAlterMeshInputParams InFlightRefreshParams;
+
+	UPROPERTY(Transient)
+	FAlterMeshInputParams PendingRefreshParams;
 	
 	void EnqueueRefreshTasks(const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback, bool bAsync);
+	bool UsesHighQualityTangents() const;
+	void DispatchRefreshTasks(const TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe>& Handle, const FAlterMeshInputParams& InputParams, UAlterMeshAssetInterface* Asset, FImportMeshCallback Callback);
 };
@@ -0,0 +1,64 @@
+﻿// Copyright 2023 Aechmea
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AlterMeshSection.h"
+
+class UAlterMeshAsset;
+
+// Imported meshes keyed by FAlterMeshExport::Serialize, so refreshes with the same inputs skip Blender entirely
+// e.g. undo/redo, sequencer scrubbing or duplicated actors
+// Kept in memory up to UAlterMeshSettings::MaxResultCacheMemory and persisted in Saved/AlterMesh/ResultCache up to MaxResultCacheDiskSize
+class ALTERMESH_API FAlterMeshResultCache
+{
+public:
+	static FAlterMeshResultCache& Get();
+	static void Shutdown();
+
+	static bool IsEnabled();
+
+	// Returns copies of the cached meshes, materials have to be assigned by the caller
+	bool Find(uint64 Key, TArray<TSharedPtr<FAlterMeshPrimitive>>& OutMeshes);
+
+	// Stores copies of the meshes, callers are free to move out of them afterwards
+	void Add(uint64 Key, const TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes);
+
+	void Clear();
+
+	// Identifies the .blend file and the import settings of the asset
+	static uint64 GetAssetKey(const UAlterMeshAsset* Asset);
+
+	// Combines the key of FAlterMeshExport::Serialize with the import options of FAlterMeshImport
+	static uint64 GetResultKey(uint64 ExportKey, bool bHighQualityTangents);
+
+private:
+	struct FEntry
+	{
+		TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes;
+		int64 Size = 0;
+		uint64 LastAccess = 0;
+	};
+
+	void AddToMemory(uint64 Key, TArray<TSharedPtr<FAlterMeshPrimitive>>&& Meshes);
+	void Trim();
+
+	static TSharedPtr<FAlterMeshPrimitive> CopyMesh(FAlterMeshPrimitive& Mesh);
+	static int64 GetAllocatedSize(const FAlterMeshPrimitive& Mesh);
+
+	static FString GetCacheDirectory();
+	static FString GetCacheFilename(uint64 Key);
+
+	// Deletes least recently used files until the directory fits in the budget, files are touched on hit
+	static void TrimDisk(int64 MaxSize);
+
+	static void SerializeMeshes(FArchive& Ar, TArray<TSharedPtr<FAlterMeshPrimitive>>& Meshes);
+
+	FCriticalSection CriticalSection;
+
+	TMap<uint64, FEntry> Entries;
+	int64 TotalSize = 0;
+	uint64 AccessCounter = 0;
+
+	static TUniquePtr<FAlterMeshResultCache> Instance;
+};
@@ -28,11 +28,35 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "AlterMesh")
 	bool bCustomStyle = true;
 
-	// Each AlterMeshActor will spawn a background process
-	// and will be automatically closed if stays idle
+	// AlterMeshActors share background processes per .blend file,
+	// which will be automatically closed if they stay idle
 	UPROPERTY(EditAnywhere, config, Category = "AlterMesh")
 	float MaxIdleTime = 15.f;
 
+	// Max amount of background processes per .blend file, actors refreshing at the same time
+	// beyond this amount will wait for a process to finish
+	UPROPERTY(EditAnywhere, config, Category = "AlterMesh", meta = (ClampMin = 1))
+	int32 MaxWorkersPerFile = 4;
+
+	// Reuses imported meshes when an actor is refreshed with inputs that were already evaluated
+	// e.g. undo/redo, sequencer scrubbing or duplicated actors
+	UPROPERTY(EditAnywhere, config, Category = "AlterMesh|Cache")
+	bool bCacheResults = true;
+
+	// Max amount of memory used by cached meshes, least recently used are discarded first
+	// Value in MiB
+	UPROPERTY(EditAnywhere, config, Category = "AlterMesh|Cache", meta = (EditCondition = "bCacheResults", ClampMin = 0))
+	float MaxResultCacheMemory = 512.f;
+
+	// Also stores cached meshes in Saved/AlterMesh/ResultCache, so they survive editor restarts
+	UPROPERTY(EditAnywhere, config, Category = "AlterMesh|Cache", meta = (EditCondition = "bCacheResults"))
+	bool bPersistResultCache = true;
+
+	// Max size of Saved/AlterMesh/ResultCache, least recently used files are deleted first
+	// Value in MiB
+	UPROPERTY(EditAnywhere, config, Category = "AlterMesh|Cache", meta = (EditCondition = "bCacheResults && bPersistResultCache", ClampMin = 0))
+	float MaxResultCacheDiskSize = 2048.f;
+
 	// Max amount of memory allowed to be allocated by ALL processes
 	// if this amount is reached, older processes will need to finish before new ones spawn/
 	// if value is too low, some meshes may not be able to be imported
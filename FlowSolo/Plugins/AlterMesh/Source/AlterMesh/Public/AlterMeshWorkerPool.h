@@ -0,0 +1,98 @@
+﻿// Copyright 2023 Aechmea
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AlterMeshHandle.h"
+#include "Containers/Ticker.h"
+#include "Misc/MonitoredProcess.h"
+
+#if WITH_EDITOR
+#include "IDirectoryWatcher.h"
+#endif
+
+// A blender process with the .blend file already loaded
+struct ALTERMESH_API FAlterMeshWorker
+{
+	~FAlterMeshWorker();
+
+	bool Launch(const FString& InFilePath, const FString& ScriptPath);
+	bool IsRunning() const;
+
+	static void OnProcOutput(FString Output);
+
+	FString FilePath;
+
+	TSharedPtr<FMonitoredProcess> BlenderProcess;
+	
+	TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> AlterMeshHandle;
+
+	bool bLeased = false;
+
+	// File changed while leased, worker will be closed once released
+	bool bStale = false;
+
+	float IdleTime = 0.f;
+};
+
+using FAlterMeshWorkerPtr = TSharedPtr<FAlterMeshWorker, ESPMode::ThreadSafe>;
+
+DECLARE_DELEGATE_OneParam(FOnAlterMeshWorkerLeased, FAlterMeshWorkerPtr);
+
+// Warm blender workers shared by all instances, keyed by .blend file
+// Instances lease a worker for each refresh, so startup time and memory don't grow with the amount of actors
+// and refreshes of different actors run in parallel, up to UAlterMeshSettings::MaxWorkersPerFile
+class ALTERMESH_API FAlterMeshWorkerPool
+{
+public:
+	static FAlterMeshWorkerPool& Get();
+	static void Shutdown();
+	static bool IsAvailable() { return Instance.IsValid(); }
+
+	~FAlterMeshWorkerPool();
+
+	// Returns idle worker, or launches a new one if below the limit
+	// Overflow ignores the limit, sync refreshes can't wait for async ones to finish
+	FAlterMeshWorkerPtr TryLease(const FString& FilePath, bool bAllowOverflow = false);
+
+	// Calls OnLeased once a worker becomes available, immediately if possible
+	// Returns false if no worker can be launched for this file
+	// Waiting callbacks get a null worker if launching fails and no running worker is left to be released
+	bool Lease(const FString& FilePath, FOnAlterMeshWorkerLeased OnLeased);
+
+	void Release(const FAlterMeshWorkerPtr& Worker);
+
+	// Closes idle workers of the file, leased ones are closed once released
+	void CloseWorkers(const FString& FilePath);
+
+	static FString GetScriptPath();
+
+private:
+	FAlterMeshWorkerPool();
+
+	bool Tick(float DeltaTime);
+	void ServeWaiting(const FString& FilePath);
+
+#if WITH_EDITOR
+	void WatchDirectory(const FString& FilePath);
+	void OnDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+#endif
+
+	struct FFileWorkers
+	{
+		TArray<FAlterMeshWorkerPtr> Workers;
+		TArray<FOnAlterMeshWorkerLeased> Waiting;
+
+		// Last launch failed, no worker is launched for the file before this time
+		double NextLaunchTime = 0.0;
+	};
+
+	TMap<FString, FFileWorkers> Files;
+
+	// Directory watcher handles, one per directory
+	TMap<FString, FDelegateHandle> WatchedDirectories;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	static TUniquePtr<FAlterMeshWorkerPool> Instance;
+};
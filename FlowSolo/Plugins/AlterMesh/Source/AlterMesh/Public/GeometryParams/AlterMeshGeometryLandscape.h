@@ -6,6 +6,23 @@
 #include "GeometryParams/AlterMeshGeometryBase.h"
 #include "AlterMeshGeometryLandscape.generated.h"
 
+class ALandscape;
+class ULandscapeComponent;
+
+// Geometry extracted from a single landscape component, already in blender space
+struct FAlterMeshLandscapeComponentData
+{
+	// Hash of everything the extracted data depends on, heightmap and visibility source ids, transform and LOD
+	uint64 Key = 0;
+
+	TArray<FVector3f> Vertices;
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+
+	// Relative to the first vertex of this component
+	TArray<uint32> Indices;
+};
+
 // Landscape geometry interface
 UCLASS(BlueprintType, Blueprintable, meta=(DisplayName="Geometry: Landscape"))
 class ALTERMESH_API UAlterMeshGeometryLandscape : public UAlterMeshGeometryBase
@@ -23,4 +40,16 @@ public:
 	virtual void Export(FAlterMeshExport& Exporter) override;
 
 	virtual bool ShouldExport() override;
+
+	virtual void Cleanup() override;
+
+private:
+
+	// Returns the cached landscape, only searches the world again if it was removed
+	ALandscape* FindLandscape();
+
+	TWeakObjectPtr<ALandscape> CachedLandscape;
+
+	// Components are only extracted again when their key changes
+	TMap<TWeakObjectPtr<ULandscapeComponent>, FAlterMeshLandscapeComponentData> ComponentCache;
 };
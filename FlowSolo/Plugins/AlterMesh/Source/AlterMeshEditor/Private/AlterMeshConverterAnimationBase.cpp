@@ -3,6 +3,14 @@
 #include "AlterMeshConverterAnimationBase.h"
 
 #include "AlterMeshActor.h"
+#include "AlterMeshExport.h"
+#include "AlterMeshImport.h"
+#include "AlterMeshInstance.h"
+#include "AlterMeshLibrary.h"
+#include "AlterMeshResultCache.h"
+#include "AlterMeshSettings.h"
+#include "AlterMeshWorkerPool.h"
+#include "Async/TaskGraphInterfaces.h"
 
 UAlterMeshConverterAnimationBase::UAlterMeshConverterAnimationBase()
 {
@@ -11,6 +19,185 @@ UAlterMeshConverterAnimationBase::UAlterMeshConverterAnimationBase()
 }
 
 bool UAlterMeshConverterAnimationBase::ProcessFrames(TFunctionRef<bool(TArray<TSharedPtr<FAlterMeshPrimitive>>, int32)> InFunc)
+{
+	AAlterMeshActor* OwnerActor = GetTypedOuter<AAlterMeshActor>();
+	if (!OwnerActor || !OwnerActor->Asset || !OwnerActor->Asset->Get())
+	{
+		return true;
+	}
+
+	if (!bParallelFrames)
+	{
+		return ProcessFramesSerial(InFunc);
+	}
+
+	const int32 NumFrames = LastFrame - InitialFrame + 1;
+	const FString FilePath = UAlterMeshLibrary::ConvertFilenameToFull(OwnerActor->Asset->Get()->Filename.FilePath);
+	const int32 MaxWorkers = FMath::Clamp(GetDefault<UAlterMeshSettings>()->MaxWorkersPerFile, 1, FMath::Max(NumFrames, 1));
+
+	// Each worker evaluates its own range of frames in order, while the previous frames are imported and written out
+	TArray<FAlterMeshWorkerPtr> Workers;
+	for (int32 WorkerIndex = 0; WorkerIndex < MaxWorkers; WorkerIndex++)
+	{
+		FAlterMeshWorkerPtr Worker = FAlterMeshWorkerPool::Get().TryLease(FilePath, Workers.Num() == 0);
+		if (!Worker.IsValid())
+		{
+			break;
+		}
+
+		Workers.Add(Worker);
+	}
+
+	if (Workers.Num() == 0)
+	{
+		return ProcessFramesSerial(InFunc);
+	}
+
+	const bool bHighQualityTangents = OwnerActor->bHighQualityTangents;
+	UAlterMeshAssetInterface* Asset = OwnerActor->Asset;
+
+	TArray<TFuture<TArray<TSharedPtr<FAlterMeshPrimitive>>>> FrameResults;
+	FrameResults.Reserve(NumFrames);
+	TArray<FGraphEventRef> ExportTasks;
+	TArray<FGraphEventRef> ImportTasks;
+	ExportTasks.SetNum(Workers.Num());
+	ImportTasks.SetNum(Workers.Num());
+
+	// Frames are split in blocks, each worker gets a contiguous range of every block
+	const int32 RangeSize = FMath::Max(FramesPerWorker, 1);
+	const int32 BlockSize = RangeSize * Workers.Num();
+	auto GetWorkerIndex = [RangeSize, BlockSize](const int32 FrameIndex)
+	{
+		return (FrameIndex % BlockSize) / RangeSize;
+	};
+
+	// Params are serialized on the game thread, the tasks only copy the staged data into the shared memory
+	auto Evaluate = [&](const int32 WorkerIndex, FAlterMeshExport&& Exporter, TSharedPtr<TMeshPromise> Promise, const uint64 ResultKey)
+	{
+		const TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> Handle = Workers[WorkerIndex]->AlterMeshHandle;
+		Exporter.SetHandle(Handle);
+		Exporter.Stage();
+
+		FAlterMeshImport Importer(Handle, Asset);
+		Importer.bHighQualityTangents = bHighQualityTangents;
+
+		// Shared memory is a ring, next frame's params can be written while Blender's output of this one is still being imported
+		FGraphEventArray ExportPrerequisites;
+		if (ExportTasks[WorkerIndex].IsValid())
+		{
+			ExportPrerequisites.Add(ExportTasks[WorkerIndex]);
+		}
+
+		ExportTasks[WorkerIndex] = FFunctionGraphTask::CreateAndDispatchWhenReady([Exporter = MoveTemp(Exporter)]() mutable
+		{
+			Exporter.Export();
+		}, TStatId(), &ExportPrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+
+		FGraphEventArray ImportPrerequisites;
+		ImportPrerequisites.Add(ExportTasks[WorkerIndex]);
+		if (ImportTasks[WorkerIndex].IsValid())
+		{
+			ImportPrerequisites.Add(ImportTasks[WorkerIndex]);
+		}
+
+		ImportTasks[WorkerIndex] = FFunctionGraphTask::CreateAndDispatchWhenReady([Importer, Promise, ResultKey]() mutable
+		{
+			TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes;
+			Importer.ImportMeshes(Meshes);
+
+			// Warm-up frames only advance Blender's state
+			if (!Promise.IsValid())
+			{
+				return;
+			}
+
+			if (ResultKey != 0 && Meshes.Num())
+			{
+				FAlterMeshResultCache::Get().Add(ResultKey, Meshes);
+			}
+
+			Promise->SetValue(MoveTemp(Meshes));
+		}, TStatId(), &ImportPrerequisites, ENamedThreads::AnyBackgroundThreadNormalTask);
+	};
+
+	auto ScheduleFrame = [&](const int32 FrameIndex)
+	{
+		const int32 WorkerIndex = GetWorkerIndex(FrameIndex);
+
+		// The worker didn't evaluate the previous frame, replay the ones before its range first
+		if (FrameIndex > 0 && GetWorkerIndex(FrameIndex - 1) != WorkerIndex)
+		{
+			for (int32 WarmupIndex = FMath::Max(FrameIndex - WarmupFrames, 0); WarmupIndex < FrameIndex; WarmupIndex++)
+			{
+				OwnerActor->InputParams.Frame = InitialFrame + WarmupIndex;
+
+				FAlterMeshExport WarmupExporter(nullptr, OwnerActor->InputParams, Asset, OwnerActor);
+				WarmupExporter.PreExport();
+				Evaluate(WorkerIndex, MoveTemp(WarmupExporter), nullptr, 0);
+			}
+		}
+
+		OwnerActor->InputParams.Frame = InitialFrame + FrameIndex;
+
+		FAlterMeshExport Exporter(nullptr, OwnerActor->InputParams, Asset, OwnerActor);
+		Exporter.PreExport();
+
+		const uint64 ResultKey = FAlterMeshResultCache::IsEnabled() ? FAlterMeshResultCache::GetResultKey(Exporter.Serialize(), bHighQualityTangents) : 0;
+
+		TSharedPtr<TMeshPromise> Promise = MakeShared<TMeshPromise>();
+		FrameResults.Add(Promise->GetFuture());
+
+		TArray<TSharedPtr<FAlterMeshPrimitive>> CachedMeshes;
+		if (ResultKey != 0 && FAlterMeshResultCache::Get().Find(ResultKey, CachedMeshes))
+		{
+			FAlterMeshImport(nullptr, Asset).SetupMaterials(CachedMeshes);
+			Promise->SetValue(MoveTemp(CachedMeshes));
+			return;
+		}
+
+		Evaluate(WorkerIndex, MoveTemp(Exporter), Promise, ResultKey);
+	};
+
+	// Bounds the amount of staged params and imported frames waiting to be consumed,
+	// a block ahead keeps every worker on its range while the first ones are consumed
+	const int32 MaxFramesInFlight = BlockSize + RangeSize;
+	int32 NumScheduled = 0;
+	bool bResult = true;
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+	{
+		while (NumScheduled < NumFrames && NumScheduled < FrameIndex + MaxFramesInFlight)
+		{
+			ScheduleFrame(NumScheduled++);
+		}
+
+		// Consumed in order, so the output is the same as baking frames one by one
+		if (!InFunc(FrameResults[FrameIndex].Get(), FrameIndex))
+		{
+			bResult = false;
+			break;
+		}
+	}
+
+	// Workers can't be reused until Blender's output has been consumed
+	for (const FGraphEventRef& ImportTask : ImportTasks)
+	{
+		if (ImportTask.IsValid())
+		{
+			ImportTask->Wait();
+		}
+	}
+
+	for (const FAlterMeshWorkerPtr& Worker : Workers)
+	{
+		FAlterMeshWorkerPool::Get().Release(Worker);
+	}
+
+	OwnerActor->InputParams.Frame = LastFrame;
+	return bResult;
+}
+
+bool UAlterMeshConverterAnimationBase::ProcessFramesSerial(TFunctionRef<bool(TArray<TSharedPtr<FAlterMeshPrimitive>>, int32)> InFunc)
 {
  	if (AAlterMeshActor* OwnerActor = GetTypedOuter<AAlterMeshActor>())
 	{
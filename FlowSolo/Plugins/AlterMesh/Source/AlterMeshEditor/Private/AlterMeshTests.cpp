@@ -2,7 +2,10 @@
 
 #include "AlterMeshAsset.h"
 #include "AlterMeshComponent.h"
+#include "AlterMeshConverterVertexAnimation.h"
+#include "AlterMeshImport.h"
 #include "AlterMeshInstance.h"
+#include "Async/Async.h"
 #include "AlterMeshLibrary.h"
 #include "AlterMeshSettings.h"
 #include "AlterMeshTransformComponent.h"
@@ -236,6 +239,204 @@ bool FAlterMeshImportMeshWeldVerts::RunTest(const FString& Parameters)
 }
 
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlterMeshImportMeshParallelWeld, "AlterMesh.ImportMesh.ParallelWeld", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlterMeshImportMeshParallelWeld::RunTest(const FString& Parameters)
+{
+	// Big enough to go through the sharded path, small pool of values so most loops are welded
+	constexpr int32 NumLoops = 300000;
+	FRandomStream RandomStream(1234);
+
+	TArray<FAlterMeshUniqueVert> Verts;
+	TArray<uint32> Hashes;
+	Verts.SetNum(NumLoops);
+	Hashes.SetNum(NumLoops);
+
+	for (int32 LoopIndex = 0; LoopIndex < NumLoops; LoopIndex++)
+	{
+		const FVector3f Position(RandomStream.RandRange(0, 200), RandomStream.RandRange(0, 200), 0.f);
+		const FVector2f UV(RandomStream.RandRange(0, 1), 0.f);
+		Verts[LoopIndex] = FAlterMeshUniqueVert(Position, FVector3f::UpVector, FLinearColor::Black, UV, FVector2f::ZeroVector, FVector2f::ZeroVector, FVector2f::ZeroVector);
+		Hashes[LoopIndex] = GetTypeHash(Verts[LoopIndex]);
+	}
+
+	TArray<int32> SerialVertexIndices;
+	TArray<int32> SerialUniqueLoops;
+	FAlterMeshImport::WeldVertices(Verts, Hashes, SerialVertexIndices, SerialUniqueLoops, false);
+
+	TArray<int32> ParallelVertexIndices;
+	TArray<int32> ParallelUniqueLoops;
+	FAlterMeshImport::WeldVertices(Verts, Hashes, ParallelVertexIndices, ParallelUniqueLoops, true);
+
+	TestTrue(TEXT("Loops were welded"), SerialUniqueLoops.Num() < NumLoops);
+	TestEqual(TEXT("Unique loops Num"), ParallelUniqueLoops.Num(), SerialUniqueLoops.Num());
+	TestTrue(TEXT("Unique loops match"), ParallelUniqueLoops == SerialUniqueLoops);
+	TestTrue(TEXT("Vertex indices match"), ParallelVertexIndices == SerialVertexIndices);
+
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_ALTERMESH_IMPORT_MESH_TEST(FAlterMeshProcessFramesParallel, "AlterMesh.ImportMesh.ProcessFramesParallel")
+
+bool FAlterMeshProcessFramesParallel::RunTest(const FString& Parameters)
+{
+	ImportMeshFromUnitTestAsset(0);
+
+	// Both paths have to go through Blender
+	UAlterMeshSettings* Settings = GetMutableDefault<UAlterMeshSettings>();
+	const bool bCacheResults = Settings->bCacheResults;
+	Settings->bCacheResults = false;
+
+	// Small ranges so frames are split across workers and blocks, with a warm-up before each range
+	UAlterMeshConverterVertexAnimation* Converter = NewObject<UAlterMeshConverterVertexAnimation>(CreatedActor.Get());
+	Converter->InitialFrame = 1;
+	Converter->LastFrame = 12;
+	Converter->FramesPerWorker = 2;
+
+	TArray<TArray<TSharedPtr<FAlterMeshPrimitive>>> ParallelFrames;
+	Converter->ProcessFrames([&ParallelFrames](TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes, int32 Frame)
+	{
+		ParallelFrames.Add(MoveTemp(Meshes));
+		return true;
+	});
+
+	TArray<TArray<TSharedPtr<FAlterMeshPrimitive>>> SerialFrames;
+	Converter->ProcessFramesSerial([&SerialFrames](TArray<TSharedPtr<FAlterMeshPrimitive>> Meshes, int32 Frame)
+	{
+		SerialFrames.Add(MoveTemp(Meshes));
+		return true;
+	});
+
+	Settings->bCacheResults = bCacheResults;
+
+	TestEqual(TEXT("Frames Num"), ParallelFrames.Num(), SerialFrames.Num());
+	for (int32 Frame = 0; Frame < FMath::Min(ParallelFrames.Num(), SerialFrames.Num()); Frame++)
+	{
+		TestEqual(FString::Printf(TEXT("Frame%d MeshNum"), Frame), ParallelFrames[Frame].Num(), SerialFrames[Frame].Num());
+		for (int32 MeshIndex = 0; MeshIndex < FMath::Min(ParallelFrames[Frame].Num(), SerialFrames[Frame].Num()); MeshIndex++)
+		{
+			const TArray<FAlterMeshSection>& ParallelSections = ParallelFrames[Frame][MeshIndex]->Sections;
+			const TArray<FAlterMeshSection>& SerialSections = SerialFrames[Frame][MeshIndex]->Sections;
+
+			TestEqual(FString::Printf(TEXT("Frame%d Mesh%d SectionNum"), Frame, MeshIndex), ParallelSections.Num(), SerialSections.Num());
+			for (int32 SectionIndex = 0; SectionIndex < FMath::Min(ParallelSections.Num(), SerialSections.Num()); SectionIndex++)
+			{
+				TestTrue(FString::Printf(TEXT("Frame%d Mesh%d Section%d geometry"), Frame, MeshIndex, SectionIndex), ParallelSections[SectionIndex].HasSameGeometry(SerialSections[SectionIndex]));
+			}
+		}
+	}
+
+	CleanUpWorld();
+	return !HasAnyErrors();
+}
+
+// Stands in for Blender on the other side of the shared memory, no process is launched
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlterMeshTransportRing, "AlterMesh.Transport.Ring", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlterMeshTransportRing::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 8;
+	constexpr int32 NumVertices = 1000;
+	constexpr uint32 FloatBlock = ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_FLOAT, sizeof(float));
+
+	const FString Guid = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
+	const FString Guid2 = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces);
+
+	TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> Handle = MakeShared<FAlterMeshHandle, ESPMode::ThreadSafe>();
+	Handle->Set(Init(*Guid, *Guid2));
+
+	// Directions are swapped on the producer side, same as the GUIDs passed to Blender
+	TSharedPtr<FAlterMeshHandle, ESPMode::ThreadSafe> ProducerHandle = MakeShared<FAlterMeshHandle, ESPMode::ThreadSafe>();
+	ProducerHandle->Set(Init(*Guid2, *Guid));
+
+	TestEqual(TEXT("Protocol version"), GetProtocolVersion(Handle->Get()), (uint32)ALTERMESH_PROTOCOL_VERSION);
+	TestEqual(TEXT("Producer protocol version"), GetProtocolVersion(ProducerHandle->Get()), (uint32)ALTERMESH_PROTOCOL_VERSION);
+
+	std::atomic<int32> NumWrittenFrames = 0;
+	TFuture<void> Producer = Async(EAsyncExecution::Thread, [ProducerHandle, &NumWrittenFrames]()
+	{
+		TArray<FVector3f> Vertices;
+		Vertices.SetNum(NumVertices);
+
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+			{
+				Vertices[VertexIndex] = FVector3f((float)Frame, (float)VertexIndex, (float)(Frame * VertexIndex));
+			}
+
+			if (WriteLock(ProducerHandle->Get()))
+			{
+				// Odd size, next block must still be aligned
+				const uint8 Padding[3] = {};
+				WriteBlock(ProducerHandle->Get(), ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_UINT, 1), 1, (const char*)Padding, sizeof(Padding));
+				WriteBlock(ProducerHandle->Get(), ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_INT, sizeof(int32)), 1, (const char*)&Frame, sizeof(Frame));
+
+				// Strings are written by Blender as UTF-16 uint16 blocks
+				const FString Name = FString::Printf(TEXT("Frame %d"), Frame);
+				WriteBlock(ProducerHandle->Get(), ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_UINT, sizeof(TCHAR)), 1, (const char*)*Name, Name.Len() * sizeof(TCHAR));
+				WriteBlock(ProducerHandle->Get(), FloatBlock, 3, (const char*)Vertices.GetData(), Vertices.Num() * sizeof(FVector3f));
+				WriteUnlock(ProducerHandle->Get());
+				++NumWrittenFrames;
+			}
+		}
+	});
+
+	FAlterMeshImport Importer(Handle, nullptr);
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		if (!ReadLock(Handle->Get()))
+		{
+			AddError(TEXT("Read lock failed"));
+			break;
+		}
+
+		// Next frame goes to the other slot while this one is being consumed
+		if (Frame == 0)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			while (NumWrittenFrames < 2 && FPlatformTime::Seconds() - StartTime < 5.0)
+			{
+				FPlatformProcess::Sleep(0.001f);
+			}
+
+			TestTrue(TEXT("Next frame written while the previous one is read"), NumWrittenFrames >= 2);
+		}
+
+		Importer.ReadArray<uint8>();
+		TestEqual(TEXT("Frame"), Importer.ReadValue<int32>(), Frame);
+
+		const TArrayView<TCHAR> Name = Importer.ReadArray<TCHAR>();
+		TestEqual(TEXT("Name"), FString(Name.Num(), Name.GetData()), FString::Printf(TEXT("Frame %d"), Frame));
+
+		void* Address = nullptr;
+		size_t Length = 0;
+		uint32 Type = 0;
+		uint32 Components = 0;
+		TestTrue(TEXT("Vertices block"), ReadBlock(Handle->Get(), &Address, &Length, &Type, &Components));
+		TestEqual(TEXT("Block type"), Type, FloatBlock);
+		TestEqual(TEXT("Block components"), Components, 3u);
+		TestTrue(TEXT("Block aligned"), IsAligned(Address, ALTERMESH_BLOCK_ALIGNMENT));
+		TestTrue(TEXT("Block valid as vectors"), FAlterMeshImport::IsValidBlock<FVector3f>(Address, Length, Type));
+		TestFalse(TEXT("Block invalid as halfs"), FAlterMeshImport::IsValidBlock<FFloat16>(Address, Length, Type));
+		TestFalse(TEXT("Block invalid as ints"), FAlterMeshImport::IsValidBlock<int32>(Address, Length, Type));
+		TestFalse(TEXT("Byte block invalid as string"), FAlterMeshImport::IsValidBlock<TCHAR>(Address, sizeof(TCHAR), ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_INT, 1)));
+		TestFalse(TEXT("Int block invalid as int64"), FAlterMeshImport::IsValidBlock<int64>(Address, sizeof(int64), ALTERMESH_BLOCK_TYPE(ALTERMESH_BLOCK_INT, sizeof(int32))));
+
+		const TArrayView<const FVector3f> Vertices((const FVector3f*)Address, Length / sizeof(FVector3f));
+		TestEqual(TEXT("Vertices Num"), Vertices.Num(), NumVertices);
+		TestEqual(TEXT("Last vertex"), Vertices.Last(), FVector3f((float)Frame, (float)(NumVertices - 1), (float)(Frame * (NumVertices - 1))));
+
+		TestFalse(TEXT("End of frame"), ReadBlock(Handle->Get(), &Address, &Length, nullptr, nullptr));
+		ReadUnlock(Handle->Get());
+	}
+
+	Producer.Wait();
+	TestEqual(TEXT("Written frames"), NumWrittenFrames.load(), NumFrames);
+
+	return !HasAnyErrors();
+}
+
 IMPLEMENT_ALTERMESH_IMPORT_MESH_TEST(FAlterMeshImportMeshSplitUVs, "AlterMesh.ImportMesh.SplitUVs")
 
 bool FAlterMeshImportMeshSplitUVs::RunTest(const FString& Parameters)
@@ -24,7 +24,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="")
 	int32 LastFrame = 60;
 
+	// Evaluates ranges of frames on several Blender workers at once, turn off for setups that need the whole frame history (simulation zones)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="")
+	bool bParallelFrames = true;
+
+	// Consecutive frames evaluated by the same worker, higher means less warm-up but more frames waiting to be consumed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="", meta=(ClampMin=1, EditCondition="bParallelFrames"))
+	int32 FramesPerWorker = 16;
+
+	// Frames evaluated and thrown away before a range, so setups depending on the previous frame see the same input as a serial bake
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="", meta=(ClampMin=0, EditCondition="bParallelFrames"))
+	int32 WarmupFrames = 1;
+
+	// Evaluates frames on several Blender workers at once, InFunc is still called in frame order on the game thread
 	virtual bool ProcessFrames(TFunctionRef<bool(TArray<TSharedPtr<FAlterMeshPrimitive>>, int32)> InFunc);
+
+	// One frame after another through the actor's instance, used if no worker could be leased
+	bool ProcessFramesSerial(TFunctionRef<bool(TArray<TSharedPtr<FAlterMeshPrimitive>>, int32)> InFunc);
 	
 	virtual void Convert(AAlterMeshActor* InActor) override;	
 	
@@ -143,11 +143,7 @@ public:
 
 			TSharedRef<FAlterMeshInstanceData, ESPMode:: ThreadSafe> InstanceBufferData = MakeShared<FAlterMeshInstanceData, ESPMode::ThreadSafe>();
 			InstanceBufferData->AllocateInstances(Section.Instances.Num(), EResizeBufferFlags::AllowSlackOnGrow | EResizeBufferFlags::AllowSlackOnReduce, false);
-
-			for (int32 i = 0; i < Section.Instances.Num(); i++)
-			{
-				InstanceBufferData->SetInstance(i, Section.Instances[i], 0);
-			}
+			InstanceBufferData->SetInstances(0, Section.Instances, 0);
 
 			NewSection->InstanceBuffer.InstanceData = InstanceBufferData;
 			Sections[SectionIndex] = NewSection;
@@ -207,6 +203,31 @@ public:
 		Sections.Empty();
 	}
 
+	// Ranges are pairs of first instance and number of instances, their transforms are packed one after another
+	void UpdateInstances_RenderThread(FRHICommandListImmediate& RHICmdList, int32 SectionIndex, const TArray<TPair<int32, int32>>& Ranges, const TArray<FMatrix44f>& Transforms)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex))
+		{
+			return;
+		}
+
+		FAlterMeshInstanceBuffer& InstanceBuffer = Sections[SectionIndex]->InstanceBuffer;
+
+		int32 TransformOffset = 0;
+		for (const TPair<int32, int32>& Range : Ranges)
+		{
+			const TConstArrayView<FMatrix44f> RangeTransforms(Transforms.GetData() + TransformOffset, Range.Value);
+#if REQUIRES_COMMANDLIST
+			InstanceBuffer.UpdateInstances(RHICmdList, Range.Key, RangeTransforms);
+#else
+			InstanceBuffer.UpdateInstances(Range.Key, RangeTransforms);
+#endif
+			TransformOffset += Range.Value;
+		}
+	}
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override
 	{
 		QUICK_SCOPE_CYCLE_COUNTER( STAT_AlterMeshSceneProxy_GetDynamicMeshElements );
@@ -364,6 +385,88 @@ FPrimitiveSceneProxy* UAlterMeshComponent::CreateSceneProxy()
 	return nullptr;
 }
 
+bool UAlterMeshComponent::HasSameGeometry(const FAlterMeshPrimitive& Mesh) const
+{
+	if (Sections.Num() != Mesh.Sections.Num())
+	{
+		return false;
+	}
+
+	for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
+	{
+		if (Sections[SectionIndex].Hash != Mesh.Sections[SectionIndex].Hash || !Sections[SectionIndex].HasSameGeometry(Mesh.Sections[SectionIndex]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UAlterMeshComponent::UpdateInstances(int32 SectionIndex, TArray<FMatrix44f>&& NewInstances)
+{
+	check(Sections.IsValidIndex(SectionIndex));
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UAlterMeshComponent_UpdateInstances);
+
+	FAlterMeshSection& Section = Sections[SectionIndex];
+	FAlterMeshSceneProxy* AlterMeshProxy = static_cast<FAlterMeshSceneProxy*>(SceneProxy);
+
+	// Buffers are sized for the current instances, anything else needs a new proxy
+	if (!AlterMeshProxy || NewInstances.Num() != Section.Instances.Num() || NewInstances.Num() == 0)
+	{
+		Section.Instances = MoveTemp(NewInstances);
+		MarkRenderStateDirty();
+		UpdateBounds();
+		return;
+	}
+
+	// Collect runs of changed instances, small gaps are uploaded too to keep the number of locks low
+	constexpr int32 MaxGap = 16;
+	TArray<TPair<int32, int32>> Ranges;
+	TArray<FMatrix44f> ChangedInstances;
+
+	int32 InstanceIndex = 0;
+	while (InstanceIndex < NewInstances.Num())
+	{
+		if (FMemory::Memcmp(&Section.Instances[InstanceIndex], &NewInstances[InstanceIndex], sizeof(FMatrix44f)) == 0)
+		{
+			InstanceIndex++;
+			continue;
+		}
+
+		const int32 FirstInstance = InstanceIndex;
+		int32 LastChanged = InstanceIndex;
+		for (InstanceIndex++; InstanceIndex < NewInstances.Num() && InstanceIndex - LastChanged <= MaxGap; InstanceIndex++)
+		{
+			if (FMemory::Memcmp(&Section.Instances[InstanceIndex], &NewInstances[InstanceIndex], sizeof(FMatrix44f)) != 0)
+			{
+				LastChanged = InstanceIndex;
+			}
+		}
+
+		const int32 NumInstances = LastChanged - FirstInstance + 1;
+		Ranges.Emplace(FirstInstance, NumInstances);
+		ChangedInstances.Append(NewInstances.GetData() + FirstInstance, NumInstances);
+		InstanceIndex = LastChanged + 1;
+	}
+
+	Section.Instances = MoveTemp(NewInstances);
+
+	if (Ranges.Num() == 0)
+	{
+		return;
+	}
+
+	ENQUEUE_RENDER_COMMAND(AlterMeshUpdateInstances)(
+	[AlterMeshProxy, SectionIndex, Ranges = MoveTemp(Ranges), ChangedInstances = MoveTemp(ChangedInstances)](FRHICommandListImmediate& RHICmdList)
+	{
+		AlterMeshProxy->UpdateInstances_RenderThread(RHICmdList, SectionIndex, Ranges, ChangedInstances);
+	});
+
+	UpdateBounds();
+	MarkRenderTransformDirty();
+}
+
 int32 UAlterMeshComponent::GetNumMaterials() const
 {
 	return Sections.Num();
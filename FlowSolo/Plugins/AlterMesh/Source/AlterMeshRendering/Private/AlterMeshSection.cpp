@@ -114,6 +114,22 @@ FAlterMeshSection FAlterMeshSection::Copy()
 	return *this;
 }
 
+bool FAlterMeshSection::HasSameGeometry(const FAlterMeshSection& Other) const
+{
+	return MaterialName == Other.MaterialName
+		&& Material == Other.Material
+		&& Vertices == Other.Vertices
+		&& Indices == Other.Indices
+		&& Normals == Other.Normals
+		&& Tangents == Other.Tangents
+		&& Bitangents == Other.Bitangents
+		&& UV0 == Other.UV0
+		&& UV1 == Other.UV1
+		&& UV2 == Other.UV2
+		&& UV3 == Other.UV3
+		&& Colors == Other.Colors;
+}
+
 FAlterMeshPrimitive::FAlterMeshPrimitive(FAlterMeshPrimitive&& Other)
 {
 	Sections = MoveTemp(Other.Sections);
@@ -287,6 +287,44 @@ SIZE_T FAlterMeshInstanceBuffer::GetResourceSize() const
 	return 0;
 }
 
+#if REQUIRES_COMMANDLIST
+void FAlterMeshInstanceBuffer::UpdateInstances(FRHICommandListBase& RHICmdList, int32 FirstInstance, TConstArrayView<FMatrix44f> Transforms)
+#else
+void FAlterMeshInstanceBuffer::UpdateInstances(int32 FirstInstance, TConstArrayView<FMatrix44f> Transforms)
+#endif
+{
+	check(IsInRenderingThread());
+	check(InstanceData && FirstInstance >= 0 && FirstInstance + Transforms.Num() <= InstanceData->GetNumInstances());
+
+	if (Transforms.Num() == 0 || !InstanceOriginBuffer.VertexBufferRHI || !InstanceTransformBuffer.VertexBufferRHI)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FAlterMeshInstanceBuffer_UpdateInstances);
+
+	const uint32 OriginStride = FAlterMeshInstanceData::GetPackedOriginStride();
+	const uint32 TransformStride = FAlterMeshInstanceData::GetPackedTransformStride();
+
+#if REQUIRES_COMMANDLIST
+	void* Origins = RHICmdList.LockBuffer(InstanceOriginBuffer.VertexBufferRHI, FirstInstance * OriginStride, Transforms.Num() * OriginStride, RLM_WriteOnly);
+	void* InstanceTransforms = RHICmdList.LockBuffer(InstanceTransformBuffer.VertexBufferRHI, FirstInstance * TransformStride, Transforms.Num() * TransformStride, RLM_WriteOnly);
+#else
+	void* Origins = RHILockBuffer(InstanceOriginBuffer.VertexBufferRHI, FirstInstance * OriginStride, Transforms.Num() * OriginStride, RLM_WriteOnly);
+	void* InstanceTransforms = RHILockBuffer(InstanceTransformBuffer.VertexBufferRHI, FirstInstance * TransformStride, Transforms.Num() * TransformStride, RLM_WriteOnly);
+#endif
+
+	FAlterMeshInstanceData::PackInstances(Transforms, 0, static_cast<FVector4f*>(Origins), static_cast<uint8*>(InstanceTransforms));
+
+#if REQUIRES_COMMANDLIST
+	RHICmdList.UnlockBuffer(InstanceOriginBuffer.VertexBufferRHI);
+	RHICmdList.UnlockBuffer(InstanceTransformBuffer.VertexBufferRHI);
+#else
+	RHIUnlockBuffer(InstanceOriginBuffer.VertexBufferRHI);
+	RHIUnlockBuffer(InstanceTransformBuffer.VertexBufferRHI);
+#endif
+}
+
 #if REQUIRES_COMMANDLIST
 void FAlterMeshInstanceBuffer::CreateVertexBuffer(FRHICommandListBase& RHICmdList, FResourceArrayInterface* InResourceArray, EBufferUsageFlags InUsage, uint32 InStride, uint8 InFormat, FBufferRHIRef& OutVertexBufferRHI, FShaderResourceViewRHIRef& OutInstanceSRV)
 #else
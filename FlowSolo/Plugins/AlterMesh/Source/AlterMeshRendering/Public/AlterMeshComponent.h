@@ -42,6 +42,13 @@ public:
 
 	virtual void OnRegister() override;
 
+	// Whether the mesh could be displayed by only updating the instances of this component
+	bool HasSameGeometry(const FAlterMeshPrimitive& Mesh) const;
+
+	// Replaces instance transforms of the section, only the ranges that changed are uploaded.
+	// Render state is recreated only if the number of instances differs
+	void UpdateInstances(int32 SectionIndex, TArray<FMatrix44f>&& NewInstances);
+
 	//~ Begin UActorComponent Interface.
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	//~ End UActorComponent Interface.
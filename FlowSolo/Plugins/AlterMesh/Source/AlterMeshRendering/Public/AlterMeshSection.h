@@ -19,6 +19,9 @@ struct ALTERMESHRENDERING_API FAlterMeshSection
 	// Explicit copy
 	FAlterMeshSection Copy();
 
+	// Compares everything but the instance transforms
+	bool HasSameGeometry(const FAlterMeshSection& Other) const;
+
 	TArray<FVector3f> Vertices;
 	TArray<FVector3f> Normals;
 	TArray<FVector3f> Tangents;
@@ -72,6 +72,16 @@ public:
 	virtual FString GetFriendlyName() const override { return TEXT("Static-mesh instances"); }
 	SIZE_T GetResourceSize() const;
 
+	/**
+	 * Overwrites a range of instances in the GPU buffers, the number of instances can't change.
+	 * CPU copy is not updated, it's discarded after the buffers have been created anyway.
+	 */
+#if REQUIRES_COMMANDLIST
+	void UpdateInstances(FRHICommandListBase& RHICmdList, int32 FirstInstance, TConstArrayView<FMatrix44f> Transforms);
+#else
+	void UpdateInstances(int32 FirstInstance, TConstArrayView<FMatrix44f> Transforms);
+#endif
+
 	void BindInstanceVertexBuffer(const class FVertexFactory* VertexFactory, struct FAlterMeshDataType& InstancedStaticMeshData) const;
 
 public:
@@ -408,6 +418,41 @@ public:
 		SetInstanceTransformInternal<float>(InstanceIndex, InstanceTransform);
 	}
 
+	// Bulk version of SetInstance, range is checked once instead of per instance
+	void SetInstances(int32 FirstInstance, TConstArrayView<FMatrix44f> Transforms, float RandomInstanceID)
+	{
+		check(FirstInstance >= 0 && FirstInstance + Transforms.Num() <= NumInstances);
+
+		PackInstances(Transforms, RandomInstanceID, reinterpret_cast<FVector4f*>(InstanceOriginDataPtr) + FirstInstance, InstanceTransformDataPtr + FirstInstance * GetPackedTransformStride());
+	}
+
+	// Writes instances in the layout of the GPU buffers, OutOrigins and OutTransforms can be locked buffer memory
+	static void PackInstances(TConstArrayView<FMatrix44f> Transforms, float RandomInstanceID, FVector4f* OutOrigins, uint8* OutTransforms)
+	{
+		FInstanceTransformMatrix<float>* OutMatrices = reinterpret_cast<FInstanceTransformMatrix<float>*>(OutTransforms);
+
+		for (int32 i = 0; i < Transforms.Num(); i++)
+		{
+			const FMatrix44f& Transform = Transforms[i];
+			OutOrigins[i] = FVector4f(Transform.M[3][0], Transform.M[3][1], Transform.M[3][2], RandomInstanceID);
+
+			FInstanceTransformMatrix<float>& Matrix = OutMatrices[i];
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Matrix.InstanceTransform1[Axis] = Transform.M[0][Axis];
+				Matrix.InstanceTransform2[Axis] = Transform.M[1][Axis];
+				Matrix.InstanceTransform3[Axis] = Transform.M[2][Axis];
+			}
+
+			Matrix.InstanceTransform1[3] = 0.0f;
+			Matrix.InstanceTransform2[3] = 0.0f;
+			Matrix.InstanceTransform3[3] = 0.0f;
+		}
+	}
+
+	static constexpr uint32 GetPackedOriginStride() { return sizeof(FVector4f); }
+	static constexpr uint32 GetPackedTransformStride() { return sizeof(FInstanceTransformMatrix<float>); }
+
 	FORCEINLINE_DEBUGGABLE int32 GetNumInstances() const
 	{
 		return NumInstances;
@@ -1,181 +1,307 @@
 // Copyright 2023 Aechmea
 
 #include <stdio.h>
+#include <stdint.h>
 #include <windows.h>
 #include <locale.h>
 #include <stdbool.h>
 #include "AlterMesh.h"
 
+// Each direction is a ring of slots, the writer fills the next slot while the reader still consumes the previous one.
+// The mapping starts with a header written by the process creating it, the other one only verifies it.
+//
+// | Header | Slot 0 | Slot 1 | ...
+//
+// Slot is a sequence of blocks terminated by BLOCK_END, each payload starts at ALTERMESH_BLOCK_ALIGNMENT.
+
+#define PROTOCOL_MAGIC 0x47524D41
+#define NUM_SLOTS 2
+#define MAX_SLOTS 8
+#define HEADER_SIZE 65536
+#define BLOCK_END 0xFFFFFFFF
+
+#define GIGABYTE 1024*1024*1024
+#define MEGABYTE 1024*1024
+
+struct RingHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t NumSlots;
+	uint32_t Reserved;
+	uint64_t SlotSize;
+};
+
+struct BlockHeader
+{
+	uint64_t Size;
+	uint32_t Type;
+	uint32_t Components;
+};
+
+struct Slot
+{
+	void* Empty;
+	void* Full;
+	size_t AllocatedSize;
+};
+
 struct BufferView
 {
 	size_t Offset;
 	char* Address;
-	size_t MaxSize;
-	void* Empty;
-	void* Full;
+	size_t SlotSize;
 	void* Handle;
-	size_t AllocatedSize;
+	uint32_t Version;
+	uint32_t NumSlots;
+	uint32_t CurrentSlot;
+	struct Slot Slots[MAX_SLOTS];
 };
 
 #define EXPORT_BUFFER Handle[0]
 #define IMPORT_BUFFER Handle[1]
 
-#define GIGABYTE 1024*1024*1024
-#define MEGABYTE 1024*1024
+static size_t AlignBlock(size_t Size)
+{
+	return (Size + ALTERMESH_BLOCK_ALIGNMENT - 1) & ~((size_t)ALTERMESH_BLOCK_ALIGNMENT - 1);
+}
 
-const wchar_t* CreateGuid(wchar_t* Name, const wchar_t* Guid)
+static char* GetSlotAddress(struct BufferView* View)
 {
-	wchar_t* MutexName = malloc(50 * sizeof(wchar_t));
-	MutexName[0] = L'\0';
-	wcsncat_s(MutexName, 50, Name, wcslen(Name));	 
-	wcsncat_s(MutexName, 50, Guid, wcslen(Guid));
-	return MutexName;
+	return View->Address + HEADER_SIZE + View->CurrentSlot * View->SlotSize;
 }
 
-void* Init(const wchar_t* Guid, const wchar_t* Guid2)
+// Commits memory of the current slot until Size bytes are available, false if the slot is too small
+static bool Allocate(struct BufferView* View, size_t Size)
 {
-	struct BufferView ImportBuffer = { .Offset = 0, .Address = 0, .MaxSize = 1ull * GIGABYTE, .Full = 0, .Empty = 0, .Handle = 0, .AllocatedSize = 0 };
-	struct BufferView ExportBuffer = { .Offset = 0, .Address = 0, .MaxSize = 1ull * GIGABYTE, .Full = 0, .Empty = 0, .Handle = 0, .AllocatedSize = 0 };
+	struct Slot* Slot = &View->Slots[View->CurrentSlot];
+
+	if (Size > View->SlotSize)
+	{
+		return false;
+	}
 
-	struct BufferView* AlterMeshHandle = malloc(2 * sizeof(struct BufferView));
+	while (Slot->AllocatedSize < Size)
+	{
+		size_t NewSize = Slot->AllocatedSize * 2 < View->SlotSize ? Slot->AllocatedSize * 2 : View->SlotSize;
+		VirtualAlloc(GetSlotAddress(View) + Slot->AllocatedSize, NewSize - Slot->AllocatedSize, MEM_COMMIT, PAGE_READWRITE);
+		Slot->AllocatedSize = NewSize;
+	}
+
+	return true;
+}
 
-	ExportBuffer.Handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE | SEC_RESERVE,
-									ExportBuffer.MaxSize >> 32, ExportBuffer.MaxSize & 0xFFFFFFFF, Guid);
-	ImportBuffer.Handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE | SEC_RESERVE,
-									ImportBuffer.MaxSize >> 32, ImportBuffer.MaxSize & 0xFFFFFFFF, Guid2);
+static void InitBuffer(struct BufferView* View, const wchar_t* Guid)
+{
+	const uint64_t MappingSize = HEADER_SIZE + (uint64_t)NUM_SLOTS * GIGABYTE;
 
-	if (ExportBuffer.Handle)
+	View->Handle = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE | SEC_RESERVE,
+									MappingSize >> 32, MappingSize & 0xFFFFFFFF, Guid);
+	if (!View->Handle)
 	{
-		ExportBuffer.Address = MapViewOfFile(ExportBuffer.Handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+		return;
+	}
 
-		// Semaphores
-		ExportBuffer.Full = CreateSemaphoreW(0, 0, 1, CreateGuid(L"F-", Guid));
-		ExportBuffer.Empty = CreateSemaphoreW(0, 1, 1, CreateGuid(L"E-", Guid));
+	const bool bCreated = GetLastError() != ERROR_ALREADY_EXISTS;
+
+	View->Address = MapViewOfFile(View->Handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	if (!View->Address)
+	{
+		return;
+	}
+
+	VirtualAlloc(View->Address, HEADER_SIZE, MEM_COMMIT, PAGE_READWRITE);
 
-    	// Initial allocation
-		VirtualAlloc(ExportBuffer.Address, MEGABYTE, MEM_COMMIT, PAGE_READWRITE);
-		ExportBuffer.AllocatedSize = MEGABYTE;
+	struct RingHeader* Header = (struct RingHeader*)View->Address;
+	if (bCreated)
+	{
+		Header->Version = ALTERMESH_PROTOCOL_VERSION;
+		Header->NumSlots = NUM_SLOTS;
+		Header->SlotSize = 1ull * GIGABYTE;
+		MemoryBarrier();
+		Header->Magic = PROTOCOL_MAGIC;
 	}
 
-    if (ImportBuffer.Handle)
-    {
-        ImportBuffer.Address = MapViewOfFile(ImportBuffer.Handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+	// Incompatible peer, every lock will fail
+	if (Header->Magic != PROTOCOL_MAGIC || Header->Version != ALTERMESH_PROTOCOL_VERSION || Header->NumSlots == 0 || Header->NumSlots > MAX_SLOTS)
+	{
+		return;
+	}
+
+	View->Version = Header->Version;
+	View->NumSlots = Header->NumSlots;
+	View->SlotSize = Header->SlotSize;
+
+	for (uint32_t SlotIndex = 0; SlotIndex < View->NumSlots; SlotIndex++)
+	{
+		wchar_t Name[64];
 
 		// Semaphores
-    	ImportBuffer.Full = CreateSemaphoreW(0, 0, 1, CreateGuid(L"F-", Guid2));
-    	ImportBuffer.Empty = CreateSemaphoreW(0, 1, 1, CreateGuid(L"E-", Guid2));
+		swprintf_s(Name, 64, L"F%u-%s", SlotIndex, Guid);
+		View->Slots[SlotIndex].Full = CreateSemaphoreW(0, 0, 1, Name);
+		swprintf_s(Name, 64, L"E%u-%s", SlotIndex, Guid);
+		View->Slots[SlotIndex].Empty = CreateSemaphoreW(0, 1, 1, Name);
+
+		// Initial allocation
+		VirtualAlloc(View->Address + HEADER_SIZE + SlotIndex * View->SlotSize, MEGABYTE, MEM_COMMIT, PAGE_READWRITE);
+		View->Slots[SlotIndex].AllocatedSize = MEGABYTE;
+	}
+}
 
-    	// Initial allocation
-    	VirtualAlloc(ImportBuffer.Address, MEGABYTE, MEM_COMMIT, PAGE_READWRITE);
-    	ImportBuffer.AllocatedSize = MEGABYTE;
-    }
+void* Init(const wchar_t* Guid, const wchar_t* Guid2)
+{
+	struct BufferView* AlterMeshHandle = calloc(2, sizeof(struct BufferView));
 
-	AlterMeshHandle[0] = ExportBuffer;
-	AlterMeshHandle[1] = ImportBuffer;
+	InitBuffer(&AlterMeshHandle[0], Guid);
+	InitBuffer(&AlterMeshHandle[1], Guid2);
 
 	return AlterMeshHandle;
 }
 
+static void FreeBuffer(struct BufferView* View)
+{
+	for (uint32_t SlotIndex = 0; SlotIndex < View->NumSlots; SlotIndex++)
+	{
+		if (View->Slots[SlotIndex].Full)
+			CloseHandle(View->Slots[SlotIndex].Full);
+		if (View->Slots[SlotIndex].Empty)
+			CloseHandle(View->Slots[SlotIndex].Empty);
+	}
+
+	if (View->Address)
+		UnmapViewOfFile(View->Address);
+	if (View->Handle)
+		CloseHandle(View->Handle);
+}
+
 void Free(struct BufferView* Handle)
 {
-	if (EXPORT_BUFFER.Address)
-		UnmapViewOfFile(EXPORT_BUFFER.Address);
-	if (IMPORT_BUFFER.Address)
-		UnmapViewOfFile(IMPORT_BUFFER.Address);
-	if (EXPORT_BUFFER.Handle)
-		CloseHandle(EXPORT_BUFFER.Handle);
-	if (IMPORT_BUFFER.Handle)
-		CloseHandle(IMPORT_BUFFER.Handle);
+	if (!Handle)
+		return;
+
+	FreeBuffer(&EXPORT_BUFFER);
+	FreeBuffer(&IMPORT_BUFFER);
 
 	free(Handle);
 }
 
+unsigned int GetProtocolVersion(struct BufferView* Handle)
+{
+	return EXPORT_BUFFER.Version == IMPORT_BUFFER.Version ? EXPORT_BUFFER.Version : 0;
+}
+
 bool ReadLock(struct BufferView* Handle)
 {
-	bool bLocked = WaitForSingleObject(IMPORT_BUFFER.Full, -1) == WAIT_OBJECT_0;
+	if (IMPORT_BUFFER.NumSlots == 0)
+		return false;
+
+	bool bLocked = WaitForSingleObject(IMPORT_BUFFER.Slots[IMPORT_BUFFER.CurrentSlot].Full, -1) == WAIT_OBJECT_0;
 	if (bLocked)
 	{
 		IMPORT_BUFFER.Offset = 0;
 	}
-	
+
 	return bLocked;
 }
 
 bool WriteLock(struct BufferView* Handle)
 {
-	bool bLocked = WaitForSingleObject(EXPORT_BUFFER.Empty, -1) == WAIT_OBJECT_0;
+	if (EXPORT_BUFFER.NumSlots == 0)
+		return false;
+
+	bool bLocked = WaitForSingleObject(EXPORT_BUFFER.Slots[EXPORT_BUFFER.CurrentSlot].Empty, -1) == WAIT_OBJECT_0;
 	if (bLocked)
 	{
 		EXPORT_BUFFER.Offset = 0;
 	}
-	
+
 	return bLocked;
 }
 
-void Allocate(struct BufferView* Handle)
+bool WriteBlock(struct BufferView* Handle, unsigned int Type, unsigned int Components, const char* Source, const size_t Length)
 {
-	VirtualAlloc(Handle->Address + Handle->AllocatedSize, Handle->AllocatedSize, MEM_COMMIT, PAGE_READWRITE);
-	Handle->AllocatedSize *= 2;
-}
+	const size_t PayloadOffset = EXPORT_BUFFER.Offset + AlignBlock(sizeof(struct BlockHeader));
+	const size_t NextOffset = PayloadOffset + AlignBlock(Length);
 
-void Write(struct BufferView* Handle, const char* Source, const size_t Length)
-{
-	// Allocate enough to write
-	while (EXPORT_BUFFER.AllocatedSize < EXPORT_BUFFER.Offset + Length)
+	// Keep space for the end marker
+	if (!Allocate(&EXPORT_BUFFER, NextOffset + sizeof(struct BlockHeader)))
 	{
-		Allocate(&EXPORT_BUFFER);
+		return false;
 	}
 
-	const int HeaderSize = sizeof(int);
-	const int ChunkSize = (int)Length + HeaderSize;
-    memcpy(EXPORT_BUFFER.Address + EXPORT_BUFFER.Offset, &ChunkSize, HeaderSize);
-    EXPORT_BUFFER.Offset += HeaderSize;
+	char* SlotAddress = GetSlotAddress(&EXPORT_BUFFER);
+
+	struct BlockHeader Header = { .Size = Length, .Type = Type, .Components = Components };
+	memcpy(SlotAddress + EXPORT_BUFFER.Offset, &Header, sizeof(Header));
+	memcpy(SlotAddress + PayloadOffset, Source, Length);
 
-    memcpy(EXPORT_BUFFER.Address + EXPORT_BUFFER.Offset, Source, Length);
-    EXPORT_BUFFER.Offset += Length;
+	EXPORT_BUFFER.Offset = NextOffset;
+	return true;
 }
-  
-bool Read(struct BufferView* Handle, void** Address, size_t* OutLength)
+
+void Write(struct BufferView* Handle, const char* Source, const size_t Length)
 {
-    int ChunkSize;
-    memcpy(&ChunkSize, IMPORT_BUFFER.Address + IMPORT_BUFFER.Offset, sizeof(int));
+	WriteBlock(Handle, ALTERMESH_BLOCK_BYTES, 1, Source, Length);
+}
 
-	// Allocated memory must be at least the whole chunk plus next chunk's header
-	while (IMPORT_BUFFER.AllocatedSize < IMPORT_BUFFER.Offset + ChunkSize + sizeof(int))
+bool ReadBlock(struct BufferView* Handle, void** Address, size_t* OutLength, unsigned int* OutType, unsigned int* OutComponents)
+{
+	if (OutLength)
+		*OutLength = 0;
+
+	if (!Allocate(&IMPORT_BUFFER, IMPORT_BUFFER.Offset + sizeof(struct BlockHeader)))
 	{
-		Allocate(&IMPORT_BUFFER);
+		return false;
 	}
 
-	if (ChunkSize == 0)
-	{
-		if (OutLength)
-			*OutLength = 0;
+	char* SlotAddress = GetSlotAddress(&IMPORT_BUFFER);
+
+	struct BlockHeader Header;
+	memcpy(&Header, SlotAddress + IMPORT_BUFFER.Offset, sizeof(Header));
 
+	if (Header.Type == BLOCK_END)
+	{
 		return false;
 	}
-	else
+
+	const size_t PayloadOffset = IMPORT_BUFFER.Offset + AlignBlock(sizeof(struct BlockHeader));
+	const size_t NextOffset = PayloadOffset + AlignBlock(Header.Size);
+
+	// Allocated memory must be at least the whole block plus next block's header
+	if (!Allocate(&IMPORT_BUFFER, NextOffset + sizeof(struct BlockHeader)))
 	{
-		IMPORT_BUFFER.Offset += sizeof(int);
+		return false;
+	}
 
-		*Address = IMPORT_BUFFER.Address + IMPORT_BUFFER.Offset;
+	*Address = SlotAddress + PayloadOffset;
+	IMPORT_BUFFER.Offset = NextOffset;
 
-		IMPORT_BUFFER.Offset += ChunkSize - sizeof(int);
+	if (OutLength)
+		*OutLength = Header.Size;
+	if (OutType)
+		*OutType = Header.Type;
+	if (OutComponents)
+		*OutComponents = Header.Components;
 
-		if (OutLength)
-			*OutLength = ChunkSize - sizeof(int);
+	return true;
+}
 
-		return true;
-	}
+bool Read(struct BufferView* Handle, void** Address, size_t* OutLength)
+{
+	return ReadBlock(Handle, Address, OutLength, NULL, NULL);
 }
-  
+
 void ReadUnlock(struct BufferView* Handle)
 {
-    memset(IMPORT_BUFFER.Address, 0, 4);
-    ReleaseSemaphore(IMPORT_BUFFER.Empty, 1, NULL);
+	ReleaseSemaphore(IMPORT_BUFFER.Slots[IMPORT_BUFFER.CurrentSlot].Empty, 1, NULL);
+	IMPORT_BUFFER.CurrentSlot = (IMPORT_BUFFER.CurrentSlot + 1) % IMPORT_BUFFER.NumSlots;
 }
 
 void WriteUnlock(struct BufferView* Handle)
 {
-    memset(EXPORT_BUFFER.Address + EXPORT_BUFFER.Offset, 0, 4);
-    ReleaseSemaphore(EXPORT_BUFFER.Full, 1, NULL);
+	struct BlockHeader End = { .Size = 0, .Type = BLOCK_END, .Components = 0 };
+	memcpy(GetSlotAddress(&EXPORT_BUFFER) + EXPORT_BUFFER.Offset, &End, sizeof(End));
+
+	ReleaseSemaphore(EXPORT_BUFFER.Slots[EXPORT_BUFFER.CurrentSlot].Full, 1, NULL);
+	EXPORT_BUFFER.CurrentSlot = (EXPORT_BUFFER.CurrentSlot + 1) % EXPORT_BUFFER.NumSlots;
 }
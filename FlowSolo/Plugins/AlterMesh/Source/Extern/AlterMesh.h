@@ -2,6 +2,23 @@
 
 #pragma once
 
+// Bumped whenever the layout of the shared memory changes, both processes must use the same version
+#define ALTERMESH_PROTOCOL_VERSION 2
+
+// Block types, kind in the low 16 bits and element size in the high 16 bits
+#define ALTERMESH_BLOCK_TYPE(Kind, ElementSize) ((Kind) | ((ElementSize) << 16))
+#define ALTERMESH_BLOCK_KIND(Type) ((Type) & 0xFFFF)
+#define ALTERMESH_BLOCK_ELEMENT_SIZE(Type) ((Type) >> 16)
+
+#define ALTERMESH_BLOCK_BYTES 0
+#define ALTERMESH_BLOCK_INT 1
+#define ALTERMESH_BLOCK_UINT 2
+#define ALTERMESH_BLOCK_FLOAT 3
+#define ALTERMESH_BLOCK_BOOL 4
+
+// Payloads are aligned so they can be consumed in place as typed arrays
+#define ALTERMESH_BLOCK_ALIGNMENT 16
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -15,6 +32,13 @@ __declspec(dllexport) bool ReadLock(void* Handle);
 __declspec(dllexport) bool WriteLock(void* Handle);
 __declspec(dllexport) void ReadUnlock(void* Handle);
 __declspec(dllexport) void WriteUnlock(void* Handle);
+
+// Version found in the shared memory, 0 if it wasn't created by a compatible library
+__declspec(dllexport) unsigned int GetProtocolVersion(void* Handle);
+
+// Typed versions of Read and Write, returns false at the end of the exchange or if the slot is full
+__declspec(dllexport) bool ReadBlock(void* Handle, void** Address, size_t* OutLength, unsigned int* OutType, unsigned int* OutComponents);
+__declspec(dllexport) bool WriteBlock(void* Handle, unsigned int Type, unsigned int Components, const char* Source, const size_t Length);
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -72,10 +72,10 @@ while True:
         Writer(np.int32).from_value(len(geometry_nodes_objs))
 
         for obj in geometry_nodes_objs:    
-            Writer().from_buffer(bytes(obj.name, "UTF-16-LE"))
+            Writer(np.uint16).from_buffer(bytes(obj.name, "UTF-16-LE"))
 
             export_params = {'Params': get_geometry_nodes_params(obj), 'Materials' : get_materials()}
-            Writer().from_buffer(bytes(json.dumps(export_params), "UTF-16-LE"))
+            Writer(np.uint16).from_buffer(bytes(json.dumps(export_params), "UTF-16-LE"))
 
             geometry_types = get_geometry_types()
             for modifier in obj.modifiers:
@@ -93,7 +93,7 @@ while True:
                                         break
                                     
                                 geometry_type_name_bytes = bytes(default_geometry_type.__name__, "UTF-16-LE") if default_geometry_type is not None else b''
-                                Writer().from_buffer(geometry_type_name_bytes)
+                                Writer(np.uint16).from_buffer(geometry_type_name_bytes)
 
                                 # Let it write defaults
                                 if default_geometry_type is not None:
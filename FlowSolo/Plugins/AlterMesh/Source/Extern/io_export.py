@@ -126,7 +126,7 @@ def get_mesh_data(mesh):
     material_names = json.dumps(material_names)
 
     mesh_hash = np.asarray(hash(mesh), np.int64)
-    material_names = np.frombuffer(bytes(material_names, "UTF-16-LE"), np.byte)
+    material_names = np.frombuffer(bytes(material_names, "UTF-16-LE"), np.uint16)
     vertex_indexed_uvs = np.asarray(has_vertex_indexed_uvs, np.bool8)
     vertex_indexed_colors = np.asarray(has_vertex_indexed_colors, np.bool8)    
 
@@ -146,7 +146,7 @@ def get_original_input(geometry_nodes_obj, original_mesh):
     return instance_of
 
 def get_instance_data(geometry_nodes_obj, mesh, original_mesh, matrix_local, matrix_world):
-    original_input = np.frombuffer(bytes(get_original_input(geometry_nodes_obj, original_mesh), "UTF-16-LE"), np.byte)
+    original_input = np.frombuffer(bytes(get_original_input(geometry_nodes_obj, original_mesh), "UTF-16-LE"), np.uint16)
     matrix_local = np.array(matrix_local, np.float32)
     matrix_world = np.array(matrix_world, np.float32)
     mesh_hash = np.asarray(hash(mesh), np.int64)
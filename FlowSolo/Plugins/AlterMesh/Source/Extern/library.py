@@ -23,6 +23,12 @@ import numpy as np
 AlterMesh = None
 AlterMeshHandle = None
 
+# must match ALTERMESH_PROTOCOL_VERSION in AlterMesh.h
+PROTOCOL_VERSION = 2
+
+# block kinds, see AlterMesh.h
+BLOCK_KINDS = {'i': 1, 'u': 2, 'f': 3, 'b': 4}
+
 def setup_dll(guid1, guid2):
     dll_path = os.path.abspath( os.path.dirname(os.path.realpath(__file__)) + '\\AlterMesh.dll')
     
@@ -56,22 +62,34 @@ def setup_dll(guid1, guid2):
     AlterMesh.Free.argtypes = (ctypes.c_void_p,)
     AlterMesh.Free.restype = None
 
+    AlterMesh.GetProtocolVersion.argtypes = (ctypes.c_void_p,)
+    AlterMesh.GetProtocolVersion.restype = ctypes.c_uint
+
+    AlterMesh.ReadBlock.argtypes = (ctypes.c_void_p, ctypes.c_void_p, ctypes.POINTER(ctypes.c_size_t), ctypes.POINTER(ctypes.c_uint), ctypes.POINTER(ctypes.c_uint))
+    AlterMesh.ReadBlock.restype = ctypes.c_bool
+
+    AlterMesh.WriteBlock.argtypes = (ctypes.c_void_p, ctypes.c_uint, ctypes.c_uint, ctypes.POINTER(ctypes.c_ubyte), ctypes.c_size_t)
+    AlterMesh.WriteBlock.restype = ctypes.c_bool
+
+    if AlterMesh.GetProtocolVersion(AlterMeshHandle) != PROTOCOL_VERSION:
+        raise RuntimeError('AlterMesh.dll protocol mismatch, expected version ' + str(PROTOCOL_VERSION))
+
 class Reader:
-    buffer = 0
+    buffer = None
     length = 0
     dtype = None
     
     def __init__(self, dtype) -> None:
-        length = ctypes.c_ulonglong(0)
+        length = ctypes.c_size_t(0)
         address = ctypes.c_void_p()
 
-        if AlterMesh.Read(AlterMeshHandle, ctypes.byref(address), length):    
-            ArrayType = ctypes.c_char * length.value
-            bytes = ctypes.cast(address, ctypes.POINTER(ArrayType)).contents[:length.value]
+        # consumed in place, must not be used after ReadUnlock
+        if AlterMesh.ReadBlock(AlterMeshHandle, ctypes.byref(address), ctypes.byref(length), None, None):
+            buffer = (ctypes.c_ubyte * length.value).from_address(address.value)
         else:
-            bytes = b''
+            buffer = b''
 
-        self.buffer = bytes
+        self.buffer = buffer
         self.length = length.value
         self.dtype = dtype
     
@@ -88,10 +106,18 @@ class Reader:
         return self.as_array().item()
 
     def as_string(self):
-        string = str(self.buffer, encoding = 'ascii')
+        string = str(bytes(self.buffer), encoding = 'ascii')
         string = string.replace('\x00', '')
         return string
 
+def write_block(array):
+    array = np.ascontiguousarray(array)
+    kind = BLOCK_KINDS.get(array.dtype.kind, 0)
+    block_type = kind | (array.dtype.itemsize << 16) if kind else 0
+    components = array.shape[-1] if array.ndim > 1 else 1
+
+    AlterMesh.WriteBlock(AlterMeshHandle, block_type, components, array.ctypes.data_as(ctypes.POINTER(ctypes.c_ubyte)), array.nbytes)
+
 class Writer():
     dtype = None
 
@@ -99,12 +125,10 @@ class Writer():
         self.dtype = dtype
 
     def from_array(self, array):
-        AlterMesh.Write(AlterMeshHandle, array.ctypes.data_as(ctypes.POINTER(ctypes.c_ubyte)), array.nbytes)
+        write_block(array)
 
     def from_value(self, value):
-        array = np.asarray(value, self.dtype)
-        AlterMesh.Write(AlterMeshHandle, array.ctypes.data_as(ctypes.POINTER(ctypes.c_ubyte)), array.nbytes)
+        write_block(np.asarray(value, self.dtype))
         
     def from_buffer(self, value):
-        array = np.frombuffer(value, self.dtype)
-        AlterMesh.Write(AlterMeshHandle, array.ctypes.data_as(ctypes.POINTER(ctypes.c_ubyte)), array.nbytes)
\ No newline at end of file
+        write_block(np.frombuffer(value, self.dtype))
\ No newline at end of file
@@ -122,7 +122,7 @@ while True:
         Writer(np.int32).from_value(len(geometry_nodes_objs))
 
         for obj in geometry_nodes_objs:
-            Writer().from_buffer(bytes(obj.name, "UTF-16-LE"))
+            Writer(np.uint16).from_buffer(bytes(obj.name, "UTF-16-LE"))
 
             export_params = {
                 "Params": get_geometry_nodes_params(obj),
@@ -130,7 +130,7 @@ while True:
             }
 
             print(export_params, flush=True)
-            Writer().from_buffer(bytes(json.dumps(export_params), "UTF-16-LE"))
+            Writer(np.uint16).from_buffer(bytes(json.dumps(export_params), "UTF-16-LE"))
 
         # export geometry defaults (eg. curve defaults when a curve is assigned in the modifiers tab)
         geometry_types = get_geometry_types()
@@ -176,7 +176,7 @@ while True:
                                 if default_geometry_type is not None
                                 else b""
                             )
-                            Writer().from_buffer(geometry_type_name_bytes)
+                            Writer(np.uint16).from_buffer(geometry_type_name_bytes)
 
                             # Let it write defaults
                             if default_geometry_type is not None:
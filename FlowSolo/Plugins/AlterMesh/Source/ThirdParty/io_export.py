@@ -71,8 +71,8 @@ def get_mesh_data(mesh):
     material_names = json.dumps(material_names)
 
     mesh_hash = np.asarray(hash(mesh), np.int64)
-    material_names = np.frombuffer(bytes(material_names, "UTF-16-LE"), np.byte)
-    version = np.asarray(list(bpy.app.version))
+    material_names = np.frombuffer(bytes(material_names, "UTF-16-LE"), np.uint16)
+    version = np.asarray(list(bpy.app.version), np.int32)
 
     return (
         locations,
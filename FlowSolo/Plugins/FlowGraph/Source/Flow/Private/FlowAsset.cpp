@@ -28,6 +28,14 @@ FString UFlowAsset::ValidationError_NullNodeInstance = TEXT("Node with GUID {0}
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowAsset)
 
+#if !UE_BUILD_SHIPPING
+FFlowInstanceDebugEvent UFlowAsset::OnInstanceStartedDebug;
+FFlowInstanceDebugEvent UFlowAsset::OnInstanceFinishedDebug;
+FFlowNodeDebugEvent UFlowAsset::OnNodeActivatedDebug;
+FFlowNodeDebugEvent UFlowAsset::OnNodeFinishedDebug;
+FFlowPinDebugEvent UFlowAsset::OnPinTriggeredDebug;
+#endif
+
 UFlowAsset::UFlowAsset(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bWorldBound(true)
@@ -1191,6 +1199,13 @@ void UFlowAsset::PreStartFlow()
 		TemplateAsset->BroadcastDebuggerRefresh();
 	}
 #endif
+
+#if !UE_BUILD_SHIPPING
+	if (OnInstanceStartedDebug.IsBound())
+	{
+		OnInstanceStartedDebug.Broadcast(this);
+	}
+#endif
 }
 
 void UFlowAsset::StartFlow(IFlowDataPinValueSupplierInterface* DataPinValueSupplier)
@@ -1214,6 +1229,13 @@ void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool b
 {
 	FinishPolicy = InFinishPolicy;
 
+#if !UE_BUILD_SHIPPING
+	if (OnInstanceFinishedDebug.IsBound())
+	{
+		OnInstanceFinishedDebug.Broadcast(this);
+	}
+#endif
+
 	// end execution of this asset and all of its nodes
 	for (UFlowNode* Node : ActiveNodes)
 	{
@@ -1349,6 +1371,17 @@ void UFlowAsset::FinishNode(UFlowNode* Node)
 					return;
 				}
 			}
+			else if (GetFlowSubsystem())
+			{
+				// Root Flow owned by entity has no UObject Owner
+				const FFlowEntityHandle EntityOwner = GetFlowSubsystem()->GetEntityOwner(this);
+				if (EntityOwner.IsValid())
+				{
+					GetFlowSubsystem()->FinishEntityRootFlow(EntityOwner, TemplateAsset, EFlowFinishPolicy::Keep);
+
+					return;
+				}
+			}
 
 			FinishFlow(EFlowFinishPolicy::Keep);
 		}
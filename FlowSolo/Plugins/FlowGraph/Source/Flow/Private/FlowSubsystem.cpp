@@ -74,6 +74,8 @@ void UFlowSubsystem::AbortActiveFlows()
 	InstancedSubFlows.Empty();
 
 	RootInstances.Empty();
+	EntityRootInstances.Empty();
+	EntityRootInstancesByEntity.Empty();
 }
 
 void UFlowSubsystem::StartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */)
@@ -664,4 +666,295 @@ void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGa
 	}
 }
 
+void UFlowSubsystem::RegisterEntity(const FFlowEntityHandle& Entity, const FGameplayTagContainer& IdentityTags)
+{
+	if (!Entity.IsValid())
+	{
+		UE_LOG(LogFlow, Warning, TEXT("Attempted to register invalid entity handle in the Flow Subsystem."));
+		return;
+	}
+
+	if (EntityIdentityTags.Contains(Entity))
+	{
+		AddEntityIdentityTags(Entity, IdentityTags);
+		return;
+	}
+
+	FGameplayTagContainer& RegisteredTags = EntityIdentityTags.Add(Entity);
+	for (const FGameplayTag& Tag : IdentityTags)
+	{
+		if (Tag.IsValid())
+		{
+			RegisteredTags.AddTagFast(Tag);
+			FlowEntityRegistry.Emplace(Tag, Entity);
+		}
+	}
+
+	OnEntityRegistered.Broadcast(Entity);
+}
+
+void UFlowSubsystem::UnregisterEntity(const FFlowEntityHandle& Entity, const EFlowFinishPolicy FinishPolicy)
+{
+	FGameplayTagContainer RegisteredTags;
+	if (!EntityIdentityTags.RemoveAndCopyValue(Entity, RegisteredTags))
+	{
+		return;
+	}
+
+	FinishAllEntityRootFlows(Entity, FinishPolicy);
+
+	for (const FGameplayTag& Tag : RegisteredTags)
+	{
+		FlowEntityRegistry.Remove(Tag, Entity);
+	}
+
+	OnEntityUnregistered.Broadcast(Entity);
+}
+
+void UFlowSubsystem::AddEntityIdentityTags(const FFlowEntityHandle& Entity, const FGameplayTagContainer& AddedTags)
+{
+	FGameplayTagContainer* RegisteredTags = EntityIdentityTags.Find(Entity);
+	if (RegisteredTags == nullptr)
+	{
+		RegisterEntity(Entity, AddedTags);
+		return;
+	}
+
+	FGameplayTagContainer ValidatedTags;
+	for (const FGameplayTag& Tag : AddedTags)
+	{
+		if (Tag.IsValid() && !RegisteredTags->HasTagExact(Tag))
+		{
+			RegisteredTags->AddTagFast(Tag);
+			FlowEntityRegistry.Emplace(Tag, Entity);
+			ValidatedTags.AddTagFast(Tag);
+		}
+	}
+
+	if (ValidatedTags.Num() > 0)
+	{
+		OnEntityTagAdded.Broadcast(Entity, ValidatedTags);
+	}
+}
+
+void UFlowSubsystem::RemoveEntityIdentityTags(const FFlowEntityHandle& Entity, const FGameplayTagContainer& RemovedTags)
+{
+	FGameplayTagContainer* RegisteredTags = EntityIdentityTags.Find(Entity);
+	if (RegisteredTags == nullptr)
+	{
+		return;
+	}
+
+	FGameplayTagContainer ValidatedTags;
+	for (const FGameplayTag& Tag : RemovedTags)
+	{
+		if (RegisteredTags->RemoveTag(Tag))
+		{
+			FlowEntityRegistry.Remove(Tag, Entity);
+			ValidatedTags.AddTagFast(Tag);
+		}
+	}
+
+	// entity stays registered without Identity Tags, as it might still own Root Flows
+	if (ValidatedTags.Num() > 0)
+	{
+		OnEntityTagRemoved.Broadcast(Entity, ValidatedTags);
+	}
+}
+
+const FGameplayTagContainer& UFlowSubsystem::GetEntityIdentityTags(const FFlowEntityHandle& Entity) const
+{
+	const FGameplayTagContainer* RegisteredTags = EntityIdentityTags.Find(Entity);
+	return RegisteredTags ? *RegisteredTags : FGameplayTagContainer::EmptyContainer;
+}
+
+void UFlowSubsystem::FindEntities(const FGameplayTag& Tag, const bool bExactMatch, TArray<FFlowEntityHandle>& OutEntities) const
+{
+	if (bExactMatch)
+	{
+		FlowEntityRegistry.MultiFind(Tag, OutEntities);
+	}
+	else
+	{
+		for (TMultiMap<FGameplayTag, FFlowEntityHandle>::TConstIterator It(FlowEntityRegistry); It; ++It)
+		{
+			if (It.Key().MatchesTag(Tag))
+			{
+				OutEntities.Emplace(It.Value());
+			}
+		}
+	}
+}
+
+void UFlowSubsystem::FindEntities(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<FFlowEntityHandle>& OutEntities) const
+{
+	TArray<FFlowEntityHandle> EntitiesPerTag;
+
+	if (MatchType == EGameplayContainerMatchType::Any)
+	{
+		for (const FGameplayTag& Tag : Tags)
+		{
+			EntitiesPerTag.Reset();
+			FindEntities(Tag, bExactMatch, EntitiesPerTag);
+			OutEntities.Append(EntitiesPerTag);
+		}
+	}
+	else // EGameplayContainerMatchType::All
+	{
+		TSet<FFlowEntityHandle> EntitiesWithAnyTag;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			EntitiesPerTag.Reset();
+			FindEntities(Tag, bExactMatch, EntitiesPerTag);
+			EntitiesWithAnyTag.Append(EntitiesPerTag);
+		}
+
+		for (const FFlowEntityHandle& Entity : EntitiesWithAnyTag)
+		{
+			const FGameplayTagContainer* RegisteredTags = EntityIdentityTags.Find(Entity);
+			if (RegisteredTags && (bExactMatch ? RegisteredTags->HasAllExact(Tags) : RegisteredTags->HasAll(Tags)))
+			{
+				OutEntities.Emplace(Entity);
+			}
+		}
+	}
+}
+
+void UFlowSubsystem::StartEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */)
+{
+	if (UFlowAsset* NewFlow = CreateEntityRootFlow(Entity, FlowAsset, bAllowMultipleInstances))
+	{
+		NewFlow->StartFlow();
+	}
+}
+
+UFlowAsset* UFlowSubsystem::CreateEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */)
+{
+	if (!Entity.IsValid() || FlowAsset == nullptr)
+	{
+		UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow for invalid entity or null asset."));
+		return nullptr;
+	}
+
+	for (TMultiMap<FFlowEntityHandle, UFlowAsset*>::TConstKeyIterator It(EntityRootInstancesByEntity, Entity); It; ++It)
+	{
+		if (It.Value() && FlowAsset == It.Value()->GetTemplateAsset())
+		{
+			UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow for the same entity again. Entity: %s. Flow Asset: %s."), *Entity.ToString(), *FlowAsset->GetName());
+			return nullptr;
+		}
+	}
+
+	if (!bAllowMultipleInstances && InstancedTemplates.Contains(FlowAsset))
+	{
+		UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow, although there can be only a single instance. Entity: %s. Flow Asset: %s."), *Entity.ToString(), *FlowAsset->GetName());
+		return nullptr;
+	}
+
+	UFlowAsset* NewFlow = CreateFlowInstance(nullptr, FlowAsset);
+	if (NewFlow)
+	{
+		EntityRootInstances.Add(NewFlow, Entity);
+		EntityRootInstancesByEntity.Add(Entity, NewFlow);
+	}
+
+	return NewFlow;
+}
+
+void UFlowSubsystem::FinishEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* TemplateAsset, const EFlowFinishPolicy FinishPolicy)
+{
+	UFlowAsset* InstanceToFinish = nullptr;
+
+	for (TMultiMap<FFlowEntityHandle, UFlowAsset*>::TConstKeyIterator It(EntityRootInstancesByEntity, Entity); It; ++It)
+	{
+		if (It.Value() && It.Value()->GetTemplateAsset() == TemplateAsset)
+		{
+			InstanceToFinish = It.Value();
+			break;
+		}
+	}
+
+	if (InstanceToFinish)
+	{
+		EntityRootInstances.Remove(InstanceToFinish);
+		EntityRootInstancesByEntity.RemoveSingle(Entity, InstanceToFinish);
+		InstanceToFinish->FinishFlow(FinishPolicy);
+	}
+}
+
+void UFlowSubsystem::FinishAllEntityRootFlows(const FFlowEntityHandle& Entity, const EFlowFinishPolicy FinishPolicy)
+{
+	const TSet<UFlowAsset*> InstancesToFinish = GetEntityRootInstances(Entity);
+
+	EntityRootInstancesByEntity.Remove(Entity);
+
+	for (UFlowAsset* InstanceToFinish : InstancesToFinish)
+	{
+		EntityRootInstances.Remove(InstanceToFinish);
+		InstanceToFinish->FinishFlow(FinishPolicy);
+	}
+}
+
+TSet<UFlowAsset*> UFlowSubsystem::GetEntityRootInstances(const FFlowEntityHandle& Entity) const
+{
+	TSet<UFlowAsset*> Result;
+	for (TMultiMap<FFlowEntityHandle, UFlowAsset*>::TConstKeyIterator It(EntityRootInstancesByEntity, Entity); It; ++It)
+	{
+		if (It.Value())
+		{
+			Result.Emplace(It.Value());
+		}
+	}
+	return Result;
+}
+
+FFlowEntityHandle UFlowSubsystem::GetEntityOwner(const UFlowAsset* FlowInstance) const
+{
+	// walk up to the Root Flow, Sub Graphs inherit owner of the graph that instanced them
+	while (FlowInstance && FlowInstance->GetNodeOwningThisAssetInstance())
+	{
+		FlowInstance = FlowInstance->GetParentInstance();
+	}
+
+	if (FlowInstance)
+	{
+		if (const FFlowEntityHandle* Entity = EntityRootInstances.Find(const_cast<UFlowAsset*>(FlowInstance)))
+		{
+			return *Entity;
+		}
+	}
+
+	return FFlowEntityHandle();
+}
+
+void UFlowSubsystem::NotifyGraphFromEntity(const FFlowEntityHandle& Entity, const FGameplayTag& NotifyTag)
+{
+	if (NotifyTag.IsValid() && IsEntityRegistered(Entity))
+	{
+		OnNotifyFromEntity.Broadcast(Entity, NotifyTag);
+	}
+}
+
+void UFlowSubsystem::NotifyEntitiesFromGraph(const FGameplayTagContainer& IdentityTags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const FGameplayTagContainer& NotifyTags)
+{
+	if (!OnEntityReceiveNotify.IsBound() || FlowEntityRegistry.Num() == 0)
+	{
+		return;
+	}
+
+	TSet<FFlowEntityHandle> FoundEntities;
+	FindEntities(IdentityTags, MatchType, bExactMatch, FoundEntities);
+
+	for (const FFlowEntityHandle& Entity : FoundEntities)
+	{
+		for (const FGameplayTag& NotifyTag : NotifyTags)
+		{
+			if (NotifyTag.IsValid())
+			{
+				OnEntityReceiveNotify.Broadcast(Entity, NotifyTag);
+			}
+		}
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
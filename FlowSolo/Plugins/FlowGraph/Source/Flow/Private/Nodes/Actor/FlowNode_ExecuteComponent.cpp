@@ -537,6 +537,76 @@ FFlowDataPinResult_Class UFlowNode_ExecuteComponent::TrySupplyDataPinAsClass_Imp
 	return Super::TrySupplyDataPinAsClass_Implementation(PinName);
 }
 
+FFlowDataPinValueView_Name UFlowNode_ExecuteComponent::TrySupplyDataPinViewAsName(const FName& PinName) const
+{
+	if (UActorComponent* ResolvedComp = GetResolvedComponent())
+	{
+		if (const IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		{
+			// Component takes precedence, so let the copying path handle it unless it exposes the value natively
+			return PinSupplierInterface->TrySupplyDataPinViewAsName(PinName);
+		}
+	}
+
+	return Super::TrySupplyDataPinViewAsName(PinName);
+}
+
+FFlowDataPinValueView_String UFlowNode_ExecuteComponent::TrySupplyDataPinViewAsString(const FName& PinName) const
+{
+	if (UActorComponent* ResolvedComp = GetResolvedComponent())
+	{
+		if (const IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		{
+			// Component takes precedence, so let the copying path handle it unless it exposes the value natively
+			return PinSupplierInterface->TrySupplyDataPinViewAsString(PinName);
+		}
+	}
+
+	return Super::TrySupplyDataPinViewAsString(PinName);
+}
+
+FFlowDataPinValueView_Text UFlowNode_ExecuteComponent::TrySupplyDataPinViewAsText(const FName& PinName) const
+{
+	if (UActorComponent* ResolvedComp = GetResolvedComponent())
+	{
+		if (const IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		{
+			// Component takes precedence, so let the copying path handle it unless it exposes the value natively
+			return PinSupplierInterface->TrySupplyDataPinViewAsText(PinName);
+		}
+	}
+
+	return Super::TrySupplyDataPinViewAsText(PinName);
+}
+
+FFlowDataPinValueView_GameplayTagContainer UFlowNode_ExecuteComponent::TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const
+{
+	if (UActorComponent* ResolvedComp = GetResolvedComponent())
+	{
+		if (const IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		{
+			// Component takes precedence, so let the copying path handle it unless it exposes the value natively
+			return PinSupplierInterface->TrySupplyDataPinViewAsGameplayTagContainer(PinName);
+		}
+	}
+
+	return Super::TrySupplyDataPinViewAsGameplayTagContainer(PinName);
+}
+
+FFlowDataPinValueView_InstancedStruct UFlowNode_ExecuteComponent::TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const
+{
+	if (UActorComponent* ResolvedComp = GetResolvedComponent())
+	{
+		if (const IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		{
+			// Component takes precedence, so let the copying path handle it unless it exposes the value natively
+			return PinSupplierInterface->TrySupplyDataPinViewAsInstancedStruct(PinName);
+		}
+	}
+
+	return Super::TrySupplyDataPinViewAsInstancedStruct(PinName);
+}
+
 bool UFlowNode_ExecuteComponent::TryInjectComponent()
 {
 	if (!EExecuteComponentSource_Classifiers::DoesComponentSourceUseInjectManager(ComponentSource))
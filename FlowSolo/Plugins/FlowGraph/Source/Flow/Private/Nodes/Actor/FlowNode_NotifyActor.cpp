@@ -22,12 +22,15 @@ UFlowNode_NotifyActor::UFlowNode_NotifyActor(const FObjectInitializer& ObjectIni
 
 void UFlowNode_NotifyActor::ExecuteInput(const FName& PinName)
 {
-	if (const UFlowSubsystem* FlowSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UFlowSubsystem>())
+	if (UFlowSubsystem* FlowSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UFlowSubsystem>())
 	{
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(IdentityTags, MatchType, bExactMatch))
 		{
 			Component->NotifyFromGraph(NotifyTags, NetMode);
 		}
+
+		// entities aren't replicated, they're notified only where this graph runs
+		FlowSubsystem->NotifyEntitiesFromGraph(IdentityTags, MatchType, bExactMatch, NotifyTags);
 	}
 
 	TriggerFirstOutput(true);
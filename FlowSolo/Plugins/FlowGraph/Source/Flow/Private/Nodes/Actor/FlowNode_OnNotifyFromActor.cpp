@@ -2,6 +2,7 @@
 
 #include "Nodes/Actor/FlowNode_OnNotifyFromActor.h"
 #include "FlowComponent.h"
+#include "FlowSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_OnNotifyFromActor)
 
@@ -33,6 +34,30 @@ void UFlowNode_OnNotifyFromActor::ForgetActor(TWeakObjectPtr<AActor> Actor, TWea
 	Component->OnNotifyFromComponent.RemoveAll(this);
 }
 
+void UFlowNode_OnNotifyFromActor::StartObserving()
+{
+	Super::StartObserving();
+
+	// node might finish work immediately while observing already registered actors
+	if (GetActivationState() == EFlowNodeState::Active)
+	{
+		if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		{
+			FlowSubsystem->OnNotifyFromEntity.AddUObject(this, &UFlowNode_OnNotifyFromActor::OnNotifyFromEntity);
+		}
+	}
+}
+
+void UFlowNode_OnNotifyFromActor::StopObserving()
+{
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FlowSubsystem->OnNotifyFromEntity.RemoveAll(this);
+	}
+
+	Super::StopObserving();
+}
+
 void UFlowNode_OnNotifyFromActor::OnNotifyFromComponent(UFlowComponent* Component, const FGameplayTag& Tag)
 {
 	if (Component->IdentityTags.HasAnyExact(IdentityTags) && (!NotifyTags.IsValid() || NotifyTags.HasTagExact(Tag)))
@@ -41,6 +66,14 @@ void UFlowNode_OnNotifyFromActor::OnNotifyFromComponent(UFlowComponent* Componen
 	}
 }
 
+void UFlowNode_OnNotifyFromActor::OnNotifyFromEntity(const FFlowEntityHandle& Entity, const FGameplayTag& Tag)
+{
+	if ((!NotifyTags.IsValid() || NotifyTags.HasTagExact(Tag)) && GetFlowSubsystem()->GetEntityIdentityTags(Entity).HasAnyExact(IdentityTags))
+	{
+		OnEventReceived();
+	}
+}
+
 #if WITH_EDITOR
 FString UFlowNode_OnNotifyFromActor::GetNodeDescription() const
 {
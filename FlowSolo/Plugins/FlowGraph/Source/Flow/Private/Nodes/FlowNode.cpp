@@ -737,6 +737,42 @@ FFlowDataPinResult_InstancedStruct UFlowNode::TrySupplyDataPinAsInstancedStruct_
 	return TrySupplyDataPinAsStructType<FFlowDataPinResult_InstancedStruct, FFlowDataPinOutputProperty_InstancedStruct, FInstancedStruct>(PinName);
 }
 
+FFlowDataPinValueView_Name UFlowNode::TrySupplyDataPinViewAsName(const FName& PinName) const
+{
+	return TrySupplyDataPinViewAsType<FName, FFlowDataPinOutputProperty_Name, FNameProperty>(PinName, GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPinAsName));
+}
+
+FFlowDataPinValueView_String UFlowNode::TrySupplyDataPinViewAsString(const FName& PinName) const
+{
+	return TrySupplyDataPinViewAsType<FString, FFlowDataPinOutputProperty_String, FStrProperty>(PinName, GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPinAsString));
+}
+
+FFlowDataPinValueView_Text UFlowNode::TrySupplyDataPinViewAsText(const FName& PinName) const
+{
+	return TrySupplyDataPinViewAsType<FText, FFlowDataPinOutputProperty_Text, FTextProperty>(PinName, GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPinAsText));
+}
+
+FFlowDataPinValueView_GameplayTagContainer UFlowNode::TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const
+{
+	return TrySupplyDataPinViewAsType<FGameplayTagContainer, FFlowDataPinOutputProperty_GameplayTagContainer, FStructProperty>(PinName, GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPinAsGameplayTagContainer));
+}
+
+FFlowDataPinValueView_InstancedStruct UFlowNode::TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const
+{
+	return TrySupplyDataPinViewAsType<FInstancedStruct, FFlowDataPinOutputProperty_InstancedStruct, FStructProperty>(PinName, GET_FUNCTION_NAME_CHECKED(IFlowDataPinValueSupplierInterface, TrySupplyDataPinAsInstancedStruct));
+}
+
+bool UFlowNode::IsDataPinSupplyFunctionImplementedInScript(const FName& FunctionName) const
+{
+	if (GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return false;
+	}
+
+	const UFunction* Function = GetClass()->FindFunctionByName(FunctionName);
+	return Function && !Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Native);
+}
+
 FFlowDataPinResult_Object UFlowNode::TrySupplyDataPinAsObject_Implementation(const FName& PinName) const
 {
 	return TrySupplyDataPinAsUObjectType<FFlowDataPinResult_Object, FFlowDataPinOutputProperty_Object, UObject, FObjectProperty, FSoftObjectProperty, FWeakObjectProperty, FLazyObjectProperty>(PinName);
@@ -797,6 +833,13 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 			if (PreviousActivationState != EFlowNodeState::Active)
 			{
 				OnActivate();
+
+#if !UE_BUILD_SHIPPING
+				if (UFlowAsset::OnNodeActivatedDebug.IsBound())
+				{
+					UFlowAsset::OnNodeActivatedDebug.Broadcast(this);
+				}
+#endif
 			}
 
 			ActivationState = EFlowNodeState::Active;
@@ -811,6 +854,11 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 		{
 			(void)FlowAssetTemplate->OnPinTriggered.ExecuteIfBound(NodeGuid, PinName);
 		}
+
+		if (UFlowAsset::OnPinTriggeredDebug.IsBound())
+		{
+			UFlowAsset::OnPinTriggeredDebug.Broadcast(this, PinName, EGPD_Input);
+		}
 #endif
 	}
 #if !UE_BUILD_SHIPPING
@@ -860,6 +908,14 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 		return;
 	}
 
+#if !UE_BUILD_SHIPPING
+	// before finishing, as it might finish the whole instance
+	if (UFlowAsset::OnPinTriggeredDebug.IsBound() && OutputPins.Contains(PinName))
+	{
+		UFlowAsset::OnPinTriggeredDebug.Broadcast(this, PinName, EGPD_Output);
+	}
+#endif
+
 	// clean up node, if needed
 	if (bFinish)
 	{
@@ -895,6 +951,14 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 void UFlowNode::Finish()
 {
 	Deactivate();
+
+#if !UE_BUILD_SHIPPING
+	if (UFlowAsset::OnNodeFinishedDebug.IsBound())
+	{
+		UFlowAsset::OnNodeFinishedDebug.Broadcast(this);
+	}
+#endif
+
 	GetFlowAsset()->FinishNode(this);
 }
 
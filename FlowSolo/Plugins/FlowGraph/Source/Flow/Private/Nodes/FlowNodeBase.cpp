@@ -100,9 +100,28 @@ void UFlowNodeBase::DeinitializeInstance()
 		AddOn->DeinitializeInstance();
 	}
 
+	DataPinValueScratch.Reset();
+
 	IFlowCoreExecutableInterface::DeinitializeInstance();
 }
 
+void UFlowNodeBase::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	const UFlowNodeBase* This = CastChecked<UFlowNodeBase>(InThis);
+	if (This->DataPinValueScratch.IsValid())
+	{
+		for (TPair<FName, TUniquePtr<FInstancedStruct>>& Slot : This->DataPinValueScratch->InstancedStructs)
+		{
+			if (Slot.Value.IsValid())
+			{
+				Slot.Value->AddStructReferencedObjects(Collector);
+			}
+		}
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
 void UFlowNodeBase::PreloadContent()
 {
 	IFlowCoreExecutableInterface::PreloadContent();
@@ -172,6 +191,8 @@ void UFlowNodeBase::Cleanup()
 		AddOn->Cleanup();
 	}
 
+	DataPinValueScratch.Reset();
+
 	IFlowCoreExecutableInterface::Cleanup();
 }
 
@@ -1017,10 +1038,10 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 
 	case EFlowPinType::Name:
 		{
-			const FFlowDataPinResult_Name ResolvedResult = TryResolveDataPinAsName(NamedDataPinProperty.Name);
-			if (ResolvedResult.Result == EFlowDataPinResolveResult::Success)
+			const FFlowDataPinValueView_Name ResolvedView = TryResolveDataPinViewAsName(NamedDataPinProperty.Name);
+			if (ResolvedView.IsSuccess())
 			{
-				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedResult.Value.ToString())));
+				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedView.Get().ToString())));
 
 				return true;
 			}
@@ -1029,10 +1050,10 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 
 	case EFlowPinType::String:
 		{
-			const FFlowDataPinResult_String ResolvedResult = TryResolveDataPinAsString(NamedDataPinProperty.Name);
-			if (ResolvedResult.Result == EFlowDataPinResolveResult::Success)
+			const FFlowDataPinValueView_String ResolvedView = TryResolveDataPinViewAsString(NamedDataPinProperty.Name);
+			if (ResolvedView.IsSuccess())
 			{
-				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedResult.Value)));
+				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedView.Get())));
 
 				return true;
 			}
@@ -1041,10 +1062,10 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 
 	case EFlowPinType::Text:
 		{
-			const FFlowDataPinResult_Text ResolvedResult = TryResolveDataPinAsText(NamedDataPinProperty.Name);
-			if (ResolvedResult.Result == EFlowDataPinResolveResult::Success)
+			const FFlowDataPinValueView_Text ResolvedView = TryResolveDataPinViewAsText(NamedDataPinProperty.Name);
+			if (ResolvedView.IsSuccess())
 			{
-				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(ResolvedResult.Value));
+				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(ResolvedView.Get()));
 
 				return true;
 			}
@@ -1113,10 +1134,10 @@ bool UFlowNodeBase::TryAddValueToFormatNamedArguments(const FFlowNamedDataPinPro
 
 	case EFlowPinType::GameplayTagContainer:
 		{
-			const FFlowDataPinResult_GameplayTagContainer ResolvedResult = TryResolveDataPinAsGameplayTagContainer(NamedDataPinProperty.Name);
-			if (ResolvedResult.Result == EFlowDataPinResolveResult::Success)
+			const FFlowDataPinValueView_GameplayTagContainer ResolvedView = TryResolveDataPinViewAsGameplayTagContainer(NamedDataPinProperty.Name);
+			if (ResolvedView.IsSuccess())
 			{
-				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedResult.Value.ToString())));
+				InOutArguments.Add(NamedDataPinProperty.Name.ToString(), FFormatArgumentValue(FText::FromString(ResolvedView.Get().ToString())));
 
 				return true;
 			}
@@ -1272,67 +1293,138 @@ FFlowDataPinResult_Float UFlowNodeBase::TryResolveDataPinAsFloat(const FName& Pi
 	return WorkData.DataPinResult;
 }
 
-FFlowDataPinResult_Name UFlowNodeBase::TryResolveDataPinAsName(const FName& PinName) const
+// Per-type bindings of the heavy types resolved through TFlowDataPinValueView
+template <typename TValue>
+struct TFlowDataPinValueViewTraits;
+
+#define FLOW_DATA_PIN_VALUE_VIEW_TRAITS(ValueType, TypeName, SlotsName) \
+	template <> \
+	struct TFlowDataPinValueViewTraits<ValueType> \
+	{ \
+		typedef FFlowDataPinResult_##TypeName ResultType; \
+		static constexpr EFlowPinType PinType = EFlowPinType::TypeName; \
+		static TFlowDataPinValueView<ValueType> SupplyView(const IFlowDataPinValueSupplierInterface& Supplier, const FName& PinName) { return Supplier.TrySupplyDataPinViewAs##TypeName(PinName); } \
+		static ResultType Supply(const UObject* Supplier, const FName& PinName) { return IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAs##TypeName(Supplier, PinName); } \
+		static FFlowDataPinValueScratch::TSlots<ValueType>& GetSlots(FFlowDataPinValueScratch& Scratch) { return Scratch.SlotsName; } \
+	};
+
+FLOW_DATA_PIN_VALUE_VIEW_TRAITS(FName, Name, Names)
+FLOW_DATA_PIN_VALUE_VIEW_TRAITS(FString, String, Strings)
+FLOW_DATA_PIN_VALUE_VIEW_TRAITS(FText, Text, Texts)
+FLOW_DATA_PIN_VALUE_VIEW_TRAITS(FGameplayTagContainer, GameplayTagContainer, GameplayTagContainers)
+FLOW_DATA_PIN_VALUE_VIEW_TRAITS(FInstancedStruct, InstancedStruct, InstancedStructs)
+
+#undef FLOW_DATA_PIN_VALUE_VIEW_TRAITS
+
+template <typename TValue, typename TStoreSuppliedValue>
+TFlowDataPinValueView<TValue> UFlowNodeBase::ResolveDataPinValueView(const FName& PinName, TStoreSuppliedValue StoreSuppliedValue) const
 {
-	TResolveDataPinWorkingData<FFlowDataPinResult_Name, EFlowPinType::Name> WorkData;
+	typedef TFlowDataPinValueViewTraits<TValue> FTraits;
+
+	TResolveDataPinWorkingData<typename FTraits::ResultType, FTraits::PinType> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
-		return WorkData.DataPinResult;
+		return TFlowDataPinValueView<TValue>(WorkData.DataPinResult.Result);
 	}
 
 	for (const FFlowPinValueSupplierData& SupplierData : WorkData.PinValueSupplierDatas)
 	{
-		WorkData.DataPinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsName(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
+		// Prefer the supplier's own memory
+		const TFlowDataPinValueView<TValue> SuppliedView = FTraits::SupplyView(*SupplierData.PinValueSupplier, SupplierData.SupplierPinName);
+		if (SuppliedView.IsSuccess())
+		{
+			return SuppliedView;
+		}
+
+		// Fall back to the copying path (computed and Blueprint-supplied values)
+		WorkData.DataPinResult = FTraits::Supply(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
 
 		if (WorkData.DataPinResult.Result == EFlowDataPinResolveResult::Success)
 		{
-			return WorkData.DataPinResult;
+			return TFlowDataPinValueView<TValue>(StoreSuppliedValue(MoveTemp(WorkData.DataPinResult.Value)));
 		}
 	}
 
-	return WorkData.DataPinResult;
+	return TFlowDataPinValueView<TValue>(WorkData.DataPinResult.Result);
 }
 
-FFlowDataPinResult_String UFlowNodeBase::TryResolveDataPinAsString(const FName& PinName) const
+template <typename TValue>
+TFlowDataPinValueView<TValue> UFlowNodeBase::TryResolveDataPinViewAsType(const FName& PinName) const
 {
-	TResolveDataPinWorkingData<FFlowDataPinResult_String, EFlowPinType::String> WorkData;
-	if (!WorkData.TrySetupWorkingData(PinName, *this))
+	return ResolveDataPinValueView<TValue>(PinName, [this, &PinName](TValue&& SuppliedValue) -> const TValue&
 	{
-		return WorkData.DataPinResult;
-	}
+		TValue& ScratchValue = FFlowDataPinValueScratch::FindOrAddSlot(TFlowDataPinValueViewTraits<TValue>::GetSlots(GetDataPinValueScratch()), PinName);
+		ScratchValue = MoveTemp(SuppliedValue);
 
-	for (const FFlowPinValueSupplierData& SupplierData : WorkData.PinValueSupplierDatas)
+		return ScratchValue;
+	});
+}
+
+template <typename TValue, typename TFlowDataPinResultType>
+TFlowDataPinResultType UFlowNodeBase::TryResolveDataPinAsViewedType(const FName& PinName) const
+{
+	// Values supplied as a copy are moved straight into the result, they never touch the scratch storage
+	TFlowDataPinResultType CopiedResult;
+	const TFlowDataPinValueView<TValue> View = ResolveDataPinValueView<TValue>(PinName, [&CopiedResult](TValue&& SuppliedValue) -> const TValue&
 	{
-		WorkData.DataPinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsString(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
+		CopiedResult.Value = MoveTemp(SuppliedValue);
 
-		if (WorkData.DataPinResult.Result == EFlowDataPinResolveResult::Success)
-		{
-			return WorkData.DataPinResult;
-		}
+		return CopiedResult.Value;
+	});
+
+	if (!View.IsSuccess())
+	{
+		return TFlowDataPinResultType(View.Result);
 	}
 
-	return WorkData.DataPinResult;
+	// Single copy out of the supplier's own memory
+	if (View.Value != &CopiedResult.Value)
+	{
+		CopiedResult.Value = View.Get();
+	}
+
+	CopiedResult.Result = EFlowDataPinResolveResult::Success;
+	return CopiedResult;
 }
 
-FFlowDataPinResult_Text UFlowNodeBase::TryResolveDataPinAsText(const FName& PinName) const
+FFlowDataPinValueScratch& UFlowNodeBase::GetDataPinValueScratch() const
 {
-	TResolveDataPinWorkingData<FFlowDataPinResult_Text, EFlowPinType::Text> WorkData;
-	if (!WorkData.TrySetupWorkingData(PinName, *this))
+	if (!DataPinValueScratch.IsValid())
 	{
-		return WorkData.DataPinResult;
+		DataPinValueScratch = MakeUnique<FFlowDataPinValueScratch>();
 	}
 
-	for (const FFlowPinValueSupplierData& SupplierData : WorkData.PinValueSupplierDatas)
-	{
-		WorkData.DataPinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsText(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
+	return *DataPinValueScratch;
+}
 
-		if (WorkData.DataPinResult.Result == EFlowDataPinResolveResult::Success)
-		{
-			return WorkData.DataPinResult;
-		}
-	}
+FFlowDataPinResult_Name UFlowNodeBase::TryResolveDataPinAsName(const FName& PinName) const
+{
+	return TryResolveDataPinAsViewedType<FName, FFlowDataPinResult_Name>(PinName);
+}
 
-	return WorkData.DataPinResult;
+FFlowDataPinValueView_Name UFlowNodeBase::TryResolveDataPinViewAsName(const FName& PinName) const
+{
+	return TryResolveDataPinViewAsType<FName>(PinName);
+}
+
+FFlowDataPinResult_String UFlowNodeBase::TryResolveDataPinAsString(const FName& PinName) const
+{
+	return TryResolveDataPinAsViewedType<FString, FFlowDataPinResult_String>(PinName);
+}
+
+FFlowDataPinValueView_String UFlowNodeBase::TryResolveDataPinViewAsString(const FName& PinName) const
+{
+	return TryResolveDataPinViewAsType<FString>(PinName);
+}
+
+FFlowDataPinResult_Text UFlowNodeBase::TryResolveDataPinAsText(const FName& PinName) const
+{
+	return TryResolveDataPinAsViewedType<FText, FFlowDataPinResult_Text>(PinName);
+}
+
+FFlowDataPinValueView_Text UFlowNodeBase::TryResolveDataPinViewAsText(const FName& PinName) const
+{
+	return TryResolveDataPinViewAsType<FText>(PinName);
 }
 
 FFlowDataPinResult_Enum UFlowNodeBase::TryResolveDataPinAsEnum(const FName& PinName) const
@@ -1442,44 +1534,22 @@ FFlowDataPinResult_GameplayTag UFlowNodeBase::TryResolveDataPinAsGameplayTag(con
 
 FFlowDataPinResult_GameplayTagContainer UFlowNodeBase::TryResolveDataPinAsGameplayTagContainer(const FName& PinName) const
 {
-	TResolveDataPinWorkingData<FFlowDataPinResult_GameplayTagContainer, EFlowPinType::GameplayTagContainer> WorkData;
-	if (!WorkData.TrySetupWorkingData(PinName, *this))
-	{
-		return WorkData.DataPinResult;
-	}
-
-	for (const FFlowPinValueSupplierData& SupplierData : WorkData.PinValueSupplierDatas)
-	{
-		WorkData.DataPinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsGameplayTagContainer(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
-
-		if (WorkData.DataPinResult.Result == EFlowDataPinResolveResult::Success)
-		{
-			return WorkData.DataPinResult;
-		}
-	}
+	return TryResolveDataPinAsViewedType<FGameplayTagContainer, FFlowDataPinResult_GameplayTagContainer>(PinName);
+}
 
-	return WorkData.DataPinResult;
+FFlowDataPinValueView_GameplayTagContainer UFlowNodeBase::TryResolveDataPinViewAsGameplayTagContainer(const FName& PinName) const
+{
+	return TryResolveDataPinViewAsType<FGameplayTagContainer>(PinName);
 }
 
 FFlowDataPinResult_InstancedStruct UFlowNodeBase::TryResolveDataPinAsInstancedStruct(const FName& PinName) const
 {
-	TResolveDataPinWorkingData<FFlowDataPinResult_InstancedStruct, EFlowPinType::InstancedStruct> WorkData;
-	if (!WorkData.TrySetupWorkingData(PinName, *this))
-	{
-		return WorkData.DataPinResult;
-	}
-
-	for (const FFlowPinValueSupplierData& SupplierData : WorkData.PinValueSupplierDatas)
-	{
-		WorkData.DataPinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsInstancedStruct(CastChecked<UObject>(SupplierData.PinValueSupplier), SupplierData.SupplierPinName);
-
-		if (WorkData.DataPinResult.Result == EFlowDataPinResolveResult::Success)
-		{
-			return WorkData.DataPinResult;
-		}
-	}
+	return TryResolveDataPinAsViewedType<FInstancedStruct, FFlowDataPinResult_InstancedStruct>(PinName);
+}
 
-	return WorkData.DataPinResult;
+FFlowDataPinValueView_InstancedStruct UFlowNodeBase::TryResolveDataPinViewAsInstancedStruct(const FName& PinName) const
+{
+	return TryResolveDataPinViewAsType<FInstancedStruct>(PinName);
 }
 
 FFlowDataPinResult_Object UFlowNodeBase::TryResolveDataPinAsObject(const FName& PinName) const
@@ -39,6 +39,19 @@ bool UFlowNode_DefineProperties::TryFindPropertyByRemappedPinName(
 	return Super::TryFindPropertyByRemappedPinName(RemappedPinName, OutFoundProperty, OutFoundInstancedStruct, InOutResult);
 }
 
+const TInstancedStruct<FFlowDataPinProperty>* UFlowNode_DefineProperties::FindDataPinPropertyInstancedStruct(const FName& RemappedPinName) const
+{
+	for (const FFlowNamedDataPinProperty& NamedProperty : NamedProperties)
+	{
+		if (NamedProperty.Name == RemappedPinName && NamedProperty.IsValid())
+		{
+			return &NamedProperty.DataPinProperty;
+		}
+	}
+
+	return Super::FindDataPinPropertyInstancedStruct(RemappedPinName);
+}
+
 #if WITH_EDITOR
 void UFlowNode_DefineProperties::AutoGenerateDataPins(TMap<FName, FName>& PinNameToBoundPropertyMap, TArray<FFlowPin>& InputDataPins, TArray<FFlowPin>& OutputDataPins) const
 {
@@ -271,3 +271,63 @@ FFlowDataPinResult_Class UFlowNode_Start::TrySupplyDataPinAsClass_Implementation
 
 	return Super::TrySupplyDataPinAsClass_Implementation(PinName);
 }
+
+FFlowDataPinValueView_Name UFlowNode_Start::TrySupplyDataPinViewAsName(const FName& PinName) const
+{
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// External supplier takes precedence, so let the copying path handle it unless it exposes the value natively
+		const IFlowDataPinValueSupplierInterface* NativeSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		return NativeSupplier ? NativeSupplier->TrySupplyDataPinViewAsName(PinName) : FFlowDataPinValueView_Name();
+	}
+
+	return Super::TrySupplyDataPinViewAsName(PinName);
+}
+
+FFlowDataPinValueView_String UFlowNode_Start::TrySupplyDataPinViewAsString(const FName& PinName) const
+{
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// External supplier takes precedence, so let the copying path handle it unless it exposes the value natively
+		const IFlowDataPinValueSupplierInterface* NativeSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		return NativeSupplier ? NativeSupplier->TrySupplyDataPinViewAsString(PinName) : FFlowDataPinValueView_String();
+	}
+
+	return Super::TrySupplyDataPinViewAsString(PinName);
+}
+
+FFlowDataPinValueView_Text UFlowNode_Start::TrySupplyDataPinViewAsText(const FName& PinName) const
+{
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// External supplier takes precedence, so let the copying path handle it unless it exposes the value natively
+		const IFlowDataPinValueSupplierInterface* NativeSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		return NativeSupplier ? NativeSupplier->TrySupplyDataPinViewAsText(PinName) : FFlowDataPinValueView_Text();
+	}
+
+	return Super::TrySupplyDataPinViewAsText(PinName);
+}
+
+FFlowDataPinValueView_GameplayTagContainer UFlowNode_Start::TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const
+{
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// External supplier takes precedence, so let the copying path handle it unless it exposes the value natively
+		const IFlowDataPinValueSupplierInterface* NativeSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		return NativeSupplier ? NativeSupplier->TrySupplyDataPinViewAsGameplayTagContainer(PinName) : FFlowDataPinValueView_GameplayTagContainer();
+	}
+
+	return Super::TrySupplyDataPinViewAsGameplayTagContainer(PinName);
+}
+
+FFlowDataPinValueView_InstancedStruct UFlowNode_Start::TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const
+{
+	if (FlowDataPinValueSupplierInterface)
+	{
+		// External supplier takes precedence, so let the copying path handle it unless it exposes the value natively
+		const IFlowDataPinValueSupplierInterface* NativeSupplier = FlowDataPinValueSupplierInterface.GetInterface();
+		return NativeSupplier ? NativeSupplier->TrySupplyDataPinViewAsInstancedStruct(PinName) : FFlowDataPinValueView_InstancedStruct();
+	}
+
+	return Super::TrySupplyDataPinViewAsInstancedStruct(PinName);
+}
@@ -25,6 +25,10 @@ class UFlowAsset;
 #if !UE_BUILD_SHIPPING
 DECLARE_DELEGATE(FFlowGraphEvent);
 DECLARE_DELEGATE_TwoParams(FFlowSignalEvent, const FGuid& /*NodeGuid*/, const FName& /*PinName*/);
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FFlowInstanceDebugEvent, const UFlowAsset* /*Instance*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FFlowNodeDebugEvent, const UFlowNode* /*Node*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FFlowPinDebugEvent, const UFlowNode* /*Node*/, const FName& /*PinName*/, const EEdGraphPinDirection /*Direction*/);
 #endif
 
 // Working Data struct for the Harvest Data Pins operation
@@ -74,6 +78,7 @@ public:
 	friend class FFlowAssetDetails;
 	friend class FFlowNode_SubGraphDetails;
 	friend class UFlowGraphSchema;
+	friend class FFlowRemoteDebugClient;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flow Asset")
 	FGuid AssetGuid;
@@ -400,6 +405,14 @@ protected:
 #if !UE_BUILD_SHIPPING
 public:	
 	FFlowSignalEvent OnPinTriggered;
+
+	// Execution events of all instances, available also in packaged builds, i.e. for the remote debugger
+	// Broadcasted only if anything is bound, so these cost nothing if no debugging tool listens
+	static FFlowInstanceDebugEvent OnInstanceStartedDebug;
+	static FFlowInstanceDebugEvent OnInstanceFinishedDebug;
+	static FFlowNodeDebugEvent OnNodeActivatedDebug;
+	static FFlowNodeDebugEvent OnNodeFinishedDebug;
+	static FFlowPinDebugEvent OnPinTriggeredDebug;
 #endif
 	
 public:
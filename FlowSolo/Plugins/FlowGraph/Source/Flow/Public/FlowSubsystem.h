@@ -7,6 +7,7 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "FlowComponent.h"
+#include "Types/FlowEntityHandle.h"
 #include "FlowSubsystem.generated.h"
 
 class UFlowAsset;
@@ -18,10 +19,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTaggedFlowComponentEvent, UFlowCom
 
 DECLARE_DELEGATE_OneParam(FNativeFlowAssetEvent, class UFlowAsset*);
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FSimpleFlowEntityEvent, const FFlowEntityHandle&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FTaggedFlowEntityEvent, const FFlowEntityHandle&, const FGameplayTagContainer&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FFlowEntityNotify, const FFlowEntityHandle&, const FGameplayTag&);
+
 /**
  * Flow Subsystem
  * - manages lifetime of Flow Graphs
  * - connects Flow Graphs with actors containing the Flow Component
+ * - connects Flow Graphs with lightweight entities registered by handle, i.e. crowd agents
  * - convenient base for project-specific systems
  */
 UCLASS()
@@ -49,6 +55,13 @@ private:
 	UPROPERTY()
 	TMap<TObjectPtr<UFlowNode_SubGraph>, TObjectPtr<UFlowAsset>> InstancedSubFlows;
 
+	/* Assets instanced for non-UObject entities, these instances have no UObject Owner */
+	UPROPERTY()
+	TMap<TObjectPtr<UFlowAsset>, FFlowEntityHandle> EntityRootInstances;
+
+	/* Reverse index of EntityRootInstances, instances are kept alive by the map above */
+	TMultiMap<FFlowEntityHandle, UFlowAsset*> EntityRootInstancesByEntity;
+
 #if !UE_BUILD_SHIPPING
 public:
 	/* Called after creating the first instance of given Flow Asset */
@@ -431,4 +444,84 @@ public:
 private:
 	void FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
 	void FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Entity Registry
+// Counterpart of the Component Registry for owners that aren't UObjects, i.e. thousands of crowd agents
+// Entities are registered by handle with their Identity Tags, no actor or component is required
+
+protected:
+	/* Identity Tags of every registered entity */
+	TMap<FFlowEntityHandle, FGameplayTagContainer> EntityIdentityTags;
+
+	/* All the entities currently registered, keyed by Identity Tag */
+	TMultiMap<FGameplayTag, FFlowEntityHandle> FlowEntityRegistry;
+
+public:
+	virtual void RegisterEntity(const FFlowEntityHandle& Entity, const FGameplayTagContainer& IdentityTags);
+	virtual void UnregisterEntity(const FFlowEntityHandle& Entity, const EFlowFinishPolicy FinishPolicy = EFlowFinishPolicy::Abort);
+
+	virtual void AddEntityIdentityTags(const FFlowEntityHandle& Entity, const FGameplayTagContainer& AddedTags);
+	virtual void RemoveEntityIdentityTags(const FFlowEntityHandle& Entity, const FGameplayTagContainer& RemovedTags);
+
+	bool IsEntityRegistered(const FFlowEntityHandle& Entity) const { return EntityIdentityTags.Contains(Entity); }
+	const FGameplayTagContainer& GetEntityIdentityTags(const FFlowEntityHandle& Entity) const;
+	int32 GetNumRegisteredEntities() const { return EntityIdentityTags.Num(); }
+
+	/* Called after entity has been registered, even if none of its Identity Tags were valid */
+	FSimpleFlowEntityEvent OnEntityRegistered;
+
+	/* Called after adding Identity Tags to already registered entity */
+	FTaggedFlowEntityEvent OnEntityTagAdded;
+
+	/* Called after entity has been removed from the registry */
+	FSimpleFlowEntityEvent OnEntityUnregistered;
+
+	/* Called after removing Identity Tags from the entity, entity stays registered even if no Identity Tags remain */
+	FTaggedFlowEntityEvent OnEntityTagRemoved;
+
+	/**
+	 * Returns all registered entities identified by given tag
+	 * 
+	 * @param Tag Tag to check if it matches Identity Tags of registered entities
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 */
+	void FindEntities(const FGameplayTag& Tag, const bool bExactMatch, TArray<FFlowEntityHandle>& OutEntities) const;
+
+	/**
+	 * Returns all registered entities identified by Any or All provided tags
+	 * 
+	 * @param Tags Container to check if it matches Identity Tags of registered entities
+	 * @param MatchType If Any, returned entity needs to have only one of given tags. If All, entity needs to have all given Identity Tags
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 */
+	void FindEntities(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<FFlowEntityHandle>& OutEntities) const;
+
+	/* Start the root Flow owned by the entity, the instance won't have a UObject Owner
+	 * Entity-owned instances aren't included in SaveGame/LoadGame, crowd logic should restart them after loading */
+	virtual void StartEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances = true);
+	virtual UFlowAsset* CreateEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances = true);
+
+	virtual void FinishEntityRootFlow(const FFlowEntityHandle& Entity, UFlowAsset* TemplateAsset, const EFlowFinishPolicy FinishPolicy);
+	virtual void FinishAllEntityRootFlows(const FFlowEntityHandle& Entity, const EFlowFinishPolicy FinishPolicy);
+
+	TSet<UFlowAsset*> GetEntityRootInstances(const FFlowEntityHandle& Entity) const;
+
+	/* Returns entity owning given instance or its root instance, if instance has been created by Sub Graph node */
+	FFlowEntityHandle GetEntityOwner(const UFlowAsset* FlowInstance) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Entity notifies
+
+	/* Send notification from the entity to Flow graphs */
+	void NotifyGraphFromEntity(const FFlowEntityHandle& Entity, const FGameplayTag& NotifyTag);
+
+	/* Send notifications from Flow graph to all entities identified by Any or All provided tags */
+	void NotifyEntitiesFromGraph(const FGameplayTagContainer& IdentityTags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const FGameplayTagContainer& NotifyTags);
+
+	/* Entity sent notification to Flow graphs */
+	FFlowEntityNotify OnNotifyFromEntity;
+
+	/* Flow graph sent notification to the entity, crowd logic should listen to this */
+	FFlowEntityNotify OnEntityReceiveNotify;
 };
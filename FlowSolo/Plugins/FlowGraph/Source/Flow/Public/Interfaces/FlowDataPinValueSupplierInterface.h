@@ -105,4 +105,14 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = DataPins, DisplayName = "Try Supply DataPin As Class")
 	FFlowDataPinResult_Class TrySupplyDataPinAsClass(const FName& PinName) const;
 	virtual FFlowDataPinResult_Class TrySupplyDataPinAsClass_Implementation(const FName& PinName) const { return FFlowDataPinResult_Class(); }
+
+	// Native-only, zero-copy variants of TrySupplyDataPinAs...() for heavy types
+	// Supplier returns a view of memory it owns, valid for as long as the supplier's property isn't changed
+	// Any failed result makes the resolver fall back to the copying TrySupplyDataPinAs...() function,
+	// so suppliers overriding TrySupplyDataPinAs...() should return FailedUnimplemented here for values they compute
+	virtual FFlowDataPinValueView_Name TrySupplyDataPinViewAsName(const FName& PinName) const { return FFlowDataPinValueView_Name(); }
+	virtual FFlowDataPinValueView_String TrySupplyDataPinViewAsString(const FName& PinName) const { return FFlowDataPinValueView_String(); }
+	virtual FFlowDataPinValueView_Text TrySupplyDataPinViewAsText(const FName& PinName) const { return FFlowDataPinValueView_Text(); }
+	virtual FFlowDataPinValueView_GameplayTagContainer TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const { return FFlowDataPinValueView_GameplayTagContainer(); }
+	virtual FFlowDataPinValueView_InstancedStruct TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const { return FFlowDataPinValueView_InstancedStruct(); }
 };
@@ -81,6 +81,12 @@ public:
 	virtual FFlowDataPinResult_InstancedStruct TrySupplyDataPinAsInstancedStruct_Implementation(const FName& PinName) const override;
 	virtual FFlowDataPinResult_Object TrySupplyDataPinAsObject_Implementation(const FName& PinName) const override;
 	virtual FFlowDataPinResult_Class TrySupplyDataPinAsClass_Implementation(const FName& PinName) const override;
+
+	virtual FFlowDataPinValueView_Name TrySupplyDataPinViewAsName(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_String TrySupplyDataPinViewAsString(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_Text TrySupplyDataPinViewAsText(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_GameplayTagContainer TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_InstancedStruct TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const override;
 	// --
 
 #if WITH_EDITOR
@@ -118,6 +124,10 @@ protected:
 	UActorComponent* GetResolvedComponent() const;
 	TSubclassOf<AActor> TryGetExpectedActorOwnerClass() const;
 
+	// UFlowNode
+	virtual bool CanSupplyDataPinValueViews() const override { return true; }
+	// --
+
 protected:
 
 	// Executable Component (by name) on the expected Flow owning Actor
@@ -9,6 +9,7 @@
 
 /**
  * Finds all Flow Components with matching Identity Tag and calls ReceiveNotify event on these components
+ * Registered Flow entities with matching Identity Tag receive the notify via Flow Subsystem
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "Notify Actor", Keywords = "event"))
 class FLOW_API UFlowNode_NotifyActor : public UFlowNode
@@ -3,10 +3,12 @@
 #pragma once
 
 #include "Nodes/Actor/FlowNode_ComponentObserver.h"
+#include "Types/FlowEntityHandle.h"
 #include "FlowNode_OnNotifyFromActor.generated.h"
 
 /**
  * Triggers output when Flow Component with matching Identity Tag calls NotifyGraph function with matching Notify Tag
+ * Notifies sent by Flow entities with matching Identity Tag are accepted as well
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "On Notify From Actor"))
 class FLOW_API UFlowNode_OnNotifyFromActor : public UFlowNode_ComponentObserver
@@ -25,7 +27,11 @@ protected:
 	virtual void ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
 	virtual void ForgetActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
 
+	virtual void StartObserving() override;
+	virtual void StopObserving() override;
+
 	virtual void OnNotifyFromComponent(UFlowComponent* Component, const FGameplayTag& Tag);
+	virtual void OnNotifyFromEntity(const FFlowEntityHandle& Entity, const FGameplayTag& Tag);
 	
 #if WITH_EDITOR
 public:
@@ -32,6 +32,7 @@ class FLOW_API UFlowNode
 	friend class UFlowNodeAddOn;
 	friend class SFlowInputPinHandle;
 	friend class SFlowOutputPinHandle;
+	friend class FFlowRemoteDebugClient;
 
 //////////////////////////////////////////////////////////////////////////
 // Node
@@ -252,6 +253,12 @@ public:
 	virtual FFlowDataPinResult_Object TrySupplyDataPinAsObject_Implementation(const FName& PinName) const override;
 	virtual FFlowDataPinResult_Class TrySupplyDataPinAsClass_Implementation(const FName& PinName) const override;
 
+	virtual FFlowDataPinValueView_Name TrySupplyDataPinViewAsName(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_String TrySupplyDataPinViewAsString(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_Text TrySupplyDataPinViewAsText(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_GameplayTagContainer TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_InstancedStruct TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const override;
+
 	bool TryGetFlowDataPinSupplierDatasForPinName(
 		const FName& PinName,
 		TArray<FFlowPinValueSupplierData>& InOutPinValueSupplierDatas) const;
@@ -271,6 +278,17 @@ protected:
 		TInstancedStruct<FFlowDataPinProperty>& OutFoundInstancedStruct,
 		EFlowDataPinResolveResult& InOutResult) const;
 
+	// Returns the wrapper stored in place by this node for the given property, if any (i.e. Define Properties node)
+	// Used by TrySupplyDataPinViewAs...() functions, as TryFindPropertyByRemappedPinName returns a copy of it
+	virtual const TInstancedStruct<FFlowDataPinProperty>* FindDataPinPropertyInstancedStruct(const FName& RemappedPinName) const { return nullptr; }
+
+	// Nodes opt in to supplying heavy values as zero-copy views of their properties
+	// Native overrides of TrySupplyDataPinAs...() can't be detected, so a node computing any values natively must keep it disabled
+	virtual bool CanSupplyDataPinValueViews() const { return false; }
+
+	// Blueprint overrides of TrySupplyDataPinAs...() take precedence over zero-copy views of node's properties
+	bool IsDataPinSupplyFunctionImplementedInScript(const FName& FunctionName) const;
+
 	// Functions to supply the pin data value from a variety of supported property types
 	template <typename TFlowDataPinResultType, typename TFlowDataPinProperty, typename TFieldPropertyType>
 	TFlowDataPinResultType TrySupplyDataPinAsType(const FName& PinName) const;
@@ -299,6 +317,10 @@ protected:
 		typename TFieldPropertyObjectType0, typename TFieldPropertySoftObjectType1>
 	TFlowDataPinResultType TrySupplyDataPinAsUClassType(const FName& PinName) const;
 
+	// Views the pin value in place, only if the property type matches exactly (conversions are left to copying functions)
+	template <typename TValue, typename TFlowDataPinProperty, typename TFieldPropertyType>
+	TFlowDataPinValueView<TValue> TrySupplyDataPinViewAsType(const FName& PinName, const FName& SupplyFunctionName) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Debugger
 
@@ -907,3 +929,61 @@ TFlowDataPinResultType UFlowNode::TrySupplyDataPinAsUClassType(const FName& PinN
 	const FProperty* FoundProperty = nullptr;
 	return TrySupplyDataPinAsUObjectTypeCommon<TFlowDataPinResultType, TFlowDataPinProperty, TUObjectType, TFieldPropertyObjectType0, TFieldPropertySoftObjectType1>(PinName, FoundProperty);
 }
+
+template <typename TValue, typename TFlowDataPinProperty, typename TFieldPropertyType>
+TFlowDataPinValueView<TValue> UFlowNode::TrySupplyDataPinViewAsType(const FName& PinName, const FName& SupplyFunctionName) const
+{
+	if (!CanSupplyDataPinValueViews() || IsDataPinSupplyFunctionImplementedInScript(SupplyFunctionName))
+	{
+		return TFlowDataPinValueView<TValue>(EFlowDataPinResolveResult::FailedUnimplemented);
+	}
+
+	const FName* RemappedPinName = PinNameToBoundPropertyNameMap.Find(PinName);
+	if (!RemappedPinName)
+	{
+		return TFlowDataPinValueView<TValue>(EFlowDataPinResolveResult::FailedUnknownPin);
+	}
+
+	if (const TInstancedStruct<FFlowDataPinProperty>* InstancedStruct = FindDataPinPropertyInstancedStruct(*RemappedPinName))
+	{
+		if (const TFlowDataPinProperty* FlowDataPinProp = InstancedStruct->GetPtr<TFlowDataPinProperty>())
+		{
+			return TFlowDataPinValueView<TValue>(FlowDataPinProp->Value);
+		}
+
+		return TFlowDataPinValueView<TValue>(EFlowDataPinResolveResult::FailedMismatchedType);
+	}
+
+	const FProperty* FoundProperty = GetClass()->FindPropertyByName(*RemappedPinName);
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(FoundProperty))
+	{
+		// Struct-based wrapper for the property
+		if (StructProperty->Struct == TFlowDataPinProperty::StaticStruct())
+		{
+			return TFlowDataPinValueView<TValue>(StructProperty->ContainerPtrToValuePtr<TFlowDataPinProperty>(this)->Value);
+		}
+
+		// UE struct (non-wrapper) property type
+		if constexpr (std::is_same_v<TFieldPropertyType, FStructProperty>)
+		{
+			if (StructProperty->Struct == TBaseStructure<TValue>::Get())
+			{
+				return TFlowDataPinValueView<TValue>(*StructProperty->ContainerPtrToValuePtr<TValue>(this));
+			}
+		}
+
+		return TFlowDataPinValueView<TValue>(EFlowDataPinResolveResult::FailedMismatchedType);
+	}
+
+	// UE simple property type
+	if constexpr (!std::is_same_v<TFieldPropertyType, FStructProperty>)
+	{
+		if (const TFieldPropertyType* UnrealProperty = CastField<TFieldPropertyType>(FoundProperty))
+		{
+			return TFlowDataPinValueView<TValue>(*UnrealProperty->template ContainerPtrToValuePtr<TValue>(this));
+		}
+	}
+
+	return TFlowDataPinValueView<TValue>(EFlowDataPinResolveResult::FailedMismatchedType);
+}
@@ -281,6 +281,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = DataPins, DisplayName = "Try Resolve DataPin As Class")
 	FFlowDataPinResult_Class TryResolveDataPinAsClass(const FName& PinName) const;
 
+	// Zero-copy variants of TryResolveDataPinAs...() for heavy types
+	// Returned view is valid until this node is cleaned up, values are never copied if supplier exposes its own memory
+	FFlowDataPinValueView_Name TryResolveDataPinViewAsName(const FName& PinName) const;
+	FFlowDataPinValueView_String TryResolveDataPinViewAsString(const FName& PinName) const;
+	FFlowDataPinValueView_Text TryResolveDataPinViewAsText(const FName& PinName) const;
+	FFlowDataPinValueView_GameplayTagContainer TryResolveDataPinViewAsGameplayTagContainer(const FName& PinName) const;
+	FFlowDataPinValueView_InstancedStruct TryResolveDataPinViewAsInstancedStruct(const FName& PinName) const;
+
 	// Public only for TResolveDataPinWorkingData's use
 	EFlowDataPinResolveResult TryResolveDataPinPrerequisites(const FName& PinName, const UFlowNode*& FlowNode, const FFlowPin*& FlowPin, EFlowPinType PinType) const;
 
@@ -288,6 +296,29 @@ protected:
 
 	bool TryAddValueToFormatNamedArguments(const FFlowNamedDataPinProperty& NamedDataPinProperty, FFormatNamedArguments& InOutArguments) const;
 
+private:
+
+	// Walks the suppliers of the pin, StoreSuppliedValue keeps values that a supplier could only provide as a copy
+	template <typename TValue, typename TStoreSuppliedValue>
+	TFlowDataPinValueView<TValue> ResolveDataPinValueView(const FName& PinName, TStoreSuppliedValue StoreSuppliedValue) const;
+
+	template <typename TValue>
+	TFlowDataPinValueView<TValue> TryResolveDataPinViewAsType(const FName& PinName) const;
+
+	// Copying path of heavy types, a thin wrapper over the view that never touches the scratch storage
+	template <typename TValue, typename TFlowDataPinResultType>
+	TFlowDataPinResultType TryResolveDataPinAsViewedType(const FName& PinName) const;
+
+	FFlowDataPinValueScratch& GetDataPinValueScratch() const;
+
+	// Holds values resolved as views, if the supplier couldn't expose them without a copy
+	// Allocated on first use and released on Cleanup
+	mutable TUniquePtr<FFlowDataPinValueScratch> DataPinValueScratch;
+
+public:
+	// Reports objects referenced by instanced structs held in the scratch storage
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 public:
 
 //////////////////////////////////////////////////////////////////////////
@@ -45,4 +45,6 @@ protected:
 		const FProperty*& OutFoundProperty,
 		TInstancedStruct<FFlowDataPinProperty>& OutFoundInstancedStruct,
 		EFlowDataPinResolveResult& InOutResult) const override;
+	virtual const TInstancedStruct<FFlowDataPinProperty>* FindDataPinPropertyInstancedStruct(const FName& RemappedPinName) const override;
+	virtual bool CanSupplyDataPinValueViews() const override { return true; }
 };
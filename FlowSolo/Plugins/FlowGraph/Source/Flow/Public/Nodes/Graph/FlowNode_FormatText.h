@@ -39,4 +39,8 @@ public:
 	// --
 
 	static const FName OUTPIN_TextOutput;
+
+protected:
+	// Formatted text is computed on demand
+	virtual bool CanSupplyDataPinValueViews() const override { return false; }
 };
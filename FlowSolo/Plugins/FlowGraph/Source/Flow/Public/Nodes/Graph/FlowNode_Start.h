@@ -58,5 +58,11 @@ public:
 	virtual FFlowDataPinResult_InstancedStruct TrySupplyDataPinAsInstancedStruct_Implementation(const FName& PinName) const override;
 	virtual FFlowDataPinResult_Object TrySupplyDataPinAsObject_Implementation(const FName& PinName) const override;
 	virtual FFlowDataPinResult_Class TrySupplyDataPinAsClass_Implementation(const FName& PinName) const override;
+
+	virtual FFlowDataPinValueView_Name TrySupplyDataPinViewAsName(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_String TrySupplyDataPinViewAsString(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_Text TrySupplyDataPinViewAsText(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_GameplayTagContainer TrySupplyDataPinViewAsGameplayTagContainer(const FName& PinName) const override;
+	virtual FFlowDataPinValueView_InstancedStruct TrySupplyDataPinViewAsInstancedStruct(const FName& PinName) const override;
 	// --
 };
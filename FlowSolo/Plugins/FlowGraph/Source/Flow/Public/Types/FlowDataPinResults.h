@@ -4,6 +4,7 @@
 
 #include "GameplayTagContainer.h"
 #include "StructUtils/InstancedStruct.h"
+#include "Templates/UniquePtr.h"
 
 #include "Types/FlowPinEnums.h"
 #include "FlowDataPinResults.generated.h"
@@ -411,3 +412,57 @@ public:
 	FLOW_API UClass* GetOrResolveClass() const { return IsValid(ValueClass) ? ValueClass.Get() : ValuePath.ResolveClass(); }
 	FLOW_API FSoftClassPath GetAsSoftClass() const;
 };
+
+// Non-owning view of a resolved DataPin value, used to resolve heavy payloads without copying them
+// Viewed memory is owned by the supplier node or by the resolving node's scratch storage,
+// so a view must not be kept beyond the current activation of the resolving node
+template <typename TValue>
+struct TFlowDataPinValueView
+{
+	typedef TValue ValueType;
+
+	EFlowDataPinResolveResult Result = EFlowDataPinResolveResult::FailedUnimplemented;
+	const TValue* Value = nullptr;
+
+	TFlowDataPinValueView() { }
+	explicit TFlowDataPinValueView(EFlowDataPinResolveResult InResult) : Result(InResult) { }
+	explicit TFlowDataPinValueView(const TValue& InValue)
+		: Result(EFlowDataPinResolveResult::Success)
+		, Value(&InValue)
+		{ }
+
+	bool IsSuccess() const { return Result == EFlowDataPinResolveResult::Success && Value != nullptr; }
+	const TValue& Get() const { check(Value); return *Value; }
+};
+
+typedef TFlowDataPinValueView<FName> FFlowDataPinValueView_Name;
+typedef TFlowDataPinValueView<FString> FFlowDataPinValueView_String;
+typedef TFlowDataPinValueView<FText> FFlowDataPinValueView_Text;
+typedef TFlowDataPinValueView<FGameplayTagContainer> FFlowDataPinValueView_GameplayTagContainer;
+typedef TFlowDataPinValueView<FInstancedStruct> FFlowDataPinValueView_InstancedStruct;
+
+// Storage for values resolved as views, if the supplier could only provide a copy (i.e. computed or Blueprint-supplied values)
+// Slots are allocated per pin and reused until the owning node is cleaned up, so views remain valid while other pins are resolved
+struct FFlowDataPinValueScratch
+{
+	template <typename TValue>
+	using TSlots = TMap<FName, TUniquePtr<TValue>>;
+
+	TSlots<FName> Names;
+	TSlots<FString> Strings;
+	TSlots<FText> Texts;
+	TSlots<FGameplayTagContainer> GameplayTagContainers;
+	TSlots<FInstancedStruct> InstancedStructs;
+
+	template <typename TValue>
+	static TValue& FindOrAddSlot(TSlots<TValue>& Slots, const FName& PinName)
+	{
+		TUniquePtr<TValue>& Slot = Slots.FindOrAdd(PinName);
+		if (!Slot.IsValid())
+		{
+			Slot = MakeUnique<TValue>();
+		}
+
+		return *Slot;
+	}
+};
@@ -0,0 +1,49 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Templates/TypeHash.h"
+
+#include "FlowEntityHandle.generated.h"
+
+/**
+ * Lightweight, non-UObject owner of Flow Graphs
+ * Allows systems like crowds or Mass to run Flow without spawning a Flow Component per agent
+ * The Id is opaque to Flow, i.e. a caller might pack its own entity index and serial number into it
+ */
+USTRUCT(BlueprintType)
+struct FLOW_API FFlowEntityHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint64 Id = 0;
+
+	FFlowEntityHandle() {}
+
+	explicit FFlowEntityHandle(const uint64 InId)
+		: Id(InId)
+	{
+	}
+
+	FFlowEntityHandle(const uint32 Index, const uint32 SerialNumber)
+		: Id((static_cast<uint64>(SerialNumber) << 32) | Index)
+	{
+	}
+
+	bool IsValid() const { return Id != 0; }
+	void Reset() { Id = 0; }
+
+	uint32 GetIndex() const { return static_cast<uint32>(Id & 0xFFFFFFFF); }
+	uint32 GetSerialNumber() const { return static_cast<uint32>(Id >> 32); }
+
+	FString ToString() const { return FString::Printf(TEXT("FlowEntity_%u_%u"), GetIndex(), GetSerialNumber()); }
+
+	bool operator==(const FFlowEntityHandle& Other) const { return Id == Other.Id; }
+	bool operator!=(const FFlowEntityHandle& Other) const { return Id != Other.Id; }
+
+	friend uint32 GetTypeHash(const FFlowEntityHandle& Handle)
+	{
+		return GetTypeHash(Handle.Id);
+	}
+};
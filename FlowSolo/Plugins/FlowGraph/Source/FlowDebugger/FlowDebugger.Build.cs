@@ -19,8 +19,10 @@ public class FlowDebugger : ModuleRules
 			"CoreUObject",
 			"DeveloperSettings",
 			"Engine",
+			"Networking",
 			"Slate",
 			"SlateCore",
+			"Sockets"
 		});
 	}
 }
\ No newline at end of file
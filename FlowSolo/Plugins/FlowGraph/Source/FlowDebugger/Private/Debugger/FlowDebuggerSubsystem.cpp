@@ -34,18 +34,33 @@ bool UFlowDebuggerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 	return true;
 }
 
+void UFlowDebuggerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RefreshBreakpointLookup();
+}
+
 void UFlowDebuggerSubsystem::OnInstancedTemplateAdded(UFlowAsset* AssetTemplate)
 {
-	AssetTemplate->OnPinTriggered.BindUObject(this, &ThisClass::OnPinTriggered);
+	InstancedTemplates.AddUnique(AssetTemplate);
+	UpdatePinTriggeredBinding(AssetTemplate);
 }
 
-void UFlowDebuggerSubsystem::OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate) const
+void UFlowDebuggerSubsystem::OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate)
 {
+	InstancedTemplates.Remove(AssetTemplate);
 	AssetTemplate->OnPinTriggered.Unbind();
 }
 
 void UFlowDebuggerSubsystem::OnPinTriggered(const FGuid& NodeGuid, const FName& PinName)
 {
+	// Template might contain breakpoints only on a few nodes
+	if (!NodesWithBreakpoints.Contains(NodeGuid))
+	{
+		return;
+	}
+
 	if (FindBreakpoint(NodeGuid, PinName))
 	{
 		MarkAsHit(NodeGuid, PinName);
@@ -348,8 +363,70 @@ bool UFlowDebuggerSubsystem::IsBreakpointHit(const FGuid& NodeGuid, const FName&
 	return false;
 }
 
+void UFlowDebuggerSubsystem::RefreshBreakpointLookup()
+{
+	const UFlowDebuggerSettings* Settings = GetDefault<UFlowDebuggerSettings>();
+
+	NodesWithBreakpoints.Reset();
+	for (const TPair<FGuid, FNodeBreakpoint>& NodeBreakpoint : Settings->NodeBreakpoints)
+	{
+		bool bAnyEnabled = NodeBreakpoint.Value.Breakpoint.IsActive() && NodeBreakpoint.Value.Breakpoint.IsEnabled();
+		for (const TPair<FName, FFlowBreakpoint>& PinBreakpoint : NodeBreakpoint.Value.PinBreakpoints)
+		{
+			bAnyEnabled |= PinBreakpoint.Value.IsEnabled();
+		}
+
+		if (bAnyEnabled)
+		{
+			NodesWithBreakpoints.Add(NodeBreakpoint.Key);
+		}
+	}
+
+	for (int32 Index = InstancedTemplates.Num() - 1; Index >= 0; --Index)
+	{
+		if (UFlowAsset* AssetTemplate = InstancedTemplates[Index].Get())
+		{
+			UpdatePinTriggeredBinding(AssetTemplate);
+		}
+		else
+		{
+			InstancedTemplates.RemoveAtSwap(Index);
+		}
+	}
+}
+
+void UFlowDebuggerSubsystem::UpdatePinTriggeredBinding(UFlowAsset* AssetTemplate)
+{
+	bool bHasBreakpoints = false;
+	if (NodesWithBreakpoints.Num() > 0)
+	{
+		for (const TPair<FGuid, UFlowNode*>& Node : AssetTemplate->GetNodes())
+		{
+			if (NodesWithBreakpoints.Contains(Node.Key))
+			{
+				bHasBreakpoints = true;
+				break;
+			}
+		}
+	}
+
+	if (bHasBreakpoints)
+	{
+		if (!AssetTemplate->OnPinTriggered.IsBoundToObject(this))
+		{
+			AssetTemplate->OnPinTriggered.BindUObject(this, &ThisClass::OnPinTriggered);
+		}
+	}
+	else
+	{
+		AssetTemplate->OnPinTriggered.Unbind();
+	}
+}
+
 void UFlowDebuggerSubsystem::SaveSettings()
 {
 	UFlowDebuggerSettings* Settings = GetMutableDefault<UFlowDebuggerSettings>();
 	Settings->SaveConfig();
+
+	RefreshBreakpointLookup();
 }
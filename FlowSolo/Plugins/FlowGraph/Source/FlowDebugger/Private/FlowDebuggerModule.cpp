@@ -1,17 +1,26 @@
 ﻿// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
 
 #include "FlowDebuggerModule.h"
+#include "RemoteDebugger/FlowRemoteDebugServer.h"
 
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "Modules/ModuleManager.h"
 
 #define LOCTEXT_NAMESPACE "FlowDebuggerModule"
 
 void FFlowDebuggerModule::StartupModule()
 {
+	uint16 Port = FlowRemoteDebug::DefaultPort;
+	if (FParse::Value(FCommandLine::Get(), TEXT("FlowRemoteDebugPort="), Port) || FParse::Param(FCommandLine::Get(), TEXT("FlowRemoteDebug")))
+	{
+		RemoteDebugServer = MakeUnique<FFlowRemoteDebugServer>(Port);
+	}
 }
 
 void FFlowDebuggerModule::ShutdownModule()
 {
+	RemoteDebugServer.Reset();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,341 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "RemoteDebugger/FlowRemoteDebugServer.h"
+
+#include "FlowAsset.h"
+#include "FlowLogChannels.h"
+#include "Nodes/FlowNode.h"
+
+#include "Common/TcpListener.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Serialization/MemoryWriter.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+FFlowRemoteDebugServer::FFlowRemoteDebugServer(const uint16 Port)
+{
+	Listener = MakeUnique<FTcpListener>(FIPv4Endpoint(FIPv4Address::InternalLoopback, Port));
+	if (Listener->IsActive())
+	{
+		Listener->OnConnectionAccepted().BindRaw(this, &FFlowRemoteDebugServer::OnConnectionAccepted);
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FFlowRemoteDebugServer::Tick));
+
+		UE_LOG(LogFlow, Log, TEXT("Flow Remote Debugger listening on port %d"), Port);
+	}
+	else
+	{
+		UE_LOG(LogFlow, Warning, TEXT("Flow Remote Debugger failed to listen on port %d"), Port);
+		Listener.Reset();
+	}
+}
+
+FFlowRemoteDebugServer::~FFlowRemoteDebugServer()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	// Stops the listener thread before touching the accepted socket
+	Listener.Reset();
+
+	DisconnectClient();
+
+	if (AcceptedSocket)
+	{
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(AcceptedSocket);
+		AcceptedSocket = nullptr;
+	}
+}
+
+bool FFlowRemoteDebugServer::OnConnectionAccepted(FSocket* Socket, const FIPv4Endpoint& Endpoint)
+{
+	FScopeLock Lock(&AcceptedSocketLock);
+
+	// Only single client is supported, game thread takes ownership of the socket on the next tick
+	if (AcceptedSocket || IsClientConnected())
+	{
+		return false;
+	}
+
+	AcceptedSocket = Socket;
+	return true;
+}
+
+bool FFlowRemoteDebugServer::Tick(float DeltaTime)
+{
+	if (!IsClientConnected())
+	{
+		FSocket* Socket = nullptr;
+		{
+			FScopeLock Lock(&AcceptedSocketLock);
+			Swap(Socket, AcceptedSocket);
+		}
+
+		if (Socket)
+		{
+			ConnectClient(Socket);
+		}
+	}
+
+	if (IsClientConnected())
+	{
+		FlushBatch();
+
+		if (ClientSocket->GetConnectionState() != SCS_Connected || !SendPending())
+		{
+			DisconnectClient();
+		}
+	}
+
+	return true;
+}
+
+void FFlowRemoteDebugServer::ConnectClient(FSocket* Socket)
+{
+	ClientSocket = Socket;
+	ClientSocket->SetNonBlocking(true);
+
+	NameIds.Reset();
+	AnnouncedInstances.Reset();
+	UnreportedFinishedInstances.Reset();
+	DroppedEvents = 0;
+	PendingSendOffset = 0;
+
+	{
+		FMemoryWriter Writer(PendingSend);
+		uint32 Magic = FlowRemoteDebug::Magic;
+		uint32 ProtocolVersion = FlowRemoteDebug::ProtocolVersion;
+		Writer << Magic << ProtocolVersion;
+	}
+
+	InstanceStartedHandle = UFlowAsset::OnInstanceStartedDebug.AddRaw(this, &FFlowRemoteDebugServer::OnInstanceStarted);
+	InstanceFinishedHandle = UFlowAsset::OnInstanceFinishedDebug.AddRaw(this, &FFlowRemoteDebugServer::OnInstanceFinished);
+	NodeActivatedHandle = UFlowAsset::OnNodeActivatedDebug.AddRaw(this, &FFlowRemoteDebugServer::OnNodeActivated);
+	NodeFinishedHandle = UFlowAsset::OnNodeFinishedDebug.AddRaw(this, &FFlowRemoteDebugServer::OnNodeFinished);
+	PinTriggeredHandle = UFlowAsset::OnPinTriggeredDebug.AddRaw(this, &FFlowRemoteDebugServer::OnPinTriggered);
+
+	UE_LOG(LogFlow, Log, TEXT("Flow Remote Debugger client connected"));
+}
+
+void FFlowRemoteDebugServer::DisconnectClient()
+{
+	if (ClientSocket == nullptr)
+	{
+		return;
+	}
+
+	UFlowAsset::OnInstanceStartedDebug.Remove(InstanceStartedHandle);
+	UFlowAsset::OnInstanceFinishedDebug.Remove(InstanceFinishedHandle);
+	UFlowAsset::OnNodeActivatedDebug.Remove(NodeActivatedHandle);
+	UFlowAsset::OnNodeFinishedDebug.Remove(NodeFinishedHandle);
+	UFlowAsset::OnPinTriggeredDebug.Remove(PinTriggeredHandle);
+
+	ClientSocket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ClientSocket);
+	ClientSocket = nullptr;
+
+	Batch.Empty();
+	PendingSend.Empty();
+	PendingSendOffset = 0;
+	NameIds.Empty();
+	AnnouncedInstances.Empty();
+	UnreportedFinishedInstances.Empty();
+
+	UE_LOG(LogFlow, Log, TEXT("Flow Remote Debugger client disconnected"));
+}
+
+void FFlowRemoteDebugServer::OnInstanceStarted(const UFlowAsset* Instance)
+{
+	if (CanWriteEvent())
+	{
+		GetInstanceId(Instance);
+	}
+}
+
+void FFlowRemoteDebugServer::OnInstanceFinished(const UFlowAsset* Instance)
+{
+	const uint32 InstanceId = Instance->GetUniqueID();
+	if (!AnnouncedInstances.Contains(InstanceId))
+	{
+		return;
+	}
+
+	if (CanWriteEvent())
+	{
+		WriteInstanceFinished(InstanceId);
+	}
+	else
+	{
+		// client would keep the proxy forever
+		UnreportedFinishedInstances.Add(InstanceId);
+	}
+
+	AnnouncedInstances.Remove(InstanceId);
+}
+
+void FFlowRemoteDebugServer::OnNodeActivated(const UFlowNode* Node)
+{
+	if (CanWriteEvent())
+	{
+		uint32 InstanceId = GetInstanceId(Node->GetFlowAsset());
+		FGuid NodeGuid = Node->GetGuid();
+
+		FMemoryWriter Writer(Batch, false, true);
+		uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::NodeActivated);
+		Writer << Event << InstanceId << NodeGuid;
+	}
+}
+
+void FFlowRemoteDebugServer::OnNodeFinished(const UFlowNode* Node)
+{
+	if (CanWriteEvent())
+	{
+		uint32 InstanceId = GetInstanceId(Node->GetFlowAsset());
+		FGuid NodeGuid = Node->GetGuid();
+
+		FMemoryWriter Writer(Batch, false, true);
+		uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::NodeFinished);
+		Writer << Event << InstanceId << NodeGuid;
+	}
+}
+
+void FFlowRemoteDebugServer::OnPinTriggered(const UFlowNode* Node, const FName& PinName, const EEdGraphPinDirection Direction)
+{
+	if (CanWriteEvent())
+	{
+		uint32 InstanceId = GetInstanceId(Node->GetFlowAsset());
+		uint32 PinNameId = GetNameId(PinName);
+		FGuid NodeGuid = Node->GetGuid();
+		uint8 PinDirection = static_cast<uint8>(Direction);
+
+		FMemoryWriter Writer(Batch, false, true);
+		uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::PinTriggered);
+		Writer << Event << InstanceId << NodeGuid << PinNameId << PinDirection;
+	}
+}
+
+bool FFlowRemoteDebugServer::CanWriteEvent()
+{
+	if (Batch.Num() >= FlowRemoteDebug::MaxBatchBytes)
+	{
+		FlushBatch();
+	}
+
+	if (PendingSend.Num() - PendingSendOffset >= FlowRemoteDebug::MaxPendingSendBytes)
+	{
+		++DroppedEvents;
+		return false;
+	}
+
+	if (DroppedEvents > 0)
+	{
+		FMemoryWriter Writer(Batch, false, true);
+		uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::EventsDropped);
+		Writer << Event << DroppedEvents;
+
+		DroppedEvents = 0;
+	}
+
+	if (UnreportedFinishedInstances.Num() > 0)
+	{
+		for (const uint32 InstanceId : UnreportedFinishedInstances)
+		{
+			WriteInstanceFinished(InstanceId);
+		}
+		UnreportedFinishedInstances.Reset();
+	}
+
+	return true;
+}
+
+uint32 FFlowRemoteDebugServer::GetInstanceId(const UFlowAsset* Instance)
+{
+	uint32 InstanceId = Instance->GetUniqueID();
+
+	// Instances started before client connected are announced on their first event
+	bool bAlreadyAnnounced = false;
+	AnnouncedInstances.Add(InstanceId, &bAlreadyAnnounced);
+	if (!bAlreadyAnnounced)
+	{
+		const UFlowAsset* TemplateAsset = Instance->GetTemplateAsset();
+		FString TemplatePath = TemplateAsset ? TemplateAsset->GetPathName() : FString();
+		uint32 InstanceNameId = GetNameId(Instance->GetDisplayName());
+
+		FMemoryWriter Writer(Batch, false, true);
+		uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::InstanceStarted);
+		Writer << Event << InstanceId << TemplatePath << InstanceNameId;
+	}
+
+	return InstanceId;
+}
+
+void FFlowRemoteDebugServer::WriteInstanceFinished(uint32 InstanceId)
+{
+	FMemoryWriter Writer(Batch, false, true);
+	uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::InstanceFinished);
+	Writer << Event << InstanceId;
+}
+
+uint32 FFlowRemoteDebugServer::GetNameId(const FName& Name)
+{
+	if (const uint32* NameId = NameIds.Find(Name))
+	{
+		return *NameId;
+	}
+
+	uint32 NewNameId = NameIds.Num();
+	NameIds.Add(Name, NewNameId);
+
+	FString NameString = Name.ToString();
+
+	FMemoryWriter Writer(Batch, false, true);
+	uint8 Event = static_cast<uint8>(EFlowRemoteDebugEvent::DefineName);
+	Writer << Event << NewNameId << NameString;
+
+	return NewNameId;
+}
+
+void FFlowRemoteDebugServer::FlushBatch()
+{
+	if (Batch.Num() == 0)
+	{
+		return;
+	}
+
+	// compact only once most of the buffer has been sent, instead of shifting it after every send
+	if (PendingSendOffset > 0 && PendingSendOffset >= PendingSend.Num() / 2)
+	{
+		PendingSend.RemoveAt(0, PendingSendOffset, EAllowShrinking::No);
+		PendingSendOffset = 0;
+	}
+
+	FMemoryWriter Writer(PendingSend, false, true);
+	uint32 BatchSize = Batch.Num();
+	Writer << BatchSize;
+	Writer.Serialize(Batch.GetData(), Batch.Num());
+
+	Batch.Reset();
+}
+
+bool FFlowRemoteDebugServer::SendPending()
+{
+	while (PendingSendOffset < PendingSend.Num())
+	{
+		int32 BytesSent = 0;
+		if (!ClientSocket->Send(PendingSend.GetData() + PendingSendOffset, PendingSend.Num() - PendingSendOffset, BytesSent))
+		{
+			// Client doesn't keep up, try again next tick
+			return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+		}
+
+		if (BytesSent <= 0)
+		{
+			return true;
+		}
+
+		PendingSendOffset += BytesSent;
+	}
+
+	PendingSend.Reset();
+	PendingSendOffset = 0;
+
+	return true;
+}
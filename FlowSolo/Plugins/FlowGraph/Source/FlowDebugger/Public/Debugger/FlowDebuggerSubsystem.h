@@ -23,13 +23,25 @@ public:
 	UFlowDebuggerSubsystem();
 
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
 protected:
 	virtual void OnInstancedTemplateAdded(UFlowAsset* AssetTemplate);
-	virtual void OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate) const;
+	virtual void OnInstancedTemplateRemoved(UFlowAsset* AssetTemplate);
 
 	virtual void OnPinTriggered(const FGuid& NodeGuid, const FName& PinName);
 
+	/** Rebuilds the set of nodes with enabled breakpoints and rebinds OnPinTriggered of instanced templates. */
+	virtual void RefreshBreakpointLookup();
+
+	/** OnPinTriggered is bound only if template contains any node with a breakpoint, so other graphs don't pay for debugging. */
+	void UpdatePinTriggeredBinding(UFlowAsset* AssetTemplate);
+
+	TArray<TWeakObjectPtr<UFlowAsset>> InstancedTemplates;
+
+	/** Nodes with any enabled breakpoint, node or pin. */
+	TSet<FGuid> NodesWithBreakpoints;
+
 public:
 	virtual void AddBreakpoint(const FGuid& NodeGuid);
 	virtual void AddBreakpoint(const FGuid& NodeGuid, const FName& PinName);
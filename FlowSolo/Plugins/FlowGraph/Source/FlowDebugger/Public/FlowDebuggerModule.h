@@ -4,9 +4,14 @@
 
 #include "Modules/ModuleInterface.h"
 
+class FFlowRemoteDebugServer;
+
 class FLOWDEBUGGER_API FFlowDebuggerModule : public IModuleInterface
 {
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    TUniquePtr<FFlowRemoteDebugServer> RemoteDebugServer;
 };
@@ -0,0 +1,35 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Wire format of the remote Flow debugger.
+ * Server sends the header once after accepting a client, then a stream of batches: uint32 byte size followed by events.
+ * Every event starts with EFlowRemoteDebugEvent, payloads are serialized with FArchive operators.
+ * Names are sent once per connection as DefineName and referenced by id afterwards.
+ */
+namespace FlowRemoteDebug
+{
+	static constexpr uint32 Magic = 0x574F4C46; // "FLOW"
+	static constexpr uint32 ProtocolVersion = 1;
+	static constexpr uint16 DefaultPort = 27420;
+
+	// Batches are flushed every tick, or earlier if they grow beyond this size
+	static constexpr int32 MaxBatchBytes = 64 * 1024;
+
+	// If the client doesn't keep up, server drops events instead of growing this buffer
+	static constexpr int32 MaxPendingSendBytes = 4 * 1024 * 1024;
+}
+
+enum class EFlowRemoteDebugEvent : uint8
+{
+	DefineName,			// uint32 NameId, FString Name
+	InstanceStarted,	// uint32 InstanceId, FString TemplatePath, uint32 InstanceNameId
+	InstanceFinished,	// uint32 InstanceId
+	NodeActivated,		// uint32 InstanceId, FGuid NodeGuid
+	NodeFinished,		// uint32 InstanceId, FGuid NodeGuid
+	PinTriggered,		// uint32 InstanceId, FGuid NodeGuid, uint32 PinNameId, uint8 EEdGraphPinDirection
+	EventsDropped		// uint32 Count
+};
@@ -0,0 +1,86 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "EdGraph/EdGraphNode.h"
+#include "HAL/CriticalSection.h"
+
+#include "RemoteDebugger/FlowRemoteDebugProtocol.h"
+
+class FSocket;
+class FTcpListener;
+class UFlowAsset;
+class UFlowNode;
+struct FIPv4Endpoint;
+
+/**
+ * Streams Flow execution events to a single out-of-process client, i.e. editor connected to a packaged build.
+ * Listens on the loopback address only, start game with -FlowRemoteDebug or -FlowRemoteDebugPort=<Port>.
+ * Runtime events are bound only while a client is connected, so the server costs nothing otherwise.
+ */
+class FLOWDEBUGGER_API FFlowRemoteDebugServer
+{
+public:
+	explicit FFlowRemoteDebugServer(const uint16 Port = FlowRemoteDebug::DefaultPort);
+	~FFlowRemoteDebugServer();
+
+	bool IsListening() const { return Listener.IsValid(); }
+	bool IsClientConnected() const { return ClientSocket != nullptr; }
+
+private:
+	// Called from the listener thread
+	bool OnConnectionAccepted(FSocket* Socket, const FIPv4Endpoint& Endpoint);
+
+	bool Tick(float DeltaTime);
+
+	void ConnectClient(FSocket* Socket);
+	void DisconnectClient();
+
+	void OnInstanceStarted(const UFlowAsset* Instance);
+	void OnInstanceFinished(const UFlowAsset* Instance);
+	void OnNodeActivated(const UFlowNode* Node);
+	void OnNodeFinished(const UFlowNode* Node);
+	void OnPinTriggered(const UFlowNode* Node, const FName& PinName, const EEdGraphPinDirection Direction);
+
+	// Returns false if event should be dropped, as the client doesn't keep up
+	bool CanWriteEvent();
+
+	uint32 GetInstanceId(const UFlowAsset* Instance);
+	uint32 GetNameId(const FName& Name);
+
+	void WriteInstanceFinished(uint32 InstanceId);
+
+	void FlushBatch();
+	bool SendPending();
+
+	TUniquePtr<FTcpListener> Listener;
+
+	FCriticalSection AcceptedSocketLock;
+	FSocket* AcceptedSocket = nullptr;
+
+	FSocket* ClientSocket = nullptr;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// Events written since the last flush
+	TArray<uint8> Batch;
+
+	// Framed batches not yet accepted by the socket, bytes before PendingSendOffset have been sent already
+	TArray<uint8> PendingSend;
+	int32 PendingSendOffset = 0;
+
+	// Ids are valid per connection
+	TMap<FName, uint32> NameIds;
+	TSet<uint32> AnnouncedInstances;
+
+	// Finished while events were dropped, reported as soon as events can be written again
+	TSet<uint32> UnreportedFinishedInstances;
+
+	uint32 DroppedEvents = 0;
+
+	FDelegateHandle InstanceStartedHandle;
+	FDelegateHandle InstanceFinishedHandle;
+	FDelegateHandle NodeActivatedHandle;
+	FDelegateHandle NodeFinishedHandle;
+	FDelegateHandle PinTriggeredHandle;
+};
@@ -52,6 +52,7 @@ public class FlowEditor : ModuleRules
 			"MovieScene",
 			"MovieSceneTools",
 			"MovieSceneTracks",
+			"Networking",
 			"Projects",
 			"PropertyEditor",
 			"PropertyPath",
@@ -60,6 +61,7 @@ public class FlowEditor : ModuleRules
 			"SequencerCore",
 			"Slate",
 			"SlateCore",
+			"Sockets",
 			"SourceControl",
 			"ToolMenus",
 			"UnrealEd", 
@@ -0,0 +1,330 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Asset/FlowRemoteDebugClient.h"
+#include "FlowEditorLogChannels.h"
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+#include "RemoteDebugger/FlowRemoteDebugProtocol.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/App.h"
+#include "Serialization/MemoryReader.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPath.h"
+
+TUniquePtr<FFlowRemoteDebugClient> FFlowRemoteDebugClient::Client;
+
+namespace FlowRemoteDebug
+{
+	static FAutoConsoleCommand CmdConnect(
+		TEXT("Flow.RemoteDebug.Connect"),
+		TEXT("Connects Flow Asset Editor to a game running with -FlowRemoteDebug. Optional argument: Host:Port, defaults to local host."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FFlowRemoteDebugClient::Connect(Args.Num() > 0 ? Args[0] : FString());
+		}));
+
+	static FAutoConsoleCommand CmdDisconnect(
+		TEXT("Flow.RemoteDebug.Disconnect"),
+		TEXT("Disconnects Flow Asset Editor from the remote game."),
+		FConsoleCommandDelegate::CreateStatic(&FFlowRemoteDebugClient::Disconnect));
+}
+
+bool FFlowRemoteDebugClient::Connect(const FString& Address)
+{
+	Disconnect();
+
+	FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, FlowRemoteDebug::DefaultPort);
+	if (!Address.IsEmpty() && !FIPv4Endpoint::Parse(Address, Endpoint))
+	{
+		UE_LOG(LogFlowEditor, Warning, TEXT("Flow Remote Debugger: invalid address %s, expected Host:Port"), *Address);
+		return false;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	FSocket* NewSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("FlowRemoteDebugClient"), false);
+	if (NewSocket == nullptr)
+	{
+		return false;
+	}
+
+	if (!NewSocket->Connect(*Endpoint.ToInternetAddr()))
+	{
+		UE_LOG(LogFlowEditor, Warning, TEXT("Flow Remote Debugger: failed to connect to %s"), *Endpoint.ToString());
+		SocketSubsystem->DestroySocket(NewSocket);
+		return false;
+	}
+
+	NewSocket->SetNonBlocking(true);
+	Client = TUniquePtr<FFlowRemoteDebugClient>(new FFlowRemoteDebugClient(NewSocket));
+
+	UE_LOG(LogFlowEditor, Log, TEXT("Flow Remote Debugger: connected to %s"), *Endpoint.ToString());
+	return true;
+}
+
+void FFlowRemoteDebugClient::Disconnect()
+{
+	Client.Reset();
+}
+
+FFlowRemoteDebugClient::FFlowRemoteDebugClient(FSocket* InSocket)
+	: Socket(InSocket)
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FFlowRemoteDebugClient::Tick));
+}
+
+FFlowRemoteDebugClient::~FFlowRemoteDebugClient()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	for (const TPair<uint32, TWeakObjectPtr<UFlowAsset>>& ProxyInstance : ProxyInstances)
+	{
+		if (UFlowAsset* Proxy = ProxyInstance.Value.Get())
+		{
+			if (UFlowAsset* TemplateAsset = Proxy->GetTemplateAsset())
+			{
+				TemplateAsset->RemoveInstance(Proxy);
+			}
+		}
+	}
+	ProxyInstances.Empty();
+
+	Socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+}
+
+bool FFlowRemoteDebugClient::Tick(float DeltaTime)
+{
+	uint32 PendingDataSize = 0;
+	while (Socket->HasPendingData(PendingDataSize) && PendingDataSize > 0)
+	{
+		const int32 Offset = ReceiveBuffer.Num();
+		ReceiveBuffer.AddUninitialized(PendingDataSize);
+
+		int32 BytesRead = 0;
+		Socket->Recv(ReceiveBuffer.GetData() + Offset, PendingDataSize, BytesRead);
+		ReceiveBuffer.SetNum(Offset + BytesRead, EAllowShrinking::No);
+	}
+
+	const bool bValidData = ProcessReceivedData();
+	if (!bValidData || Socket->GetConnectionState() != SCS_Connected)
+	{
+		UE_LOG(LogFlowEditor, Log, TEXT("Flow Remote Debugger: disconnected"));
+		bConnectionLost = true;
+
+		// Client can't destroy itself while ticked, tear it down on the next tick unless it has been replaced already
+		const FFlowRemoteDebugClient* LostClient = this;
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([LostClient](float)
+		{
+			if (Client.Get() == LostClient)
+			{
+				Client.Reset();
+			}
+			return false;
+		}));
+
+		return false;
+	}
+
+	return true;
+}
+
+bool FFlowRemoteDebugClient::ProcessReceivedData()
+{
+	int32 Offset = 0;
+
+	if (!bReceivedHeader)
+	{
+		if (ReceiveBuffer.Num() < static_cast<int32>(sizeof(uint32) * 2))
+		{
+			return true;
+		}
+
+		FMemoryReader Reader(ReceiveBuffer);
+		uint32 Magic = 0;
+		uint32 ProtocolVersion = 0;
+		Reader << Magic << ProtocolVersion;
+
+		if (Magic != FlowRemoteDebug::Magic || ProtocolVersion != FlowRemoteDebug::ProtocolVersion)
+		{
+			UE_LOG(LogFlowEditor, Warning, TEXT("Flow Remote Debugger: unsupported server, protocol version %u"), ProtocolVersion);
+			return false;
+		}
+
+		bReceivedHeader = true;
+		Offset = static_cast<int32>(Reader.Tell());
+	}
+
+	while (ReceiveBuffer.Num() - Offset >= static_cast<int32>(sizeof(uint32)))
+	{
+		FMemoryReader SizeReader(ReceiveBuffer);
+		SizeReader.Seek(Offset);
+
+		uint32 BatchSize = 0;
+		SizeReader << BatchSize;
+
+		const int32 BatchOffset = Offset + sizeof(uint32);
+		if (static_cast<uint32>(ReceiveBuffer.Num() - BatchOffset) < BatchSize)
+		{
+			// Batch not fully received yet
+			break;
+		}
+
+		FMemoryReaderView Reader(MakeArrayView(static_cast<const uint8*>(ReceiveBuffer.GetData()) + BatchOffset, static_cast<int32>(BatchSize)));
+		while (!Reader.AtEnd())
+		{
+			if (!ProcessEvent(Reader) || Reader.IsError())
+			{
+				return false;
+			}
+		}
+
+		Offset = BatchOffset + BatchSize;
+	}
+
+	ReceiveBuffer.RemoveAt(0, Offset, EAllowShrinking::No);
+	return true;
+}
+
+bool FFlowRemoteDebugClient::ProcessEvent(FArchive& Reader)
+{
+	auto GetName = [this](const uint32 NameId)
+	{
+		return Names.IsValidIndex(NameId) ? Names[NameId] : NAME_None;
+	};
+
+	uint8 Event = 0;
+	Reader << Event;
+
+	switch (static_cast<EFlowRemoteDebugEvent>(Event))
+	{
+		case EFlowRemoteDebugEvent::DefineName:
+		{
+			uint32 NameId = 0;
+			FString NameString;
+			Reader << NameId << NameString;
+
+			if (NameId != static_cast<uint32>(Names.Num()))
+			{
+				return false;
+			}
+
+			Names.Add(FName(*NameString));
+			break;
+		}
+		case EFlowRemoteDebugEvent::InstanceStarted:
+		{
+			uint32 InstanceId = 0;
+			FString TemplatePath;
+			uint32 InstanceNameId = 0;
+			Reader << InstanceId << TemplatePath << InstanceNameId;
+
+			OnInstanceStarted(InstanceId, TemplatePath, GetName(InstanceNameId));
+			break;
+		}
+		case EFlowRemoteDebugEvent::InstanceFinished:
+		{
+			uint32 InstanceId = 0;
+			Reader << InstanceId;
+
+			OnInstanceFinished(InstanceId);
+			break;
+		}
+		case EFlowRemoteDebugEvent::NodeActivated:
+		case EFlowRemoteDebugEvent::NodeFinished:
+		{
+			uint32 InstanceId = 0;
+			FGuid NodeGuid;
+			Reader << InstanceId << NodeGuid;
+
+			if (UFlowNode* Node = FindProxyNode(InstanceId, NodeGuid))
+			{
+				Node->ActivationState = static_cast<EFlowRemoteDebugEvent>(Event) == EFlowRemoteDebugEvent::NodeActivated ? EFlowNodeState::Active : EFlowNodeState::Completed;
+			}
+			break;
+		}
+		case EFlowRemoteDebugEvent::PinTriggered:
+		{
+			uint32 InstanceId = 0;
+			FGuid NodeGuid;
+			uint32 PinNameId = 0;
+			uint8 PinDirection = 0;
+			Reader << InstanceId << NodeGuid << PinNameId << PinDirection;
+
+			if (UFlowNode* Node = FindProxyNode(InstanceId, NodeGuid))
+			{
+				// Records use local time, so wires are highlighted the same way as for local instances
+				TMap<FName, TArray<FPinRecord>>& Records = PinDirection == EGPD_Input ? Node->InputRecords : Node->OutputRecords;
+				Records.FindOrAdd(GetName(PinNameId)).Add(FPinRecord(FApp::GetCurrentTime(), EFlowPinActivationType::Default));
+			}
+			break;
+		}
+		case EFlowRemoteDebugEvent::EventsDropped:
+		{
+			uint32 Count = 0;
+			Reader << Count;
+
+			UE_LOG(LogFlowEditor, Warning, TEXT("Flow Remote Debugger: server dropped %u events, displayed state might be incomplete"), Count);
+			break;
+		}
+		default:
+			return false;
+	}
+
+	return true;
+}
+
+void FFlowRemoteDebugClient::OnInstanceStarted(const uint32 InstanceId, const FString& TemplatePath, const FName& InstanceName)
+{
+	UFlowAsset* TemplateAsset = Cast<UFlowAsset>(FSoftObjectPath(TemplatePath).TryLoad());
+	if (TemplateAsset == nullptr)
+	{
+		UE_LOG(LogFlowEditor, Warning, TEXT("Flow Remote Debugger: can't find Flow Asset %s"), *TemplatePath);
+		return;
+	}
+
+	// Proxy only mirrors state of the remote instance, so its nodes are never initialized nor executed
+	const FName ProxyName = MakeUniqueObjectName(GetTransientPackage(), TemplateAsset->GetClass(), FName(*FString::Printf(TEXT("Remote_%s"), *InstanceName.ToString())));
+	UFlowAsset* Proxy = NewObject<UFlowAsset>(GetTransientPackage(), TemplateAsset->GetClass(), ProxyName, RF_Transient, TemplateAsset, false, nullptr);
+	Proxy->TemplateAsset = TemplateAsset;
+
+	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Proxy->Nodes)
+	{
+		Node.Value = NewObject<UFlowNode>(Proxy, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
+	}
+
+	TemplateAsset->AddInstance(Proxy);
+	ProxyInstances.Add(InstanceId, Proxy);
+
+	if (TemplateAsset->GetInspectedInstance() == nullptr)
+	{
+		TemplateAsset->SetInspectedInstance(Proxy->GetDisplayName());
+	}
+	else
+	{
+		TemplateAsset->BroadcastDebuggerRefresh();
+	}
+}
+
+void FFlowRemoteDebugClient::OnInstanceFinished(const uint32 InstanceId)
+{
+	TWeakObjectPtr<UFlowAsset> Proxy;
+	if (ProxyInstances.RemoveAndCopyValue(InstanceId, Proxy) && Proxy.IsValid())
+	{
+		if (UFlowAsset* TemplateAsset = Proxy->GetTemplateAsset())
+		{
+			TemplateAsset->RemoveInstance(Proxy.Get());
+			TemplateAsset->BroadcastDebuggerRefresh();
+		}
+	}
+}
+
+UFlowNode* FFlowRemoteDebugClient::FindProxyNode(const uint32 InstanceId, const FGuid& NodeGuid) const
+{
+	const TWeakObjectPtr<UFlowAsset> Proxy = ProxyInstances.FindRef(InstanceId);
+	return Proxy.IsValid() ? Proxy->GetNode(NodeGuid) : nullptr;
+}
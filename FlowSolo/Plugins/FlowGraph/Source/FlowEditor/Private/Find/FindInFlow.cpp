@@ -10,8 +10,10 @@
 #include "Nodes/FlowNode.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
 
+#include "Algo/Compare.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
+#include "Editor.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Views/ITypedTableView.h"
 #include "GraphEditor.h"
@@ -25,6 +27,7 @@
 #include "SlotBase.h"
 #include "Styling/AppStyle.h"
 #include "Styling/SlateColor.h"
+#include "Subsystems/AssetEditorSubsystem.h"
 #include "Templates/Casts.h"
 #include "Types/SlateStructs.h"
 #include "UObject/Class.h"
@@ -53,8 +56,21 @@ FFindInFlowResult::FFindInFlowResult(const FString& InValue)
 {
 }
 
-FFindInFlowResult::FFindInFlowResult(const FString& InValue, TSharedPtr<FFindInFlowResult>& InParent, UEdGraphNode* InNode, bool bInIsSubGraphNode)
-	: Value(InValue), GraphNode(InNode), Parent(InParent), bIsSubGraphNode(bInIsSubGraphNode)
+FFindInFlowResult::FFindInFlowResult(const FString& InValue, const FSoftObjectPath& InAssetPath)
+	: Value(InValue), GraphNode(nullptr), AssetPath(InAssetPath), bIsAssetNode(true)
+{
+}
+
+FFindInFlowResult::FFindInFlowResult(const FFlowSearchIndexNode& InNode, const FSoftObjectPath& InAssetPath, TSharedPtr<FFindInFlowResult>& InParent, UEdGraphNode* InGraphNode, bool bInIsSubGraphNode)
+	: Value(InNode.Title)
+	, GraphNode(InGraphNode)
+	, AssetPath(InAssetPath)
+	, NodeGuid(InNode.NodeGuid)
+	, Description(InNode.Description)
+	, Comment(InNode.Comment)
+	, NodeType(InNode.NodeType)
+	, Parent(InParent)
+	, bIsSubGraphNode(bInIsSubGraphNode)
 {
 }
 
@@ -70,14 +86,15 @@ TSharedRef<SWidget> FFindInFlowResult::CreateIcon() const
 
 FReply FFindInFlowResult::OnClick(TWeakPtr<class FFlowAssetEditor> FlowAssetEditorPtr, TSharedPtr<FFindInFlowResult> Root)
 {
-	if (FlowAssetEditorPtr.IsValid() && GraphNode.IsValid())
+	if (FlowAssetEditorPtr.IsValid() && Parent.IsValid())
 	{
-		if (Parent.IsValid() && !bIsSubGraphNode)
+		if (GraphNode.IsValid() && !bIsSubGraphNode)
 		{
 			FlowAssetEditorPtr.Pin()->JumpToNode(GraphNode.Get());
 		}
-		else
+		else if (bIsSubGraphNode && Parent.Pin()->GraphNode.IsValid())
 		{
+			// Subgraph might not be loaded, focus on the SubGraph node instead
 			FlowAssetEditorPtr.Pin()->JumpToNode(Parent.Pin()->GraphNode.Get());
 		}
 	}
@@ -87,86 +104,69 @@ FReply FFindInFlowResult::OnClick(TWeakPtr<class FFlowAssetEditor> FlowAssetEdit
 
 FReply FFindInFlowResult::OnDoubleClick(TSharedPtr<FFindInFlowResult> Root) const
 {
-	if (!Parent.IsValid() || !bIsSubGraphNode)
+	if (!Parent.IsValid())
 	{
 		return FReply::Handled();
 	}
-	const UFlowGraphNode* ParentGraphNode = Cast<UFlowGraphNode>(Parent.Pin()->GraphNode);
-	if (!ParentGraphNode || !ParentGraphNode->GetFlowNodeBase())
+
+	const TSharedPtr<FFindInFlowResult> ParentResult = Parent.Pin();
+	if (bIsSubGraphNode || ParentResult->bIsAssetNode)
 	{
-		return FReply::Handled();
+		OpenAssetAndJumpToNode();
 	}
 
-	if (UFlowNode* FlowNode = Cast<UFlowNode>(ParentGraphNode->GetFlowNodeBase()))
+	return FReply::Handled();
+}
+
+void FFindInFlowResult::OpenAssetAndJumpToNode() const
+{
+	UFlowAsset* FlowAsset = Cast<UFlowAsset>(AssetPath.TryLoad());
+	if (FlowAsset == nullptr || FlowAsset->GetGraph() == nullptr)
 	{
-		if (UObject* AssetToEdit = FlowNode->GetAssetToEdit())
+		return;
+	}
+
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+	if (AssetEditorSubsystem->OpenEditorForAsset(FlowAsset))
+	{
+		if (const TSharedPtr<FFlowAssetEditor> FlowAssetEditor = FFlowGraphUtils::GetFlowAssetEditor(FlowAsset->GetGraph()))
 		{
-			UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-			if (AssetEditorSubsystem->OpenEditorForAsset(AssetToEdit))
+			for (const UEdGraphNode* Node : FlowAsset->GetGraph()->Nodes)
 			{
-				if (const TSharedPtr<FFlowAssetEditor> FlowAssetEditor = FFlowGraphUtils::GetFlowAssetEditor(GraphNode->GetGraph()))
+				if (Node && Node->NodeGuid == NodeGuid)
 				{
-					FlowAssetEditor->JumpToNode(GraphNode.Get());
+					FlowAssetEditor->JumpToNode(Node);
+					break;
 				}
 			}
 		}
 	}
-	
-	return FReply::Handled();
 }
 
 FString FFindInFlowResult::GetDescriptionText() const
 {
-	if (const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(GraphNode.Get()))
-	{
-		return FlowGraphNode->GetNodeDescription();
-	}
-
-	return FString();
+	return Description;
 }
 
 FString FFindInFlowResult::GetCommentText() const
 {
-	if (GraphNode.IsValid())
-	{
-		return GraphNode->NodeComment;
-	}
-
-	return FString();
+	return Comment;
 }
 
 FString FFindInFlowResult::GetNodeTypeText() const
 {
-	if (GraphNode.IsValid())
-	{
-		FString NodeClassName;
-		const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(GraphNode.Get());
-		if (FlowGraphNode && FlowGraphNode->GetFlowNodeBase())
-		{
-			NodeClassName = FlowGraphNode->GetFlowNodeBase()->GetClass()->GetName();
-		}
-		else
-		{
-			NodeClassName = GraphNode->GetClass()->GetName();
-		}
-		const int32 Pos = NodeClassName.Find("_");
-		if (Pos == INDEX_NONE)
-		{
-			return NodeClassName;
-		}
-		else
-		{
-			return NodeClassName.RightChop(Pos + 1);
-		}
-	}
-
-	return FString();
+	return NodeType;
 }
 
 FText FFindInFlowResult::GetToolTipText() const
 {
+	if (bIsAssetNode)
+	{
+		return FText::FromString(AssetPath.ToString());
+	}
+
 	FString ToolTipStr = TEXT("Click to focus on nodes.");
-	if (bIsSubGraphNode)
+	if (bIsSubGraphNode || (Parent.IsValid() && Parent.Pin()->bIsAssetNode))
 	{
 		ToolTipStr += TEXT("\nDouble click to focus on subgraph nodes");
 	}
@@ -176,10 +176,26 @@ FText FFindInFlowResult::GetToolTipText() const
 //////////////////////////////////////////////////////////////////////////
 // SFindInFlow
 
+SFindInFlow::~SFindInFlow()
+{
+	if (ActiveQuery.IsValid())
+	{
+		ActiveQuery->Cancel();
+	}
+
+	if (FFlowSearchIndex::IsAvailable())
+	{
+		FFlowSearchIndex::Get().OnIndexUpdated.Remove(IndexUpdatedHandle);
+	}
+}
+
 void SFindInFlow::Construct( const FArguments& InArgs, TSharedPtr<FFlowAssetEditor> InFlowAssetEditor)
 {
 	FlowAssetEditorPtr = InFlowAssetEditor;
 
+	// Assets gathered in the background are included once available
+	IndexUpdatedHandle = FFlowSearchIndex::Get().OnIndexUpdated.AddSP(this, &SFindInFlow::InitiateSearch);
+
 	this->ChildSlot
 		[
 			SNew(SVerticalBox)
@@ -210,6 +226,21 @@ void SFindInFlow::Construct( const FArguments& InArgs, TSharedPtr<FFlowAssetEdit
 					.OnCheckStateChanged(this, &SFindInFlow::OnFindInSubGraphStateChanged)
 					.ToolTipText(LOCTEXT("FlowEditorSubGraphSearchHint", "Checkin means search also in sub graph."))
 				]
+				+SHorizontalBox::Slot()
+				.Padding(10,0,5,0)
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("FlowEditorAllAssetsSearchText", "Find In All Flow Assets "))
+				]
+				+SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SCheckBox)
+					.OnCheckStateChanged(this, &SFindInFlow::OnFindInAllAssetsStateChanged)
+					.ToolTipText(LOCTEXT("FlowEditorAllAssetsSearchHint", "Checkin means search in all Flow Assets, including ones not loaded. Assets are indexed on save."))
+				]
 			]
 			+SVerticalBox::Slot()
 			.FillHeight(1.0f)
@@ -254,81 +285,157 @@ void SFindInFlow::OnSearchTextCommitted(const FText& Text, ETextCommit::Type Com
 
 void SFindInFlow::InitiateSearch()
 {
+	if (ActiveQuery.IsValid())
+	{
+		ActiveQuery->Cancel();
+		ActiveQuery.Reset();
+	}
+
 	TArray<FString> Tokens;
-	SearchValue.ParseIntoArray(Tokens, TEXT(" "), true);
+	FFlowSearchIndex::ParseSearchTokens(SearchValue, Tokens);
+	HighlightText = FText::FromString(SearchValue);
 
-	for (auto It(ItemsFound.CreateIterator()); It; ++It)
+	if (Tokens.Num() == 0)
 	{
-		TreeView->SetItemExpansion(*It, false);
+		PendingTokens.Reset();
+		PendingAssets.Reset();
+
+		OnQueryCompleted(TArray<FFlowSearchAssetMatches>());
+		return;
 	}
-	ItemsFound.Empty();
-	if (Tokens.Num() > 0)
+
+	TArray<FFlowSearchIndexAssetRef> Assets;
+	if (bFindInAllAssets)
+	{
+		FocusedAssetIndex.Reset();
+		FFlowSearchIndex::Get().GetAllAssetIndices(Assets);
+	}
+	else
 	{
-		HighlightText = FText::FromString(SearchValue);
-		MatchTokens(Tokens);
+		GatherFocusedAssets(Assets);
 	}
 
-	// Insert a fake result to inform user if none found
-	if (ItemsFound.Num() == 0)
+	// Index snapshots are immutable, so the same snapshots mean previous matches are still valid
+	const bool bSameAssets = Assets.Num() == LastAssets.Num() && Algo::Compare(Assets, LastAssets, [](const FFlowSearchIndexAssetRef& A, const FFlowSearchIndexAssetRef& B)
 	{
-		ItemsFound.Add(MakeShared<FFindInFlowResult>(LOCTEXT("FlowEditorSearchNoResults", "No Results found").ToString()));
+		return &A.Get() == &B.Get();
+	});
+
+	const FOnFlowSearchQueryCompleted OnCompleted = FOnFlowSearchQueryCompleted::CreateSP(this, &SFindInFlow::OnQueryCompleted);
+	PendingTokens = Tokens;
+	PendingAssets = Assets;
+
+	// Last matches are only refined once their query completed, a cancelled query leaves them untouched
+	if (bSameAssets && FFlowSearchIndex::IsRefinementOf(Tokens, LastTokens))
+	{
+		ActiveQuery = FFlowSearchIndex::RefineQuery(Tokens, CopyTemp(LastMatches), OnCompleted);
 	}
+	else
+	{
+		ActiveQuery = FFlowSearchIndex::LaunchQuery(Tokens, MoveTemp(Assets), OnCompleted);
+	}
+}
 
-	TreeView->RequestTreeRefresh();
+void SFindInFlow::GatherFocusedAssets(TArray<FFlowSearchIndexAssetRef>& OutAssets)
+{
+	FocusedAssetIndex.Reset();
+
+	const TSharedPtr<SFlowGraphEditor> FocusedGraphEditor = FlowAssetEditorPtr.IsValid() ? FlowAssetEditorPtr.Pin()->GetFlowGraph() : nullptr;
+	const UEdGraph* Graph = FocusedGraphEditor.IsValid() ? FocusedGraphEditor->GetCurrentGraph() : nullptr;
+	const UFlowAsset* FlowAsset = Graph ? Graph->GetTypedOuter<UFlowAsset>() : nullptr;
+	if (FlowAsset == nullptr)
+	{
+		return;
+	}
+
+	FFlowSearchIndex& SearchIndex = FFlowSearchIndex::Get();
+	const FFlowSearchIndexAssetRef AssetIndex = SearchIndex.GetAssetIndex(*FlowAsset);
+	FocusedAssetIndex = AssetIndex;
+	OutAssets.Add(AssetIndex);
+
+	if (bFindInSubGraph)
+	{
+		for (const FFlowSearchIndexNode& Node : AssetIndex->Nodes)
+		{
+			if (Node.SubGraphAsset.IsValid() && Node.SubGraphAsset != AssetIndex->AssetPath)
+			{
+				if (const FFlowSearchIndexAssetPtr SubGraphIndex = SearchIndex.FindAssetIndex(Node.SubGraphAsset))
+				{
+					OutAssets.AddUnique(SubGraphIndex.ToSharedRef());
+				}
+			}
+		}
+	}
+}
+
+void SFindInFlow::OnQueryCompleted(TArray<FFlowSearchAssetMatches>&& Matches)
+{
+	ActiveQuery.Reset();
 
 	for (auto It(ItemsFound.CreateIterator()); It; ++It)
 	{
-		TreeView->SetItemExpansion(*It, true);
+		TreeView->SetItemExpansion(*It, false);
+	}
+	ItemsFound.Empty();
+
+	RootSearchResult = MakeShared<FFindInFlowResult>(FString("FlowEditorRoot"));
+	if (bFindInAllAssets)
+	{
+		AddAllAssetsResults(Matches);
 	}
+	else if (FocusedAssetIndex.IsValid())
+	{
+		AddFocusedGraphResults(Matches);
+	}
+
+	LastTokens = MoveTemp(PendingTokens);
+	LastAssets = MoveTemp(PendingAssets);
+	LastMatches = MoveTemp(Matches);
+	RefreshTree();
 }
 
-void SFindInFlow::MatchTokens(const TArray<FString>& Tokens)
+void SFindInFlow::AddFocusedGraphResults(const TArray<FFlowSearchAssetMatches>& Matches)
 {
-	RootSearchResult.Reset();
-	
-	const UEdGraph* Graph = nullptr;
-	const TSharedPtr<SFlowGraphEditor> FocusedGraphEditor = FlowAssetEditorPtr.Pin()->GetFlowGraph();
-	if (FocusedGraphEditor.IsValid())
+	TMap<FSoftObjectPath, const FFlowSearchAssetMatches*> MatchesByAsset;
+	for (const FFlowSearchAssetMatches& AssetMatches : Matches)
 	{
-		Graph = FocusedGraphEditor->GetCurrentGraph();
+		MatchesByAsset.Add(AssetMatches.Asset->AssetPath, &AssetMatches);
 	}
 
-	if (Graph == nullptr)
+	const FSoftObjectPath& FocusedAssetPath = FocusedAssetIndex->AssetPath;
+	const FFlowSearchAssetMatches* const* FocusedMatches = MatchesByAsset.Find(FocusedAssetPath);
+
+	// Focused asset is loaded, so results can point directly to the graph nodes
+	TMap<FGuid, UEdGraphNode*> GraphNodes;
+	if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(FocusedAssetPath.ResolveObject()); FlowAsset && FlowAsset->GetGraph())
 	{
-		return;
+		for (UEdGraphNode* Node : FlowAsset->GetGraph()->Nodes)
+		{
+			if (Node)
+			{
+				GraphNodes.Add(Node->NodeGuid, Node);
+			}
+		}
 	}
-	
-	RootSearchResult = MakeShared<FFindInFlowResult>(FString("FlowEditorRoot"));
 
-	for (auto It(Graph->Nodes.CreateConstIterator()); It; ++It)
+	for (int32 NodeIndex = 0; NodeIndex < FocusedAssetIndex->Nodes.Num(); ++NodeIndex)
 	{
-		UEdGraphNode* Node = *It;
-		
-		const FString NodeName = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-		FSearchResult NodeResult(new FFindInFlowResult(NodeName, RootSearchResult, Node));
-		FString NodeSearchString = NodeName + Node->GetClass()->GetName() + Node->NodeComment;
+		const FFlowSearchIndexNode& Node = FocusedAssetIndex->Nodes[NodeIndex];
+		FSearchResult NodeResult = MakeShared<FFindInFlowResult>(Node, FocusedAssetPath, RootSearchResult, GraphNodes.FindRef(Node.NodeGuid));
 
-		if (const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Node))
+		if (bFindInSubGraph && Node.SubGraphAsset.IsValid())
 		{
-			FString NodeDescription = FlowGraphNode->GetNodeDescription();
-			NodeSearchString += NodeDescription;
-			
-			UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(FlowGraphNode->GetFlowNodeBase());
-			if (bFindInSubGraph && SubGraphNode)
+			if (const FFlowSearchAssetMatches* const* SubGraphMatches = MatchesByAsset.Find(Node.SubGraphAsset))
 			{
-				if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(SubGraphNode->GetAssetToEdit()); FlowAsset && FlowAsset->GetGraph())
+				for (const int32 ChildIndex : (*SubGraphMatches)->NodeIndices)
 				{
-					for (auto ChildIt(FlowAsset->GetGraph()->Nodes.CreateConstIterator()); ChildIt; ++ChildIt)
-					{
-						MatchTokensInChild(Tokens, *ChildIt, NodeResult);
-					}
+					const FFlowSearchIndexNode& ChildNode = (*SubGraphMatches)->Asset->Nodes[ChildIndex];
+					NodeResult->Children.Add(MakeShared<FFindInFlowResult>(ChildNode, Node.SubGraphAsset, NodeResult, nullptr, true));
 				}
 			}
 		}
 
-		NodeSearchString = NodeSearchString.Replace(TEXT(" "), TEXT(""));
-		const bool bNodeMatchesSearch = StringMatchesSearchTokens(Tokens, NodeSearchString);
-		
+		const bool bNodeMatchesSearch = FocusedMatches && (*FocusedMatches)->NodeIndices.Contains(NodeIndex);
 		if ((NodeResult->Children.Num() > 0) || bNodeMatchesSearch)
 		{
 			ItemsFound.Add(NodeResult);
@@ -336,25 +443,43 @@ void SFindInFlow::MatchTokens(const TArray<FString>& Tokens)
 	}
 }
 
-void SFindInFlow::MatchTokensInChild(const TArray<FString>& Tokens, UEdGraphNode* Child, FSearchResult ParentNode)
+void SFindInFlow::AddAllAssetsResults(const TArray<FFlowSearchAssetMatches>& Matches)
 {
-	if (Child == nullptr)
+	for (const FFlowSearchAssetMatches& AssetMatches : Matches)
 	{
-		return;
+		const FSoftObjectPath& AssetPath = AssetMatches.Asset->AssetPath;
+		FSearchResult AssetResult = MakeShared<FFindInFlowResult>(AssetPath.GetAssetName(), AssetPath);
+
+		for (const int32 NodeIndex : AssetMatches.NodeIndices)
+		{
+			AssetResult->Children.Add(MakeShared<FFindInFlowResult>(AssetMatches.Asset->Nodes[NodeIndex], AssetPath, AssetResult, nullptr));
+		}
+
+		ItemsFound.Add(AssetResult);
 	}
 
-	const FString ChildName = Child->GetNodeTitle(ENodeTitleType::ListView).ToString();
-	FString ChildSearchString = ChildName + Child->GetClass()->GetName() + Child->NodeComment;
-	if (const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(Child))
+	ItemsFound.Sort([](const FSearchResult& A, const FSearchResult& B)
 	{
-		FString NodeDescription = FlowGraphNode->GetNodeDescription();
-		ChildSearchString += NodeDescription;
+		return A->Value < B->Value;
+	});
+}
+
+void SFindInFlow::RefreshTree()
+{
+	// Insert a fake result to inform user if none found
+	if (ItemsFound.Num() == 0)
+	{
+		const bool bGathering = bFindInAllAssets && FFlowSearchIndex::Get().IsGatheringAssets();
+		ItemsFound.Add(MakeShared<FFindInFlowResult>(bGathering
+			? LOCTEXT("FlowEditorSearchGathering", "Indexing Flow Assets...").ToString()
+			: LOCTEXT("FlowEditorSearchNoResults", "No Results found").ToString()));
 	}
-	ChildSearchString = ChildSearchString.Replace(TEXT(" "), TEXT(""));
-	if (StringMatchesSearchTokens(Tokens, ChildSearchString))
+
+	TreeView->RequestTreeRefresh();
+
+	for (auto It(ItemsFound.CreateIterator()); It; ++It)
 	{
-		const FSearchResult DecoratorResult(new FFindInFlowResult(ChildName, ParentNode, Child, true));
-		ParentNode->Children.Add(DecoratorResult);
+		TreeView->SetItemExpansion(*It, true);
 	}
 }
 
@@ -442,21 +567,10 @@ void SFindInFlow::OnFindInSubGraphStateChanged(ECheckBoxState CheckBoxState)
 	InitiateSearch();
 }
 
-bool SFindInFlow::StringMatchesSearchTokens(const TArray<FString>& Tokens, const FString& ComparisonString)
+void SFindInFlow::OnFindInAllAssetsStateChanged(ECheckBoxState CheckBoxState)
 {
-	bool bFoundAllTokens = true;
-
-	//search the entry for each token, it must have all of them to pass
-	for (auto TokItr(Tokens.CreateConstIterator()); TokItr; ++TokItr)
-	{
-		const FString& Token = *TokItr;
-		if (!ComparisonString.Contains(Token))
-		{
-			bFoundAllTokens = false;
-			break;
-		}
-	}
-	return bFoundAllTokens;
+	bFindInAllAssets = CheckBoxState == ECheckBoxState::Checked;
+	InitiateSearch();
 }
 
 /////////////////////////////////////////////////////
@@ -0,0 +1,645 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Find/FlowSearchIndex.h"
+#include "Graph/Nodes/FlowGraphNode.h"
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNodeBase.h"
+#include "Nodes/Graph/FlowNode_SubGraph.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#define LOCTEXT_NAMESPACE "FlowSearchIndex"
+
+TUniquePtr<FFlowSearchIndex> FFlowSearchIndex::Instance;
+
+const FName FFlowSearchIndex::AssetRegistryTagName(TEXT("FlowSearchIndex"));
+
+namespace FlowSearchIndex
+{
+	// Increment if the serialized format changes, outdated tags are ignored until asset is saved again
+	static const FString FormatVersion = TEXT("1");
+
+	static constexpr int32 FieldCount = 6;
+
+	FString SanitizeField(const FString& Field)
+	{
+		FString Result = Field;
+		Result.ReplaceCharInline(TEXT('\t'), TEXT(' '));
+		Result.ReplaceCharInline(TEXT('\n'), TEXT(' '));
+		Result.ReplaceCharInline(TEXT('\r'), TEXT(' '));
+		return Result;
+	}
+
+	FString GetNodeTypeText(const UEdGraphNode& GraphNode)
+	{
+		FString NodeClassName;
+		const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(&GraphNode);
+		if (FlowGraphNode && FlowGraphNode->GetFlowNodeBase())
+		{
+			NodeClassName = FlowGraphNode->GetFlowNodeBase()->GetClass()->GetName();
+		}
+		else
+		{
+			NodeClassName = GraphNode.GetClass()->GetName();
+		}
+
+		const int32 Pos = NodeClassName.Find("_");
+		return Pos == INDEX_NONE ? NodeClassName : NodeClassName.RightChop(Pos + 1);
+	}
+
+	UFlowAsset* FindLoadedAsset(const FSoftObjectPath& AssetPath)
+	{
+		return Cast<UFlowAsset>(AssetPath.ResolveObject());
+	}
+}
+
+void FFlowSearchIndex::Initialize()
+{
+	if (!Instance.IsValid())
+	{
+		Instance = TUniquePtr<FFlowSearchIndex>(new FFlowSearchIndex());
+	}
+}
+
+void FFlowSearchIndex::Shutdown()
+{
+	Instance.Reset();
+}
+
+FFlowSearchIndex::FFlowSearchIndex()
+{
+	UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddRaw(this, &FFlowSearchIndex::OnGetExtraObjectTags);
+	FCoreUObjectDelegates::OnObjectPreSave.AddRaw(this, &FFlowSearchIndex::OnObjectPreSave);
+	FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FFlowSearchIndex::OnObjectModified);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FFlowSearchIndex::OnObjectPropertyChanged);
+	UPackage::PackageSavedWithContextEvent.AddRaw(this, &FFlowSearchIndex::OnPackageSaved);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	AssetRegistry.OnAssetAdded().AddRaw(this, &FFlowSearchIndex::OnAssetUpdated);
+	AssetRegistry.OnAssetUpdated().AddRaw(this, &FFlowSearchIndex::OnAssetUpdated);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FFlowSearchIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FFlowSearchIndex::OnAssetRenamed);
+}
+
+FFlowSearchIndex::~FFlowSearchIndex()
+{
+	UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPreSave.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryConstants::ModuleName))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().RemoveAll(this);
+		AssetRegistry.OnAssetUpdated().RemoveAll(this);
+		AssetRegistry.OnAssetRemoved().RemoveAll(this);
+		AssetRegistry.OnAssetRenamed().RemoveAll(this);
+		AssetRegistry.OnFilesLoaded().RemoveAll(this);
+	}
+}
+
+FFlowSearchIndexAssetRef FFlowSearchIndex::GetAssetIndex(const UFlowAsset& FlowAsset)
+{
+	const FSoftObjectPath AssetPath(&FlowAsset);
+	if (const FFlowSearchIndexAssetRef* CachedIndex = LoadedAssets.Find(AssetPath))
+	{
+		return *CachedIndex;
+	}
+
+	FFlowSearchIndexAssetRef AssetIndex = BuildAssetIndex(FlowAsset);
+	LoadedAssets.Add(AssetPath, AssetIndex);
+	return AssetIndex;
+}
+
+FFlowSearchIndexAssetPtr FFlowSearchIndex::FindAssetIndex(const FSoftObjectPath& AssetPath)
+{
+	if (const UFlowAsset* FlowAsset = FlowSearchIndex::FindLoadedAsset(AssetPath))
+	{
+		return GetAssetIndex(*FlowAsset);
+	}
+
+	if (const FFlowSearchIndexAssetRef* RegistryIndex = RegistryAssets.Find(AssetPath))
+	{
+		return *RegistryIndex;
+	}
+
+	// Single asset lookup doesn't wait for the background gathering
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(AssetPath);
+	FString TagValue;
+	if (AssetData.IsValid() && AssetData.GetTagValue(AssetRegistryTagName, TagValue))
+	{
+		FFlowSearchIndexAssetRef AssetIndex = ParseAssetIndex(AssetPath, TagValue);
+		RegistryAssets.Add(AssetPath, AssetIndex);
+		return AssetIndex;
+	}
+
+	// Saved before the index existed
+	if (AssetData.IsValid())
+	{
+		UntaggedAssets.Remove(AssetPath);
+		return LoadAndIndexAsset(AssetPath);
+	}
+
+	return nullptr;
+}
+
+void FFlowSearchIndex::GetAllAssetIndices(TArray<FFlowSearchIndexAssetRef>& OutAssets)
+{
+	if (!bGatheredAssets)
+	{
+		GatherRegistryAssets();
+	}
+
+	OutAssets.Reserve(RegistryAssets.Num() + ModifiedAssets.Num());
+	for (const TPair<FSoftObjectPath, FFlowSearchIndexAssetRef>& RegistryAsset : RegistryAssets)
+	{
+		if (!ModifiedAssets.Contains(RegistryAsset.Key))
+		{
+			OutAssets.Add(RegistryAsset.Value);
+		}
+	}
+
+	if (UntaggedAssets.Num() > 0)
+	{
+		FScopedSlowTask SlowTask(UntaggedAssets.Num(), LOCTEXT("IndexingUntaggedAssets", "Indexing Flow Assets saved without the search index..."));
+		SlowTask.MakeDialogDelayed(0.5f);
+
+		for (const FSoftObjectPath& AssetPath : UntaggedAssets)
+		{
+			SlowTask.EnterProgressFrame();
+
+			const FFlowSearchIndexAssetPtr AssetIndex = LoadAndIndexAsset(AssetPath);
+			if (AssetIndex.IsValid() && !ModifiedAssets.Contains(AssetPath))
+			{
+				OutAssets.Add(AssetIndex.ToSharedRef());
+			}
+		}
+		UntaggedAssets.Empty();
+	}
+
+	// Unsaved changes aren't reflected by the asset registry yet, this also covers assets never saved
+	for (auto It = ModifiedAssets.CreateIterator(); It; ++It)
+	{
+		if (const UFlowAsset* FlowAsset = FlowSearchIndex::FindLoadedAsset(*It))
+		{
+			OutAssets.Add(GetAssetIndex(*FlowAsset));
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FFlowSearchIndex::ParseSearchTokens(const FString& SearchValue, TArray<FString>& OutTokens)
+{
+	SearchValue.ToLower().ParseIntoArray(OutTokens, TEXT(" "), true);
+}
+
+FFlowSearchQueryPtr FFlowSearchIndex::LaunchQuery(const TArray<FString>& Tokens, TArray<FFlowSearchIndexAssetRef>&& Assets, const FOnFlowSearchQueryCompleted& OnCompleted)
+{
+	return LaunchQueryTask([Tokens, Assets = MoveTemp(Assets)](const FFlowSearchQuery& Query, TArray<FFlowSearchAssetMatches>& OutMatches)
+	{
+		for (const FFlowSearchIndexAssetRef& Asset : Assets)
+		{
+			if (Query.IsCancelled())
+			{
+				return;
+			}
+
+			FFlowSearchAssetMatches* AssetMatches = nullptr;
+			for (int32 NodeIndex = 0; NodeIndex < Asset->Nodes.Num(); ++NodeIndex)
+			{
+				if (MatchesTokens(Tokens, Asset->Nodes[NodeIndex].SearchString))
+				{
+					if (AssetMatches == nullptr)
+					{
+						AssetMatches = &OutMatches.Emplace_GetRef(Asset);
+					}
+					AssetMatches->NodeIndices.Add(NodeIndex);
+				}
+			}
+		}
+	}, OnCompleted);
+}
+
+FFlowSearchQueryPtr FFlowSearchIndex::RefineQuery(const TArray<FString>& Tokens, TArray<FFlowSearchAssetMatches>&& PreviousMatches, const FOnFlowSearchQueryCompleted& OnCompleted)
+{
+	return LaunchQueryTask([Tokens, PreviousMatches = MoveTemp(PreviousMatches)](const FFlowSearchQuery& Query, TArray<FFlowSearchAssetMatches>& OutMatches)
+	{
+		for (const FFlowSearchAssetMatches& PreviousAssetMatches : PreviousMatches)
+		{
+			if (Query.IsCancelled())
+			{
+				return;
+			}
+
+			FFlowSearchAssetMatches* AssetMatches = nullptr;
+			for (const int32 NodeIndex : PreviousAssetMatches.NodeIndices)
+			{
+				if (MatchesTokens(Tokens, PreviousAssetMatches.Asset->Nodes[NodeIndex].SearchString))
+				{
+					if (AssetMatches == nullptr)
+					{
+						AssetMatches = &OutMatches.Emplace_GetRef(PreviousAssetMatches.Asset);
+					}
+					AssetMatches->NodeIndices.Add(NodeIndex);
+				}
+			}
+		}
+	}, OnCompleted);
+}
+
+bool FFlowSearchIndex::IsRefinementOf(const TArray<FString>& Tokens, const TArray<FString>& PreviousTokens)
+{
+	if (PreviousTokens.Num() == 0)
+	{
+		return false;
+	}
+
+	// Every node matching new tokens matched the previous ones, if each previous token is a part of some new token
+	for (const FString& PreviousToken : PreviousTokens)
+	{
+		const bool bContained = Tokens.ContainsByPredicate([&PreviousToken](const FString& Token)
+		{
+			return Token.Contains(PreviousToken, ESearchCase::CaseSensitive);
+		});
+
+		if (!bContained)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FFlowSearchQueryPtr FFlowSearchIndex::LaunchQueryTask(TUniqueFunction<void(const FFlowSearchQuery&, TArray<FFlowSearchAssetMatches>&)>&& Search, const FOnFlowSearchQueryCompleted& OnCompleted)
+{
+	FFlowSearchQueryPtr Query = MakeShared<FFlowSearchQuery, ESPMode::ThreadSafe>();
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Query, Search = MoveTemp(Search), OnCompleted]()
+	{
+		TArray<FFlowSearchAssetMatches> Matches;
+		Search(*Query, Matches);
+
+		if (Query->IsCancelled())
+		{
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Query, OnCompleted, Matches = MoveTemp(Matches)]() mutable
+		{
+			if (!Query->IsCancelled())
+			{
+				OnCompleted.ExecuteIfBound(MoveTemp(Matches));
+			}
+		});
+	});
+
+	return Query;
+}
+
+bool FFlowSearchIndex::MatchesTokens(const TArray<FString>& Tokens, const FString& SearchString)
+{
+	// Both sides are already lowercase
+	for (const FString& Token : Tokens)
+	{
+		if (!SearchString.Contains(Token, ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+	}
+
+	return Tokens.Num() > 0;
+}
+
+TSharedRef<FFlowSearchIndexAsset, ESPMode::ThreadSafe> FFlowSearchIndex::BuildAssetIndex(const UFlowAsset& FlowAsset)
+{
+	TSharedRef<FFlowSearchIndexAsset, ESPMode::ThreadSafe> AssetIndex = MakeShared<FFlowSearchIndexAsset, ESPMode::ThreadSafe>();
+	AssetIndex->AssetPath = FSoftObjectPath(&FlowAsset);
+
+	const UEdGraph* Graph = FlowAsset.GetGraph();
+	if (Graph == nullptr)
+	{
+		return AssetIndex;
+	}
+
+	AssetIndex->Nodes.Reserve(Graph->Nodes.Num());
+	for (const UEdGraphNode* GraphNode : Graph->Nodes)
+	{
+		if (GraphNode == nullptr)
+		{
+			continue;
+		}
+
+		FFlowSearchIndexNode& Node = AssetIndex->Nodes.AddDefaulted_GetRef();
+		Node.NodeGuid = GraphNode->NodeGuid;
+		Node.Title = FlowSearchIndex::SanitizeField(GraphNode->GetNodeTitle(ENodeTitleType::ListView).ToString());
+		Node.NodeType = FlowSearchIndex::GetNodeTypeText(*GraphNode);
+		Node.Comment = FlowSearchIndex::SanitizeField(GraphNode->NodeComment);
+
+		if (const UFlowGraphNode* FlowGraphNode = Cast<UFlowGraphNode>(GraphNode))
+		{
+			Node.Description = FlowSearchIndex::SanitizeField(FlowGraphNode->GetNodeDescription());
+
+			if (const UFlowNode_SubGraph* SubGraphNode = Cast<UFlowNode_SubGraph>(FlowGraphNode->GetFlowNodeBase()))
+			{
+				Node.SubGraphAsset = FSoftObjectPath(SubGraphNode->GetAssetToEdit());
+			}
+		}
+
+		FinalizeNode(Node);
+	}
+
+	return AssetIndex;
+}
+
+FString FFlowSearchIndex::SerializeAssetIndex(const FFlowSearchIndexAsset& AssetIndex)
+{
+	// Single line per node, tab-separated fields. Fields are sanitized while building the index
+	TStringBuilder<1024> Builder;
+	Builder << FlowSearchIndex::FormatVersion;
+
+	for (const FFlowSearchIndexNode& Node : AssetIndex.Nodes)
+	{
+		Builder << TEXT('\n') << Node.NodeGuid.ToString(EGuidFormats::Digits)
+			<< TEXT('\t') << Node.Title
+			<< TEXT('\t') << Node.NodeType
+			<< TEXT('\t') << Node.Description
+			<< TEXT('\t') << Node.Comment
+			<< TEXT('\t') << Node.SubGraphAsset.ToString();
+	}
+
+	return Builder.ToString();
+}
+
+FFlowSearchIndexAssetRef FFlowSearchIndex::ParseAssetIndex(const FSoftObjectPath& AssetPath, const FString& TagValue)
+{
+	TSharedRef<FFlowSearchIndexAsset, ESPMode::ThreadSafe> AssetIndex = MakeShared<FFlowSearchIndexAsset, ESPMode::ThreadSafe>();
+	AssetIndex->AssetPath = AssetPath;
+
+	TArray<FString> Lines;
+	TagValue.ParseIntoArray(Lines, TEXT("\n"), false);
+	if (Lines.Num() == 0 || Lines[0] != FlowSearchIndex::FormatVersion)
+	{
+		return AssetIndex;
+	}
+
+	AssetIndex->Nodes.Reserve(Lines.Num() - 1);
+	TArray<FString> Fields;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() != FlowSearchIndex::FieldCount)
+		{
+			continue;
+		}
+
+		FFlowSearchIndexNode& Node = AssetIndex->Nodes.AddDefaulted_GetRef();
+		FGuid::Parse(Fields[0], Node.NodeGuid);
+		Node.Title = MoveTemp(Fields[1]);
+		Node.NodeType = MoveTemp(Fields[2]);
+		Node.Description = MoveTemp(Fields[3]);
+		Node.Comment = MoveTemp(Fields[4]);
+		if (!Fields[5].IsEmpty())
+		{
+			Node.SubGraphAsset = FSoftObjectPath(Fields[5]);
+		}
+
+		FinalizeNode(Node);
+	}
+
+	return AssetIndex;
+}
+
+void FFlowSearchIndex::FinalizeNode(FFlowSearchIndexNode& Node)
+{
+	Node.SearchString = (Node.Title + Node.NodeType + Node.Comment + Node.Description).ToLower();
+	Node.SearchString.ReplaceInline(TEXT(" "), TEXT(""), ESearchCase::CaseSensitive);
+}
+
+void FFlowSearchIndex::GatherRegistryAssets()
+{
+	if (bGatheringAssets)
+	{
+		// i.e. initial scan finished meanwhile, gather again once the running task completes
+		bGatherPending = true;
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		// Gather again once the initial scan finished, so assets discovered late are included
+		if (!AssetRegistry.OnFilesLoaded().IsBoundToObject(this))
+		{
+			AssetRegistry.OnFilesLoaded().AddRaw(this, &FFlowSearchIndex::GatherRegistryAssets);
+		}
+	}
+	else
+	{
+		AssetRegistry.OnFilesLoaded().RemoveAll(this);
+		bGatheredAssets = true;
+	}
+
+	// Reading tags is cheap, parsing them is moved off the game thread
+	TArray<FAssetData> FoundAssets;
+	AssetRegistry.GetAssetsByClass(UFlowAsset::StaticClass()->GetClassPathName(), FoundAssets, true);
+
+	TArray<TPair<FSoftObjectPath, FString>> AssetTags;
+	AssetTags.Reserve(FoundAssets.Num());
+	for (const FAssetData& AssetData : FoundAssets)
+	{
+		FString TagValue;
+		if (AssetData.GetTagValue(AssetRegistryTagName, TagValue))
+		{
+			AssetTags.Emplace(AssetData.GetSoftObjectPath(), MoveTemp(TagValue));
+		}
+		else if (!RegistryAssets.Contains(AssetData.GetSoftObjectPath()))
+		{
+			UntaggedAssets.Add(AssetData.GetSoftObjectPath());
+		}
+	}
+
+	bGatheringAssets = true;
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [AssetTags = MoveTemp(AssetTags)]()
+	{
+		TArray<FFlowSearchIndexAssetRef> ParsedAssets;
+		ParsedAssets.Reserve(AssetTags.Num());
+		for (const TPair<FSoftObjectPath, FString>& AssetTag : AssetTags)
+		{
+			ParsedAssets.Add(ParseAssetIndex(AssetTag.Key, AssetTag.Value));
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [ParsedAssets = MoveTemp(ParsedAssets)]()
+		{
+			if (!Instance.IsValid())
+			{
+				return;
+			}
+
+			Instance->bGatheringAssets = false;
+			for (const FFlowSearchIndexAssetRef& ParsedAsset : ParsedAssets)
+			{
+				// Entries updated while the task was running are newer
+				if (!Instance->RegistryAssets.Contains(ParsedAsset->AssetPath))
+				{
+					Instance->RegistryAssets.Add(ParsedAsset->AssetPath, ParsedAsset);
+				}
+			}
+
+			if (Instance->bGatherPending)
+			{
+				Instance->bGatherPending = false;
+				Instance->GatherRegistryAssets();
+			}
+
+			Instance->OnIndexUpdated.Broadcast();
+		});
+	});
+}
+
+void FFlowSearchIndex::UpdateRegistryAsset(const FAssetData& AssetData)
+{
+	FString TagValue;
+	if (AssetData.GetTagValue(AssetRegistryTagName, TagValue))
+	{
+		const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+		RegistryAssets.Add(AssetPath, ParseAssetIndex(AssetPath, TagValue));
+		UntaggedAssets.Remove(AssetPath);
+	}
+}
+
+FFlowSearchIndexAssetPtr FFlowSearchIndex::LoadAndIndexAsset(const FSoftObjectPath& AssetPath)
+{
+	if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(AssetPath.TryLoad()))
+	{
+		// Kept after the asset is unloaded, until the asset registry provides the tag
+		FFlowSearchIndexAssetRef AssetIndex = GetAssetIndex(*FlowAsset);
+		RegistryAssets.Add(AssetPath, AssetIndex);
+		return AssetIndex;
+	}
+
+	return nullptr;
+}
+
+void FFlowSearchIndex::OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+{
+	const UFlowAsset* FlowAsset = Cast<UFlowAsset>(Object);
+	if (FlowAsset && FlowAsset->IsAsset() && !SaveContext.IsCooking() && IsInGameThread())
+	{
+		FString TagValue = SerializeAssetIndex(*GetAssetIndex(*FlowAsset));
+
+		FScopeLock Lock(&PreSavedTagsLock);
+		PreSavedTags.Add(FSoftObjectPath(FlowAsset), MoveTemp(TagValue));
+	}
+}
+
+void FFlowSearchIndex::OnGetExtraObjectTags(FAssetRegistryTagsContext Context)
+{
+	const UFlowAsset* FlowAsset = Cast<UFlowAsset>(Context.GetObject());
+	if (FlowAsset == nullptr || !FlowAsset->IsAsset() || IsRunningCookCommandlet())
+	{
+		return;
+	}
+
+	// Node titles and the cache can be accessed only on the game thread, other threads use the tag serialized before saving
+	FString TagValue;
+	if (IsInGameThread())
+	{
+		TagValue = SerializeAssetIndex(*GetAssetIndex(*FlowAsset));
+	}
+	else
+	{
+		FScopeLock Lock(&PreSavedTagsLock);
+		if (const FString* PreSavedTag = PreSavedTags.Find(FSoftObjectPath(FlowAsset)))
+		{
+			TagValue = *PreSavedTag;
+		}
+	}
+
+	if (!TagValue.IsEmpty())
+	{
+		Context.AddTag(UObject::FAssetRegistryTag(AssetRegistryTagName, TagValue, UObject::FAssetRegistryTag::TT_Hidden));
+	}
+}
+
+void FFlowSearchIndex::OnObjectModified(UObject* Object)
+{
+	// Nodes and graph are outered to the asset
+	const UFlowAsset* FlowAsset = Cast<UFlowAsset>(Object);
+	if (FlowAsset == nullptr && Object)
+	{
+		FlowAsset = Object->GetTypedOuter<UFlowAsset>();
+	}
+
+	if (FlowAsset && FlowAsset->IsAsset())
+	{
+		const FSoftObjectPath AssetPath(FlowAsset);
+		LoadedAssets.Remove(AssetPath);
+		ModifiedAssets.Add(AssetPath);
+	}
+}
+
+void FFlowSearchIndex::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	OnObjectModified(Object);
+}
+
+void FFlowSearchIndex::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(Package ? Package->FindAssetInPackage() : nullptr))
+	{
+		// Saved tag is identical to the loaded index, no need to wait for the asset registry update
+		const FSoftObjectPath AssetPath(FlowAsset);
+		ModifiedAssets.Remove(AssetPath);
+		UntaggedAssets.Remove(AssetPath);
+		RegistryAssets.Add(AssetPath, GetAssetIndex(*FlowAsset));
+
+		FScopeLock Lock(&PreSavedTagsLock);
+		PreSavedTags.Remove(AssetPath);
+	}
+}
+
+void FFlowSearchIndex::OnAssetUpdated(const FAssetData& AssetData)
+{
+	// Before the first gathering, only update entries already looked up by FindAssetIndex
+	if ((bGatheredAssets || RegistryAssets.Contains(AssetData.GetSoftObjectPath())) && AssetData.IsInstanceOf(UFlowAsset::StaticClass()))
+	{
+		UpdateRegistryAsset(AssetData);
+	}
+}
+
+void FFlowSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+	RegistryAssets.Remove(AssetPath);
+	LoadedAssets.Remove(AssetPath);
+	ModifiedAssets.Remove(AssetPath);
+	UntaggedAssets.Remove(AssetPath);
+}
+
+void FFlowSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FSoftObjectPath OldAssetPath(OldObjectPath);
+	RegistryAssets.Remove(OldAssetPath);
+	LoadedAssets.Remove(OldAssetPath);
+	ModifiedAssets.Remove(OldAssetPath);
+	UntaggedAssets.Remove(OldAssetPath);
+
+	OnAssetUpdated(AssetData);
+}
+
+#undef LOCTEXT_NAMESPACE
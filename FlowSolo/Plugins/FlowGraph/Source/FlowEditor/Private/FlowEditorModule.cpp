@@ -5,6 +5,8 @@
 
 #include "Asset/FlowAssetEditor.h"
 #include "Asset/FlowAssetIndexer.h"
+#include "Asset/FlowRemoteDebugClient.h"
+#include "Find/FlowSearchIndex.h"
 #include "Graph/FlowGraphConnectionDrawingPolicy.h"
 #include "Graph/FlowGraphPinFactory.h"
 #include "Graph/FlowGraphSettings.h"
@@ -98,12 +100,18 @@ void FFlowEditorModule::StartupModule()
 	}
 	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FFlowEditorModule::ModulesChangesCallback);
 
+	// index used by the Find in Flow tab
+	FFlowSearchIndex::Initialize();
+
 	// run one-time asserts that cannot be asserted statically
 	UFlowK2SchemaSubclassForAccess::AssertPinCategoryNames();
 }
 
 void FFlowEditorModule::ShutdownModule()
 {
+	FFlowRemoteDebugClient::Disconnect();
+	FFlowSearchIndex::Shutdown();
+
 	MenuExtensibilityManager.Reset();
 	ToolBarExtensibilityManager.Reset();
 	
@@ -0,0 +1,54 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FArchive;
+class FSocket;
+class UFlowAsset;
+
+/**
+ * Editor-side client of FFlowRemoteDebugServer, i.e. connected to a packaged build running with -FlowRemoteDebug.
+ * Mirrors remote instances as transient proxy instances of the template assets, so the regular graph highlighting
+ * and instance selection of the Flow Asset Editor work for graphs executed in another process.
+ * Use console commands Flow.RemoteDebug.Connect [Host:Port] and Flow.RemoteDebug.Disconnect.
+ */
+class FLOWEDITOR_API FFlowRemoteDebugClient
+{
+public:
+	static bool Connect(const FString& Address);
+	static void Disconnect();
+	static bool IsConnected() { return Client.IsValid() && !Client->bConnectionLost; }
+
+	~FFlowRemoteDebugClient();
+
+private:
+	explicit FFlowRemoteDebugClient(FSocket* InSocket);
+
+	bool Tick(float DeltaTime);
+
+	// Returns false if received data is corrupted
+	bool ProcessReceivedData();
+	bool ProcessEvent(FArchive& Reader);
+
+	void OnInstanceStarted(const uint32 InstanceId, const FString& TemplatePath, const FName& InstanceName);
+	void OnInstanceFinished(const uint32 InstanceId);
+
+	class UFlowNode* FindProxyNode(const uint32 InstanceId, const FGuid& NodeGuid) const;
+
+	static TUniquePtr<FFlowRemoteDebugClient> Client;
+
+	FSocket* Socket = nullptr;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TArray<uint8> ReceiveBuffer;
+	bool bReceivedHeader = false;
+
+	// Set when disconnected by the server, client is destroyed on the next tick
+	bool bConnectionLost = false;
+
+	TArray<FName> Names;
+	TMap<uint32, TWeakObjectPtr<UFlowAsset>> ProxyInstances;
+};
@@ -23,6 +23,8 @@
 #include "Widgets/Views/STableViewBase.h"
 #include "Widgets/Views/STreeView.h"
 
+#include "Find/FlowSearchIndex.h"
+
 class ITableRow;
 class SWidget;
 class UFlowGraphNode;
@@ -35,8 +37,11 @@ public:
 	/** Create a root (or only text) result */
 	FFindInFlowResult(const FString& InValue);
 	
-	/** Create a flow node result */
-	FFindInFlowResult(const FString& InValue, TSharedPtr<FFindInFlowResult>& InParent, UEdGraphNode* InNode, bool bInIsSubGraphNode = false);
+	/** Create a flow asset result, used when searching across all assets */
+	FFindInFlowResult(const FString& InValue, const FSoftObjectPath& InAssetPath);
+
+	/** Create a flow node result from the search index */
+	FFindInFlowResult(const FFlowSearchIndexNode& InNode, const FSoftObjectPath& InAssetPath, TSharedPtr<FFindInFlowResult>& InParent, UEdGraphNode* InGraphNode, bool bInIsSubGraphNode = false);
 
 	/** Called when user clicks on the search item */
 	FReply OnClick(TWeakPtr<class FFlowAssetEditor> FlowAssetEditor,  TSharedPtr<FFindInFlowResult> Root);
@@ -44,6 +49,9 @@ public:
 	/** Called when user double clicks on the search item */
 	FReply OnDoubleClick(TSharedPtr<FFindInFlowResult> Root) const;
 
+	/** Opens the asset containing this node and jumps to it */
+	void OpenAssetAndJumpToNode() const;
+
 	/** Create an icon to represent the result */
 	TSharedRef<SWidget>	CreateIcon() const;
 
@@ -65,14 +73,28 @@ public:
 	/** The string value for this result */
 	FString Value;
 
-	/** The graph node that this search result refers to */
+	/** The graph node that this search result refers to, set only if the asset was loaded while searching */
 	TWeakObjectPtr<UEdGraphNode> GraphNode;
 
+	/** Asset containing the node */
+	FSoftObjectPath AssetPath;
+
+	/** Allows to find the node after loading the asset */
+	FGuid NodeGuid;
+
+	/** Texts cached by the search index */
+	FString Description;
+	FString Comment;
+	FString NodeType;
+
 	/** Search result parent */
 	TWeakPtr<FFindInFlowResult> Parent;
 
 	/** Whether this item is a subgraph node */
 	bool bIsSubGraphNode = false;
+
+	/** Whether this item lists results from another asset, when searching across all assets */
+	bool bIsAssetNode = false;
 };
 
 /** Widget for searching for (Flow nodes) across focused FlowNodes */
@@ -82,6 +104,8 @@ public:
 	SLATE_BEGIN_ARGS(SFindInFlow){}
 	SLATE_END_ARGS()
 
+	virtual ~SFindInFlow() override;
+
 	void Construct(const FArguments& InArgs, TSharedPtr<class FFlowAssetEditor> InFlowAssetEditor);
 
 	/** Focuses this widget's search box */
@@ -109,20 +133,29 @@ private:
 	/** Called when whether find in sub graph changed */
 	void OnFindInSubGraphStateChanged(ECheckBoxState CheckBoxState);
 
+	/** Called when whether find in all assets changed */
+	void OnFindInAllAssetsStateChanged(ECheckBoxState CheckBoxState);
+
 	/** Called when a new row is being generated */
 	TSharedRef<ITableRow> OnGenerateRow(FSearchResult InItem, const TSharedRef<STableViewBase>& OwnerTable);
 
-	/** Begins the search based on the SearchValue */
+	/** Begins the search based on the SearchValue, cancels the query still in progress */
 	void InitiateSearch();
-	
-	/** Find any results that contain all of the tokens */
-	void MatchTokens(const TArray<FString>& Tokens);
 
-	/** Find if child contains all of the tokens and add a result accordingly */
-	static void MatchTokensInChild(const TArray<FString>& Tokens, UEdGraphNode* Child, FSearchResult ParentNode);
-	
-	/** Determines if a string matches the search tokens */
-	static bool StringMatchesSearchTokens(const TArray<FString>& Tokens, const FString& ComparisonString);
+	/** Collects the search index of the focused graph, and its subgraphs if requested */
+	void GatherFocusedAssets(TArray<FFlowSearchIndexAssetRef>& OutAssets);
+
+	/** Called on the game thread when the background query finished */
+	void OnQueryCompleted(TArray<FFlowSearchAssetMatches>&& Matches);
+
+	/** Builds results of the focused graph, subgraph matches are listed under SubGraph nodes */
+	void AddFocusedGraphResults(const TArray<FFlowSearchAssetMatches>& Matches);
+
+	/** Builds results grouped by asset */
+	void AddAllAssetsResults(const TArray<FFlowSearchAssetMatches>& Matches);
+
+	/** Replaces displayed results */
+	void RefreshTree();
 
 private:
 	/** Pointer back to the flow editor that owns us */
@@ -148,4 +181,24 @@ private:
 
 	/** Using to control whether search in sub graph */
 	bool bFindInSubGraph = false;
+
+	/** Using to control whether search in all Flow Assets */
+	bool bFindInAllAssets = false;
+
+	/** Query running in the background */
+	FFlowSearchQueryPtr ActiveQuery;
+
+	/** Tokens and scope of the running query, become the last ones once it completed */
+	TArray<FString> PendingTokens;
+	TArray<FFlowSearchIndexAssetRef> PendingAssets;
+
+	/** Tokens and scope of the last completed query, a refined search runs only on its matches */
+	TArray<FString> LastTokens;
+	TArray<FFlowSearchIndexAssetRef> LastAssets;
+	TArray<FFlowSearchAssetMatches> LastMatches;
+
+	/** Focused graph index the query has been launched for */
+	FFlowSearchIndexAssetPtr FocusedAssetIndex;
+
+	FDelegateHandle IndexUpdatedHandle;
 };
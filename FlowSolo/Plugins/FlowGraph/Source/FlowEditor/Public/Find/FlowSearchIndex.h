@@ -0,0 +1,162 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/SoftObjectPath.h"
+
+#include <atomic>
+
+class UFlowAsset;
+class UObject;
+struct FAssetData;
+
+/** Searchable data of a single graph node, stored as the asset registry tag so unloaded assets can be searched too */
+struct FLOWEDITOR_API FFlowSearchIndexNode
+{
+	FGuid NodeGuid;
+
+	FString Title;
+	FString NodeType;
+	FString Description;
+	FString Comment;
+
+	// Set for SubGraph nodes
+	FSoftObjectPath SubGraphAsset;
+
+	// Lowercase concatenation of the displayed texts without spaces, compared against search tokens
+	FString SearchString;
+};
+
+/** Immutable snapshot of the asset's nodes, shared with the query tasks */
+struct FLOWEDITOR_API FFlowSearchIndexAsset
+{
+	FSoftObjectPath AssetPath;
+	TArray<FFlowSearchIndexNode> Nodes;
+};
+
+typedef TSharedRef<const FFlowSearchIndexAsset, ESPMode::ThreadSafe> FFlowSearchIndexAssetRef;
+typedef TSharedPtr<const FFlowSearchIndexAsset, ESPMode::ThreadSafe> FFlowSearchIndexAssetPtr;
+
+/** Nodes of a single asset matching all search tokens */
+struct FLOWEDITOR_API FFlowSearchAssetMatches
+{
+	FFlowSearchIndexAssetRef Asset;
+	TArray<int32> NodeIndices;
+
+	explicit FFlowSearchAssetMatches(const FFlowSearchIndexAssetRef& InAsset)
+		: Asset(InAsset)
+	{
+	}
+};
+
+DECLARE_DELEGATE_OneParam(FOnFlowSearchQueryCompleted, TArray<FFlowSearchAssetMatches>&& /*Matches*/);
+
+/** Handle of the query running off the game thread */
+class FLOWEDITOR_API FFlowSearchQuery
+{
+public:
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
+
+private:
+	std::atomic<bool> bCancelled = false;
+};
+
+typedef TSharedPtr<FFlowSearchQuery, ESPMode::ThreadSafe> FFlowSearchQueryPtr;
+
+/**
+ * Cached token index of Flow Assets, used by SFindInFlow.
+ * Loaded assets are indexed on demand and invalidated when modified, unloaded assets are read from the asset registry tag
+ * written on save. Registry entries are parsed in the background, queries run on the task graph and can be cancelled.
+ */
+class FLOWEDITOR_API FFlowSearchIndex
+{
+public:
+	static void Initialize();
+	static void Shutdown();
+	static bool IsAvailable() { return Instance.IsValid(); }
+	static FFlowSearchIndex& Get() { return *Instance; }
+
+	~FFlowSearchIndex();
+
+	// Called when the background gathering of the asset registry tags finished
+	FSimpleMulticastDelegate OnIndexUpdated;
+
+	// Returns up-to-date index of the loaded asset, rebuilt only if asset has been modified since the last call
+	FFlowSearchIndexAssetRef GetAssetIndex(const UFlowAsset& FlowAsset);
+
+	// Uses loaded asset if available, falls back to the asset registry entry
+	FFlowSearchIndexAssetPtr FindAssetIndex(const FSoftObjectPath& AssetPath);
+
+	// Snapshot of all indexed Flow Assets, starts gathering the asset registry tags on the first call
+	// Assets saved without the index tag are loaded and indexed once per session
+	void GetAllAssetIndices(TArray<FFlowSearchIndexAssetRef>& OutAssets);
+
+	bool IsGatheringAssets() const { return bGatheringAssets; }
+
+	// Splits lowercase search value by spaces, so tokens can be compared with FFlowSearchIndexNode::SearchString
+	static void ParseSearchTokens(const FString& SearchValue, TArray<FString>& OutTokens);
+
+	// Finds nodes containing all tokens, OnCompleted is called on the game thread unless query has been cancelled
+	static FFlowSearchQueryPtr LaunchQuery(const TArray<FString>& Tokens, TArray<FFlowSearchIndexAssetRef>&& Assets, const FOnFlowSearchQueryCompleted& OnCompleted);
+
+	// Searches only nodes matched by the previous query, valid if IsRefinementOf returns true
+	static FFlowSearchQueryPtr RefineQuery(const TArray<FString>& Tokens, TArray<FFlowSearchAssetMatches>&& PreviousMatches, const FOnFlowSearchQueryCompleted& OnCompleted);
+
+	static bool IsRefinementOf(const TArray<FString>& Tokens, const TArray<FString>& PreviousTokens);
+	static bool MatchesTokens(const TArray<FString>& Tokens, const FString& SearchString);
+
+	static const FName AssetRegistryTagName;
+
+private:
+	FFlowSearchIndex();
+
+	static FFlowSearchQueryPtr LaunchQueryTask(TUniqueFunction<void(const FFlowSearchQuery&, TArray<FFlowSearchAssetMatches>&)>&& Search, const FOnFlowSearchQueryCompleted& OnCompleted);
+
+	static TSharedRef<FFlowSearchIndexAsset, ESPMode::ThreadSafe> BuildAssetIndex(const UFlowAsset& FlowAsset);
+	static FString SerializeAssetIndex(const FFlowSearchIndexAsset& AssetIndex);
+	static FFlowSearchIndexAssetRef ParseAssetIndex(const FSoftObjectPath& AssetPath, const FString& TagValue);
+	static void FinalizeNode(FFlowSearchIndexNode& Node);
+
+	void GatherRegistryAssets();
+	void UpdateRegistryAsset(const FAssetData& AssetData);
+	FFlowSearchIndexAssetPtr LoadAndIndexAsset(const FSoftObjectPath& AssetPath);
+
+	void OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext);
+	void OnGetExtraObjectTags(FAssetRegistryTagsContext Context);
+	void OnObjectModified(UObject* Object);
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& PropertyChangedEvent);
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+	void OnAssetUpdated(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	static TUniquePtr<FFlowSearchIndex> Instance;
+
+	// Built from the loaded assets, removed when asset is modified
+	TMap<FSoftObjectPath, FFlowSearchIndexAssetRef> LoadedAssets;
+
+	// Parsed from the asset registry tags
+	TMap<FSoftObjectPath, FFlowSearchIndexAssetRef> RegistryAssets;
+
+	// Loaded assets with unsaved changes, these take precedence over the asset registry
+	TSet<FSoftObjectPath> ModifiedAssets;
+
+	// Registry entries without the index tag, i.e. assets saved before the index existed
+	TSet<FSoftObjectPath> UntaggedAssets;
+
+	// Tags serialized on the game thread before saving, as asset registry tags might be gathered on another thread
+	TMap<FSoftObjectPath, FString> PreSavedTags;
+	FCriticalSection PreSavedTagsLock;
+
+	bool bGatheredAssets = false;
+	bool bGatheringAssets = false;
+
+	// Requested while the previous gathering was running
+	bool bGatherPending = false;
+};
@@ -1,5 +1,5 @@
 #include "Components/InteractionComponent.h"
-#include "Camera/PlayerCameraManager.h"
+#include "Components/InteractionSubsystem.h"
 #include "Engine/World.h"
 
 FPlayerInInteractionEvent UInteractionComponent::OnPlayerEnter;
@@ -11,8 +11,8 @@ UInteractionComponent::UInteractionComponent(const FObjectInitializer& ObjectIni
 {
 	bAutoActivate = true;
 
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = false;
+	// range is checked by UInteractionSubsystem
+	PrimaryComponentTick.bCanEverTick = false;
 
 	SetUsingAbsoluteScale(true);
 	ArrowColor = FColor::Red;
@@ -23,59 +23,62 @@ void UInteractionComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	TransformUpdated.AddUObject(this, &UInteractionComponent::OnTransformUpdated);
+
 	if (bEnabled)
 	{
 		Enable();
 	}
 }
 
+void UInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UInteractionSubsystem* InteractionSubsystem = GetWorld()->GetSubsystem<UInteractionSubsystem>())
+	{
+		InteractionSubsystem->Unregister(this);
+	}
+
+	TransformUpdated.RemoveAll(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UInteractionComponent::Enable()
 {
-	if (const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+	if (UInteractionSubsystem* InteractionSubsystem = GetWorld()->GetSubsystem<UInteractionSubsystem>())
 	{
 		bEnabled = true;
-
-		CameraManager = PlayerController->PlayerCameraManager;
-		PrimaryComponentTick.SetTickFunctionEnable(true);
+		InteractionSubsystem->Register(this);
 	}
 }
 
 void UInteractionComponent::Disable()
 {
-	if (bCanInteract)
+	if (UInteractionSubsystem* InteractionSubsystem = GetWorld()->GetSubsystem<UInteractionSubsystem>())
 	{
-		bCanInteract = false;
-		OnPlayerExit.Broadcast(this);
+		InteractionSubsystem->Unregister(this);
 	}
 
+	SetPlayerInRange(false);
 	bEnabled = false;
-
-	PrimaryComponentTick.SetTickFunctionEnable(false);
-	CameraManager = nullptr;
 }
 
-void UInteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UInteractionComponent::SetPlayerInRange(const bool bInRange)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	bool bConditionsMet = false;
-	if (CameraManager.IsValid())
+	if (bInRange != bCanInteract)
 	{
-		const FVector DistanceToCamera = GetComponentLocation() - CameraManager->GetCameraLocation();
-		bConditionsMet = DistanceToCamera.Size() < Distance;
+		bCanInteract = bInRange;
+		(bInRange ? OnPlayerEnter : OnPlayerExit).Broadcast(this);
 	}
+}
 
-	if (bConditionsMet)
+void UInteractionComponent::OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (bEnabled)
 	{
-		if (!bCanInteract)
+		if (UInteractionSubsystem* InteractionSubsystem = GetWorld()->GetSubsystem<UInteractionSubsystem>())
 		{
-			bCanInteract = true;
-			OnPlayerEnter.Broadcast(this);
+			InteractionSubsystem->UpdateLocation(this);
 		}
 	}
-	else if (bCanInteract)
-	{
-		bCanInteract = false;
-		OnPlayerExit.Broadcast(this);
-	}
 }
@@ -0,0 +1,197 @@
+#include "Components/InteractionSubsystem.h"
+#include "Components/InteractionComponent.h"
+#include "QuestSettings.h"
+
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+void UInteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(UQuestSettings::Get()->InteractionCellSize, 100.0f);
+}
+
+void UInteractionSubsystem::Deinitialize()
+{
+	Cells.Empty();
+	ComponentCells.Empty();
+	InRange.Empty();
+
+	Super::Deinitialize();
+}
+
+void UInteractionSubsystem::Tick(float DeltaTime)
+{
+	if (ComponentCells.Num() == 0)
+	{
+		return;
+	}
+
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const APlayerCameraManager* CameraManager = PlayerController ? PlayerController->PlayerCameraManager.Get() : nullptr;
+	if (CameraManager == nullptr)
+	{
+		// no player to be in range of anymore
+		ClearInRange();
+		return;
+	}
+
+	const FVector CameraLocation = CameraManager->GetCameraLocation();
+	const FIntPoint CameraCell = GetCell(CameraLocation);
+	const int32 CellRange = FMath::CeilToInt(MaxDistance / CellSize);
+
+	TArray<TWeakObjectPtr<UInteractionComponent>, TInlineAllocator<16>> NowInRange;
+	if (FMath::Square(2 * CellRange + 1) <= Cells.Num())
+	{
+		for (int32 X = -CellRange; X <= CellRange; X++)
+		{
+			for (int32 Y = -CellRange; Y <= CellRange; Y++)
+			{
+				if (const TArray<TWeakObjectPtr<UInteractionComponent>>* Interactions = Cells.Find(CameraCell + FIntPoint(X, Y)))
+				{
+					for (const TWeakObjectPtr<UInteractionComponent>& Interaction : *Interactions)
+					{
+						AddInRange(Interaction.Get(), CameraLocation, NowInRange);
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		// fewer occupied cells than cells around the camera, only visit those
+		for (const TPair<FIntPoint, TArray<TWeakObjectPtr<UInteractionComponent>>>& Cell : Cells)
+		{
+			if (FMath::Abs(Cell.Key.X - CameraCell.X) <= CellRange && FMath::Abs(Cell.Key.Y - CameraCell.Y) <= CellRange)
+			{
+				for (const TWeakObjectPtr<UInteractionComponent>& Interaction : Cell.Value)
+				{
+					AddInRange(Interaction.Get(), CameraLocation, NowInRange);
+				}
+			}
+		}
+	}
+
+	// copies, broadcasts may enable or disable interactions
+	const TArray<TWeakObjectPtr<UInteractionComponent>> PreviouslyInRange = InRange;
+	InRange.Reset();
+	InRange.Append(NowInRange);
+
+	for (const TWeakObjectPtr<UInteractionComponent>& Interaction : PreviouslyInRange)
+	{
+		if (Interaction.IsValid() && !NowInRange.Contains(Interaction))
+		{
+			Interaction->SetPlayerInRange(false);
+		}
+	}
+
+	for (const TWeakObjectPtr<UInteractionComponent>& Interaction : NowInRange)
+	{
+		if (Interaction.IsValid() && !PreviouslyInRange.Contains(Interaction))
+		{
+			Interaction->SetPlayerInRange(true);
+		}
+	}
+}
+
+TStatId UInteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSubsystem, STATGROUP_Tickables);
+}
+
+void UInteractionSubsystem::Register(UInteractionComponent* Interaction)
+{
+	if (Interaction == nullptr || ComponentCells.Contains(Interaction))
+	{
+		return;
+	}
+
+	const FIntPoint Cell = GetCell(Interaction->GetComponentLocation());
+	Cells.FindOrAdd(Cell).Add(Interaction);
+	ComponentCells.Add(Interaction, Cell);
+
+	MaxDistance = FMath::Max(MaxDistance, Interaction->Distance);
+}
+
+void UInteractionSubsystem::Unregister(UInteractionComponent* Interaction)
+{
+	FIntPoint Cell;
+	if (ComponentCells.RemoveAndCopyValue(Interaction, Cell))
+	{
+		RemoveFromCell(Interaction, Cell);
+
+		// shrink the range tested around the camera once the farthest reaching interaction is gone
+		if (Interaction && Interaction->Distance >= MaxDistance)
+		{
+			MaxDistance = 0.0f;
+			for (const TPair<TWeakObjectPtr<UInteractionComponent>, FIntPoint>& Registered : ComponentCells)
+			{
+				if (const UInteractionComponent* RegisteredInteraction = Registered.Key.Get())
+				{
+					MaxDistance = FMath::Max(MaxDistance, RegisteredInteraction->Distance);
+				}
+			}
+		}
+	}
+
+	InRange.Remove(Interaction);
+}
+
+void UInteractionSubsystem::UpdateLocation(UInteractionComponent* Interaction)
+{
+	FIntPoint* Cell = ComponentCells.Find(Interaction);
+	if (Cell == nullptr)
+	{
+		return;
+	}
+
+	const FIntPoint NewCell = GetCell(Interaction->GetComponentLocation());
+	if (NewCell != *Cell)
+	{
+		RemoveFromCell(Interaction, *Cell);
+		Cells.FindOrAdd(NewCell).Add(Interaction);
+		*Cell = NewCell;
+	}
+}
+
+FIntPoint UInteractionSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UInteractionSubsystem::RemoveFromCell(UInteractionComponent* Interaction, const FIntPoint& Cell)
+{
+	if (TArray<TWeakObjectPtr<UInteractionComponent>>* Interactions = Cells.Find(Cell))
+	{
+		Interactions->RemoveSwap(Interaction);
+		if (Interactions->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UInteractionSubsystem::AddInRange(UInteractionComponent* Interaction, const FVector& CameraLocation, TArray<TWeakObjectPtr<UInteractionComponent>, TInlineAllocator<16>>& OutInRange) const
+{
+	if (Interaction && FVector::DistSquared(Interaction->GetComponentLocation(), CameraLocation) < FMath::Square(Interaction->Distance))
+	{
+		OutInRange.Add(Interaction);
+	}
+}
+
+void UInteractionSubsystem::ClearInRange()
+{
+	// copy, broadcasts may enable or disable interactions
+	const TArray<TWeakObjectPtr<UInteractionComponent>> PreviouslyInRange = MoveTemp(InRange);
+	InRange.Reset();
+
+	for (const TWeakObjectPtr<UInteractionComponent>& Interaction : PreviouslyInRange)
+	{
+		if (Interaction.IsValid())
+		{
+			Interaction->SetPlayerInRange(false);
+		}
+	}
+}
@@ -1,5 +1,7 @@
 #include "Components/SpawnComponent.h"
+#include "Components/SpawnSubsystem.h"
 
+#include "AIController.h"
 #include "Animation/AnimInstance.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
@@ -25,10 +27,28 @@ void USpawnComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 bool USpawnComponent::Spawn(const FQuestSpawnParams& SpawnParams)
 {
+	USpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<USpawnSubsystem>();
+
 	if (SpawnParams.ActorClass->IsChildOf(APawn::StaticClass()))
 	{
+		// resident if the spawn went through USpawnSubsystem::RequestSpawn
 		UBehaviorTree* LoadedBT = LoadAsset<UBehaviorTree>(SpawnParams.BehaviorTree);
-		SpawnedActor = UAIBlueprintHelperLibrary::SpawnAIFromClass(this, SpawnParams.ActorClass.Get(), LoadedBT, GetComponentLocation(), GetComponentRotation(), SpawnParams.bNoCollisionFail);
+
+		const FVector DefaultScale = SpawnParams.ActorClass->GetDefaultObject<AActor>()->GetActorScale3D();
+		APawn* PooledPawn = SpawnSubsystem ? Cast<APawn>(SpawnSubsystem->AcquireActor(SpawnParams.ActorClass, FTransform(GetComponentRotation(), GetComponentLocation(), DefaultScale))) : nullptr;
+		if (PooledPawn)
+		{
+			AAIController* AIController = Cast<AAIController>(PooledPawn->GetController());
+			if (AIController && LoadedBT)
+			{
+				AIController->RunBehaviorTree(LoadedBT);
+			}
+			SpawnedActor = PooledPawn;
+		}
+		else
+		{
+			SpawnedActor = UAIBlueprintHelperLibrary::SpawnAIFromClass(this, SpawnParams.ActorClass.Get(), LoadedBT, GetComponentLocation(), GetComponentRotation(), SpawnParams.bNoCollisionFail);
+		}
 
 		if (SpawnedActor.IsValid() && (SpawnParams.AnimInstance || SpawnParams.AnimationAsset))
 		{
@@ -47,7 +67,11 @@ bool USpawnComponent::Spawn(const FQuestSpawnParams& SpawnParams)
 	}
 	else
 	{
-		SpawnedActor = GetWorld()->SpawnActor(SpawnParams.ActorClass, &GetComponentTransform());
+		SpawnedActor = SpawnSubsystem ? SpawnSubsystem->AcquireActor(SpawnParams.ActorClass, GetComponentTransform()) : nullptr;
+		if (!SpawnedActor.IsValid())
+		{
+			SpawnedActor = GetWorld()->SpawnActor(SpawnParams.ActorClass, &GetComponentTransform());
+		}
 	}
 
 	if (SpawnedActor.IsValid() && SpawnParams.ActorScale != 1.0f)
@@ -62,7 +86,14 @@ void USpawnComponent::Despawn()
 {
 	if (SpawnedActor.IsValid())
 	{
-		SpawnedActor->Destroy();
+		if (USpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<USpawnSubsystem>())
+		{
+			SpawnSubsystem->ReleaseActor(SpawnedActor.Get());
+		}
+		else
+		{
+			SpawnedActor->Destroy();
+		}
 	}
 
 	SpawnedActor = nullptr;
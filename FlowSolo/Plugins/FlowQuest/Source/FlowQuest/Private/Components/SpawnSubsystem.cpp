@@ -0,0 +1,221 @@
+#include "Components/SpawnSubsystem.h"
+#include "QuestSettings.h"
+
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+void USpawnSubsystem::Deinitialize()
+{
+	for (const FQuestSpawnBatch& Batch : Batches)
+	{
+		if (Batch.LoadHandle.IsValid())
+		{
+			Batch.LoadHandle->CancelHandle();
+		}
+	}
+
+	Batches.Empty();
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+void USpawnSubsystem::Tick(float DeltaTime)
+{
+	if (Batches.Num() == 0)
+	{
+		return;
+	}
+
+	int32 Budget = FMath::Max(UQuestSettings::Get()->SpawnsPerFrame, 1);
+
+	// oldest batch first, so quest steps complete in order
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num() && Budget > 0; BatchIndex++)
+	{
+		FQuestSpawnBatch& Batch = Batches[BatchIndex];
+		if (Batch.LoadHandle.IsValid() && Batch.LoadHandle->IsLoadingInProgress())
+		{
+			continue;
+		}
+
+		while (Batch.PendingComponents.Num() > 0 && Budget > 0)
+		{
+			const TWeakObjectPtr<USpawnComponent> SpawnComponent = Batch.PendingComponents.Pop(EAllowShrinking::No);
+			if (SpawnComponent.IsValid() && SpawnComponent->Spawn(Batch.SpawnParams))
+			{
+				Batch.SpawnedComponents.Emplace(SpawnComponent);
+			}
+			Budget--;
+		}
+	}
+
+	// callbacks may request or cancel batches
+	TArray<FQuestSpawnBatch> CompletedBatches;
+	for (int32 BatchIndex = Batches.Num() - 1; BatchIndex >= 0; BatchIndex--)
+	{
+		if (Batches[BatchIndex].PendingComponents.Num() == 0)
+		{
+			CompletedBatches.Insert(MoveTemp(Batches[BatchIndex]), 0);
+			Batches.RemoveAt(BatchIndex);
+		}
+	}
+
+	for (const FQuestSpawnBatch& Batch : CompletedBatches)
+	{
+		Batch.OnCompleted.ExecuteIfBound(Batch.SpawnedComponents);
+	}
+}
+
+TStatId USpawnSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpawnSubsystem, STATGROUP_Tickables);
+}
+
+int32 USpawnSubsystem::RequestSpawn(const TArray<TWeakObjectPtr<USpawnComponent>>& SpawnComponents, const FQuestSpawnParams& SpawnParams, FQuestSpawnBatchCompleted OnCompleted)
+{
+	FQuestSpawnBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Id = NextBatchId++;
+	Batch.SpawnParams = SpawnParams;
+	Batch.OnCompleted = MoveTemp(OnCompleted);
+
+	// popped from the back, keep the order of the request
+	Batch.PendingComponents.Reserve(SpawnComponents.Num());
+	for (int32 Index = SpawnComponents.Num() - 1; Index >= 0; Index--)
+	{
+		Batch.PendingComponents.Emplace(SpawnComponents[Index]);
+	}
+
+	if (!SpawnParams.BehaviorTree.IsNull() && SpawnParams.BehaviorTree.IsPending())
+	{
+		Batch.LoadHandle = StreamableManager.RequestAsyncLoad(SpawnParams.BehaviorTree.ToSoftObjectPath());
+	}
+
+	return Batch.Id;
+}
+
+TArray<TWeakObjectPtr<USpawnComponent>> USpawnSubsystem::CancelSpawn(const int32 BatchId)
+{
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); BatchIndex++)
+	{
+		if (Batches[BatchIndex].Id == BatchId)
+		{
+			if (Batches[BatchIndex].LoadHandle.IsValid())
+			{
+				Batches[BatchIndex].LoadHandle->CancelHandle();
+			}
+
+			TArray<TWeakObjectPtr<USpawnComponent>> SpawnedComponents = MoveTemp(Batches[BatchIndex].SpawnedComponents);
+			Batches.RemoveAt(BatchIndex);
+			return SpawnedComponents;
+		}
+	}
+
+	return {};
+}
+
+AActor* USpawnSubsystem::AcquireActor(UClass* ActorClass, const FTransform& Transform)
+{
+	FQuestActorPool* Pool = Pools.Find(ActorClass);
+	if (Pool == nullptr)
+	{
+		return nullptr;
+	}
+
+	while (Pool->FreeActors.Num() > 0)
+	{
+		const FQuestPooledActor PooledActor = Pool->FreeActors.Pop(EAllowShrinking::No);
+		AActor* Actor = PooledActor.Actor;
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		const AActor* Defaults = ActorClass->GetDefaultObject<AActor>();
+
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(Defaults->IsHidden());
+		Actor->SetActorEnableCollision(Defaults->GetActorEnableCollision());
+		Actor->SetActorTickEnabled(Defaults->PrimaryActorTick.bStartWithTickEnabled);
+
+		if (APawn* Pawn = Cast<APawn>(Actor))
+		{
+			if (IsValid(PooledActor.Controller))
+			{
+				PooledActor.Controller->Possess(Pawn);
+			}
+			else
+			{
+				Pawn->SpawnDefaultController();
+			}
+
+			// APawn::Reset destroys pawns without a player state, AI controlled ones included, so only OnReset runs
+			Pawn->K2_OnReset();
+		}
+		else
+		{
+			Actor->Reset();
+		}
+
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+void USpawnSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	FQuestActorPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (Pool.FreeActors.Num() >= UQuestSettings::Get()->MaxPooledActorsPerClass)
+	{
+		if (const APawn* Pawn = Cast<APawn>(Actor))
+		{
+			if (AController* Controller = Pawn->GetController())
+			{
+				Controller->Destroy();
+			}
+		}
+
+		Actor->Destroy();
+		return;
+	}
+
+	FQuestPooledActor& PooledActor = Pool.FreeActors.AddDefaulted_GetRef();
+	PooledActor.Actor = Actor;
+
+	if (APawn* Pawn = Cast<APawn>(Actor))
+	{
+		if (AAIController* AIController = Cast<AAIController>(Pawn->GetController()))
+		{
+			if (UBrainComponent* BrainComponent = AIController->GetBrainComponent())
+			{
+				BrainComponent->StopLogic(TEXT("Despawn"));
+			}
+
+			AIController->StopMovement();
+			AIController->UnPossess();
+			PooledActor.Controller = AIController;
+		}
+
+		if (const ACharacter* Character = Cast<ACharacter>(Pawn))
+		{
+			Character->GetCharacterMovement()->StopMovementImmediately();
+		}
+	}
+
+	DeactivateActor(Actor);
+}
+
+void USpawnSubsystem::DeactivateActor(AActor* Actor)
+{
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+}
@@ -1,9 +1,13 @@
 #include "Flow/Nodes/FlowNode_OnTriggerEvent.h"
 #include "Triggers/FlowTriggerComponent.h"
+#include "Triggers/FlowTriggerSubsystem.h"
+
+#include "Engine/World.h"
 
 UFlowNode_OnTriggerEvent::UFlowNode_OnTriggerEvent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bReactOnOverlapping(false)
+	, bTrackingActorTags(false)
 {
 	// default behavior: react on Player overlapping with triggers
 	if (FGameplayTag::IsValidGameplayTagString(TEXT("Player.Pawn")))
@@ -24,6 +28,34 @@ void UFlowNode_OnTriggerEvent::ExecuteInput(const FName& PinName)
 	}
 }
 
+void UFlowNode_OnTriggerEvent::StartObserving()
+{
+	if (!bTrackingActorTags)
+	{
+		if (UFlowTriggerSubsystem* TriggerSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFlowTriggerSubsystem>() : nullptr)
+		{
+			TriggerSubsystem->AddTrackedActorTags(OverlappedActorTags);
+			bTrackingActorTags = true;
+		}
+	}
+
+	Super::StartObserving();
+}
+
+void UFlowNode_OnTriggerEvent::StopObserving()
+{
+	if (bTrackingActorTags)
+	{
+		if (UFlowTriggerSubsystem* TriggerSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFlowTriggerSubsystem>() : nullptr)
+		{
+			TriggerSubsystem->RemoveTrackedActorTags(OverlappedActorTags);
+		}
+		bTrackingActorTags = false;
+	}
+
+	Super::StopObserving();
+}
+
 void UFlowNode_OnTriggerEvent::ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component)
 {
 	if (!RegisteredActors.Contains(Actor))
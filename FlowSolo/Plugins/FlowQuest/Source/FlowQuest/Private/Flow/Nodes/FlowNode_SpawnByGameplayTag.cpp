@@ -1,10 +1,12 @@
 // Copyright https://github.com/MothCocoon/FlowSolo/graphs/contributors
 
 #include "Flow/Nodes/FlowNode_SpawnByGameplayTag.h"
+#include "Components/SpawnSubsystem.h"
 #include "FlowSubsystem.h"
 
 UFlowNode_SpawnByGameplayTag::UFlowNode_SpawnByGameplayTag(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, SpawnBatchId(0)
 {
 #if WITH_EDITOR
 	Category = TEXT("Actor");
@@ -20,32 +22,38 @@ void UFlowNode_SpawnByGameplayTag::ExecuteInput(const FName& PinName)
 	{
 		if (PinName == TEXT("Spawn"))
 		{
-			int32 SpawnCount = 0;
-			for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : GetFlowSubsystem()->GetComponents<UFlowComponent>(IdentityTags, EGameplayContainerMatchType::Any))
+			// batch in progress finishes the node once completed
+			if (SpawnBatchId != 0)
 			{
-				TArray<USpawnComponent*> NewSpawnComponents;
-				FoundComponent->GetOwner()->GetComponents<USpawnComponent>(NewSpawnComponents);
+				return;
+			}
 
-				for (USpawnComponent* SpawnComponent : NewSpawnComponents)
+			if (USpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<USpawnSubsystem>())
+			{
+				TArray<TWeakObjectPtr<USpawnComponent>> NewSpawnComponents;
+				for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : GetFlowSubsystem()->GetComponents<UFlowComponent>(IdentityTags, EGameplayContainerMatchType::Any))
 				{
-					if (!SpawnComponents.Contains(SpawnComponent))
+					TArray<USpawnComponent*> OwnerSpawnComponents;
+					FoundComponent->GetOwner()->GetComponents<USpawnComponent>(OwnerSpawnComponents);
+
+					for (USpawnComponent* SpawnComponent : OwnerSpawnComponents)
 					{
-						if (SpawnComponent->Spawn(SpawnParams))
+						if (!SpawnComponents.Contains(SpawnComponent))
 						{
-							SpawnComponents.Emplace(SpawnComponent);
-							SpawnCount++;
+							NewSpawnComponents.Emplace(SpawnComponent);
 						}
 					}
 				}
-			}
 
-			if (SpawnCount > 0)
-			{
-				TriggerOutput(TEXT("Spawned"));
+				// output is triggered once the batch completed
+				SpawnBatchId = SpawnSubsystem->RequestSpawn(NewSpawnComponents, SpawnParams, FQuestSpawnBatchCompleted::CreateUObject(this, &UFlowNode_SpawnByGameplayTag::OnSpawnCompleted));
+				return;
 			}
 		}
 		else if (PinName == TEXT("Despawn"))
 		{
+			CancelSpawn();
+
 			int32 DespawnCount = 0;
 			for (TWeakObjectPtr<USpawnComponent> SpawnComponent : SpawnComponents)
 			{
@@ -72,9 +80,36 @@ void UFlowNode_SpawnByGameplayTag::ExecuteInput(const FName& PinName)
 
 void UFlowNode_SpawnByGameplayTag::Cleanup()
 {
+	CancelSpawn();
 	SpawnComponents.Empty();
 }
 
+void UFlowNode_SpawnByGameplayTag::OnSpawnCompleted(const TArray<TWeakObjectPtr<USpawnComponent>>& SpawnedComponents)
+{
+	SpawnBatchId = 0;
+	SpawnComponents.Append(SpawnedComponents);
+
+	if (SpawnedComponents.Num() > 0)
+	{
+		TriggerOutput(TEXT("Spawned"));
+	}
+
+	TriggerFirstOutput(true);
+}
+
+void UFlowNode_SpawnByGameplayTag::CancelSpawn()
+{
+	if (SpawnBatchId != 0)
+	{
+		if (USpawnSubsystem* SpawnSubsystem = GetWorld()->GetSubsystem<USpawnSubsystem>())
+		{
+			// already spawned actors stay reachable by Despawn
+			SpawnComponents.Append(SpawnSubsystem->CancelSpawn(SpawnBatchId));
+		}
+		SpawnBatchId = 0;
+	}
+}
+
 #if WITH_EDITOR
 FString UFlowNode_SpawnByGameplayTag::GetNodeDescription() const
 {
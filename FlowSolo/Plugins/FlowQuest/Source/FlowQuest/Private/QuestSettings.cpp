@@ -2,5 +2,13 @@
 
 UQuestSettings::UQuestSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, InteractionCellSize(500.0f)
+	, SpawnsPerFrame(4)
+	, MaxPooledActorsPerClass(8)
+	, TriggerCellSize(2000.0f)
 {
+	if (FGameplayTag::IsValidGameplayTagString(TEXT("Player.Pawn")))
+	{
+		TriggerTrackedActorTags = FGameplayTagContainer(FGameplayTag::RequestGameplayTag(TEXT("Player.Pawn"), false));
+	}
 }
@@ -1,9 +1,9 @@
 #include "Triggers/FlowTriggerComponent.h"
-#include "FlowSubsystem.h"
+#include "Triggers/FlowTriggerSubsystem.h"
 
 #include "Components/BrushComponent.h"
 #include "Components/ShapeComponent.h"
-#include "TimerManager.h"
+#include "Engine/World.h"
 
 UFlowTriggerComponent::UFlowTriggerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -32,19 +32,9 @@ void UFlowTriggerComponent::EnableOverlap()
 	{
 		bOverlapEnabled = true;
 
-		for (UActorComponent* Component : GetOwner()->GetComponents())
+		if (UFlowTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UFlowTriggerSubsystem>())
 		{
-			if (Component && (Component->IsA(UShapeComponent::StaticClass()) || Component->IsA(UBrushComponent::StaticClass())))
-			{
-				UPrimitiveComponent* CollisionComponent = Cast<UPrimitiveComponent>(Component);
-				if (CollisionComponent->GetGenerateOverlapEvents() && CollisionComponent->GetCollisionProfileName() == TEXT("Trigger"))
-				{
-					CollisionComponents.Emplace(CollisionComponent);
-
-					CollisionComponent->OnComponentBeginOverlap.AddDynamic(this, &UFlowTriggerComponent::OnComponentBeginOverlap);
-					CollisionComponent->OnComponentEndOverlap.AddDynamic(this, &UFlowTriggerComponent::OnComponentEndOverlap);
-				}
-			}
+			TriggerSubsystem->Register(this, CollisionComponents);
 		}
 	}
 }
@@ -55,20 +45,18 @@ void UFlowTriggerComponent::DisableOverlap()
 	{
 		bOverlapEnabled = false;
 
-		for (TWeakObjectPtr<UPrimitiveComponent>& CollisionComponent : CollisionComponents)
+		if (UFlowTriggerSubsystem* TriggerSubsystem = GetWorld()->GetSubsystem<UFlowTriggerSubsystem>())
 		{
-			if (CollisionComponent.IsValid())
-			{
-				CollisionComponent->OnComponentBeginOverlap.RemoveAll(this);
-				CollisionComponent->OnComponentEndOverlap.RemoveAll(this);
-			}
+			TriggerSubsystem->Unregister(this);
 		}
-		CollisionComponents.Empty();
 	}
 }
 
 void UFlowTriggerComponent::BeginPlay()
 {
+	// before registering to the Flow Subsystem, graph might enable this trigger right away
+	GatherCollisionComponents();
+
 	Super::BeginPlay();
 
 	if (bAutoEnable)
@@ -84,39 +72,32 @@ void UFlowTriggerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-void UFlowTriggerComponent::OnComponentBeginOverlap(UPrimitiveComponent* InOverlappedComponent, AActor* InOtherActor, UPrimitiveComponent* InOtherComp, int32 InOtherBodyIndex, bool bFromSweep, const FHitResult& InSweepResult)
+void UFlowTriggerComponent::GatherCollisionComponents()
 {
-	TArray<UFlowComponent*> FlowComponents;
-	InOtherActor->GetComponents<UFlowComponent>(FlowComponents);
+	// shapes gathered by a previous BeginPlay no longer match the filter below as their collision is disabled, keep them
+	CollisionComponents.RemoveAll([](const TWeakObjectPtr<UPrimitiveComponent>& CollisionComponent)
+	{
+		return !CollisionComponent.IsValid();
+	});
 
-	if (FlowComponents.Num() > 0)
+	for (UActorComponent* Component : GetOwner()->GetComponents())
 	{
-		if (GetOwner()->HasActorBegunPlay())
+		if (Component && (Component->IsA(UShapeComponent::StaticClass()) || Component->IsA(UBrushComponent::StaticClass())))
 		{
-			OnTriggerEvent.Broadcast(true, FlowComponents[0]);
-		}
-		else
-		{
-			TWeakObjectPtr<UFlowTriggerComponent> SelfWeakPtr(this);
-			TWeakObjectPtr<UFlowComponent> FlowComponentWeakPtr(FlowComponents[0]);
-			GetOwner()->GetWorldTimerManager().SetTimerForNextTick([SelfWeakPtr, FlowComponentWeakPtr]()
+			UPrimitiveComponent* CollisionComponent = Cast<UPrimitiveComponent>(Component);
+			if (CollisionComponent->GetGenerateOverlapEvents() && CollisionComponent->GetCollisionProfileName() == TEXT("Trigger"))
 			{
-				if (SelfWeakPtr.IsValid())
-				{
-					SelfWeakPtr->OnTriggerEvent.Broadcast(true, FlowComponentWeakPtr.Get());
-				}
-			});
+				CollisionComponents.Emplace(CollisionComponent);
+
+				// shapes are only tested by the Flow Trigger Subsystem, remove them from the physics scene
+				CollisionComponent->SetGenerateOverlapEvents(false);
+				CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+			}
 		}
 	}
 }
 
-void UFlowTriggerComponent::OnComponentEndOverlap(UPrimitiveComponent* InOverlappedComponent, AActor* InOtherActor, UPrimitiveComponent* InOtherComp, int32 InOtherBodyIndex)
+void UFlowTriggerComponent::SetOverlapping(const bool bOverlapping, UFlowComponent* OtherFlowComponent)
 {
-	TArray<UFlowComponent*> FlowComponents;
-	InOtherActor->GetComponents<UFlowComponent>(FlowComponents);
-
-	if (FlowComponents.Num() > 0)
-	{
-		OnTriggerEvent.Broadcast(false, FlowComponents[0]);
-	}
+	OnTriggerEvent.Broadcast(bOverlapping, OtherFlowComponent);
 }
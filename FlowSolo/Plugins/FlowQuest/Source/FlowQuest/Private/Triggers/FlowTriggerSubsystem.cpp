@@ -0,0 +1,456 @@
+#include "Triggers/FlowTriggerSubsystem.h"
+#include "Triggers/FlowTriggerComponent.h"
+#include "FlowQuest.h"
+#include "FlowSubsystem.h"
+#include "QuestSettings.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/BrushComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "UObject/UObjectIterator.h"
+
+void UFlowTriggerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// nodes might have requested tags already
+	ConfiguredActorTags = UQuestSettings::Get()->TriggerTrackedActorTags;
+	TrackedActorTags.AppendTags(ConfiguredActorTags);
+	CellSize = FMath::Max(UQuestSettings::Get()->TriggerCellSize, 100.0f);
+
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem == nullptr)
+	{
+		UE_LOG(LogQuest, Error, TEXT("Flow Trigger Subsystem: missing Flow Subsystem, triggers won't report any overlaps in %s"), *InWorld.GetName());
+		return;
+	}
+
+	bTrackAllComponents = ConfiguredActorTags.IsEmpty();
+	if (bTrackAllComponents)
+	{
+		UE_LOG(LogQuest, Error, TEXT("Flow Trigger Subsystem: Trigger Tracked Actor Tags are empty in Quest Settings (is the Player.Pawn tag defined?), testing triggers against all Flow Components"));
+	}
+
+	FlowSubsystem->OnComponentRegistered.AddDynamic(this, &UFlowTriggerSubsystem::OnComponentRegistered);
+	FlowSubsystem->OnComponentUnregistered.AddDynamic(this, &UFlowTriggerSubsystem::OnComponentUnregistered);
+	FlowSubsystem->OnComponentTagAdded.AddDynamic(this, &UFlowTriggerSubsystem::OnComponentTagAdded);
+	FlowSubsystem->OnComponentTagRemoved.AddDynamic(this, &UFlowTriggerSubsystem::OnComponentTagRemoved);
+
+	if (bTrackAllComponents)
+	{
+		// components without identity tags aren't kept in the Flow Subsystem registry, object iterator includes other worlds
+		for (UFlowComponent* Component : TObjectRange<UFlowComponent>())
+		{
+			if (Component->GetWorld() == &InWorld && Component->HasBegunPlay())
+			{
+				Track(Component);
+			}
+		}
+	}
+	else
+	{
+		for (UFlowComponent* Component : FlowSubsystem->GetFlowComponentsByTags(TrackedActorTags, EGameplayContainerMatchType::Any, UFlowComponent::StaticClass()))
+		{
+			Track(Component);
+		}
+	}
+}
+
+void UFlowTriggerSubsystem::Deinitialize()
+{
+	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	{
+		FlowSubsystem->OnComponentRegistered.RemoveAll(this);
+		FlowSubsystem->OnComponentUnregistered.RemoveAll(this);
+		FlowSubsystem->OnComponentTagAdded.RemoveAll(this);
+		FlowSubsystem->OnComponentTagRemoved.RemoveAll(this);
+	}
+
+	Cells.Empty();
+	Triggers.Empty();
+	TrackedComponents.Empty();
+	Overlaps.Empty();
+	NumMovableTriggers = 0;
+
+	ConfiguredActorTags.Reset();
+	RequestedActorTags.Empty();
+	TrackedActorTags.Reset();
+	bTrackAllComponents = false;
+
+	Super::Deinitialize();
+}
+
+void UFlowTriggerSubsystem::Tick(float DeltaTime)
+{
+	if (Triggers.Num() == 0 && Overlaps.Num() == 0)
+	{
+		return;
+	}
+
+	if (NumMovableTriggers > 0)
+	{
+		for (TPair<TWeakObjectPtr<UFlowTriggerComponent>, FFlowTriggerShapes>& Trigger : Triggers)
+		{
+			if (Trigger.Value.bMovable && Trigger.Key.IsValid())
+			{
+				RemoveFromCells(Trigger.Key.Get(), Trigger.Value);
+				AddToCells(Trigger.Key.Get(), Trigger.Value);
+			}
+		}
+	}
+
+	TArray<FFlowTriggerOverlap, TInlineAllocator<8>> NowOverlapping;
+	TArray<TWeakObjectPtr<UFlowTriggerComponent>, TInlineAllocator<16>> Candidates;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : TrackedComponents)
+	{
+		const AActor* Actor = Component.IsValid() ? Component->GetOwner() : nullptr;
+		if (Actor == nullptr)
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		const float Radius = Actor->GetSimpleCollisionRadius();
+		const FIntVector MinCell = GetCell(Location - FVector(Radius));
+		const FIntVector MaxCell = GetCell(Location + FVector(Radius));
+
+		// large triggers are hashed into many cells
+		Candidates.Reset();
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+				{
+					if (const TArray<TWeakObjectPtr<UFlowTriggerComponent>>* CellTriggers = Cells.Find(FIntVector(X, Y, Z)))
+					{
+						for (const TWeakObjectPtr<UFlowTriggerComponent>& Trigger : *CellTriggers)
+						{
+							Candidates.AddUnique(Trigger);
+						}
+					}
+				}
+			}
+		}
+
+		for (const TWeakObjectPtr<UFlowTriggerComponent>& Trigger : Candidates)
+		{
+			const FFlowTriggerShapes* Entry = Triggers.Find(Trigger);
+			if (Entry == nullptr || !Trigger.IsValid() || Trigger->GetOwner() == Actor)
+			{
+				continue;
+			}
+
+			for (const TWeakObjectPtr<UPrimitiveComponent>& Shape : Entry->Shapes)
+			{
+				if (Shape.IsValid() && IsOverlapping(Shape.Get(), Location, Radius))
+				{
+					NowOverlapping.Emplace(Trigger, Component);
+					break;
+				}
+			}
+		}
+	}
+
+	// copies, broadcasts may enable or disable triggers
+	const TArray<FFlowTriggerOverlap> PreviouslyOverlapping = Overlaps;
+	Overlaps.Reset();
+	Overlaps.Append(NowOverlapping);
+
+	for (const FFlowTriggerOverlap& Overlap : PreviouslyOverlapping)
+	{
+		if (Overlap.Key.IsValid() && Overlap.Value.IsValid() && !NowOverlapping.Contains(Overlap))
+		{
+			Overlap.Key->SetOverlapping(false, Overlap.Value.Get());
+		}
+	}
+
+	for (const FFlowTriggerOverlap& Overlap : NowOverlapping)
+	{
+		if (Overlap.Key.IsValid() && Overlap.Value.IsValid() && !PreviouslyOverlapping.Contains(Overlap))
+		{
+			Overlap.Key->SetOverlapping(true, Overlap.Value.Get());
+		}
+	}
+}
+
+TStatId UFlowTriggerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlowTriggerSubsystem, STATGROUP_Tickables);
+}
+
+void UFlowTriggerSubsystem::Register(UFlowTriggerComponent* Trigger, const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Shapes)
+{
+	if (Trigger == nullptr || Shapes.Num() == 0 || Triggers.Contains(Trigger))
+	{
+		return;
+	}
+
+	FFlowTriggerShapes& Entry = Triggers.Add(Trigger);
+	Entry.Shapes = Shapes;
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Shape : Shapes)
+	{
+		if (Shape.IsValid() && Shape->Mobility == EComponentMobility::Movable)
+		{
+			Entry.bMovable = true;
+			NumMovableTriggers++;
+			break;
+		}
+	}
+
+	AddToCells(Trigger, Entry);
+}
+
+void UFlowTriggerSubsystem::Unregister(UFlowTriggerComponent* Trigger)
+{
+	FFlowTriggerShapes Entry;
+	if (Triggers.RemoveAndCopyValue(Trigger, Entry))
+	{
+		RemoveFromCells(Trigger, Entry);
+
+		if (Entry.bMovable)
+		{
+			NumMovableTriggers--;
+		}
+	}
+
+	// disabled triggers don't report leaving actors
+	Overlaps.RemoveAll([Trigger](const FFlowTriggerOverlap& Overlap)
+	{
+		return Overlap.Key == Trigger;
+	});
+}
+
+void UFlowTriggerSubsystem::AddTrackedActorTags(const FGameplayTagContainer& Tags)
+{
+	FGameplayTagContainer AddedTags;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (RequestedActorTags.FindOrAdd(Tag)++ == 0 && !TrackedActorTags.HasTagExact(Tag))
+		{
+			AddedTags.AddTag(Tag);
+		}
+	}
+
+	TrackedActorTags.AppendTags(AddedTags);
+
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem && !bTrackAllComponents && !AddedTags.IsEmpty())
+	{
+		for (UFlowComponent* Component : FlowSubsystem->GetFlowComponentsByTags(AddedTags, EGameplayContainerMatchType::Any, UFlowComponent::StaticClass()))
+		{
+			Track(Component);
+		}
+	}
+}
+
+void UFlowTriggerSubsystem::RemoveTrackedActorTags(const FGameplayTagContainer& Tags)
+{
+	bool bRemovedAny = false;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		int32* Count = RequestedActorTags.Find(Tag);
+		if (Count && --(*Count) == 0)
+		{
+			RequestedActorTags.Remove(Tag);
+			if (!ConfiguredActorTags.HasTagExact(Tag))
+			{
+				TrackedActorTags.RemoveTag(Tag);
+				bRemovedAny = true;
+			}
+		}
+	}
+
+	if (bRemovedAny && !bTrackAllComponents)
+	{
+		// copy, untracking reports leaving triggers
+		const TArray<TWeakObjectPtr<UFlowComponent>> Components = TrackedComponents;
+		for (const TWeakObjectPtr<UFlowComponent>& Component : Components)
+		{
+			if (Component.IsValid() && !ShouldTrack(Component.Get()))
+			{
+				Untrack(Component.Get());
+			}
+		}
+	}
+}
+
+void UFlowTriggerSubsystem::OnComponentRegistered(UFlowComponent* Component)
+{
+	if (ShouldTrack(Component))
+	{
+		Track(Component);
+	}
+}
+
+void UFlowTriggerSubsystem::OnComponentUnregistered(UFlowComponent* Component)
+{
+	Untrack(Component);
+}
+
+void UFlowTriggerSubsystem::OnComponentTagAdded(UFlowComponent* Component, const FGameplayTagContainer& Tags)
+{
+	if (!bTrackAllComponents && Tags.HasAnyExact(TrackedActorTags))
+	{
+		Track(Component);
+	}
+}
+
+void UFlowTriggerSubsystem::OnComponentTagRemoved(UFlowComponent* Component, const FGameplayTagContainer& Tags)
+{
+	if (bTrackAllComponents)
+	{
+		return;
+	}
+
+	FGameplayTagContainer RemainingTags = Component->IdentityTags;
+	RemainingTags.RemoveTags(Tags);
+
+	if (!RemainingTags.HasAnyExact(TrackedActorTags))
+	{
+		Untrack(Component);
+	}
+}
+
+void UFlowTriggerSubsystem::Track(UFlowComponent* Component)
+{
+	// the Flow Subsystem is shared by all worlds of the game instance
+	if (Component && Component->GetWorld() == GetWorld() && !Component->IsA<UFlowTriggerComponent>())
+	{
+		TrackedComponents.AddUnique(Component);
+	}
+}
+
+bool UFlowTriggerSubsystem::ShouldTrack(const UFlowComponent* Component) const
+{
+	return bTrackAllComponents || Component->IdentityTags.HasAnyExact(TrackedActorTags);
+}
+
+UFlowSubsystem* UFlowTriggerSubsystem::GetFlowSubsystem() const
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	return GameInstance ? GameInstance->GetSubsystem<UFlowSubsystem>() : nullptr;
+}
+
+void UFlowTriggerSubsystem::Untrack(UFlowComponent* Component)
+{
+	if (TrackedComponents.Remove(Component) == 0)
+	{
+		return;
+	}
+
+	// actor left the game, report it leaving its triggers like physics overlaps did
+	TArray<FFlowTriggerOverlap, TInlineAllocator<4>> Removed;
+	for (int32 Index = Overlaps.Num() - 1; Index >= 0; Index--)
+	{
+		if (Overlaps[Index].Value == Component)
+		{
+			Removed.Add(Overlaps[Index]);
+			Overlaps.RemoveAtSwap(Index);
+		}
+	}
+
+	for (const FFlowTriggerOverlap& Overlap : Removed)
+	{
+		if (Overlap.Key.IsValid())
+		{
+			Overlap.Key->SetOverlapping(false, Component);
+		}
+	}
+}
+
+FIntVector UFlowTriggerSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UFlowTriggerSubsystem::AddToCells(UFlowTriggerComponent* Trigger, FFlowTriggerShapes& Entry)
+{
+	FBox Bounds(ForceInit);
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Shape : Entry.Shapes)
+	{
+		if (Shape.IsValid())
+		{
+			Bounds += Shape->Bounds.GetBox();
+		}
+	}
+
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	const FIntVector MinCell = GetCell(Bounds.Min);
+	const FIntVector MaxCell = GetCell(Bounds.Max);
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				const FIntVector Cell(X, Y, Z);
+				Cells.FindOrAdd(Cell).Add(Trigger);
+				Entry.Cells.Add(Cell);
+			}
+		}
+	}
+}
+
+void UFlowTriggerSubsystem::RemoveFromCells(UFlowTriggerComponent* Trigger, FFlowTriggerShapes& Entry)
+{
+	for (const FIntVector& Cell : Entry.Cells)
+	{
+		if (TArray<TWeakObjectPtr<UFlowTriggerComponent>>* CellTriggers = Cells.Find(Cell))
+		{
+			CellTriggers->RemoveSwap(Trigger);
+			if (CellTriggers->Num() == 0)
+			{
+				Cells.Remove(Cell);
+			}
+		}
+	}
+	Entry.Cells.Reset();
+}
+
+bool UFlowTriggerSubsystem::IsOverlapping(const UPrimitiveComponent* Shape, const FVector& Location, const float Radius)
+{
+	const FTransform& Transform = Shape->GetComponentTransform();
+
+	if (const UBoxComponent* Box = Cast<UBoxComponent>(Shape))
+	{
+		const FVector Extent = Box->GetScaledBoxExtent();
+		const FVector LocalLocation = Transform.GetRotation().UnrotateVector(Location - Transform.GetLocation());
+		return FVector::DistSquared(LocalLocation, LocalLocation.BoundToBox(-Extent, Extent)) <= FMath::Square(Radius);
+	}
+
+	if (const USphereComponent* Sphere = Cast<USphereComponent>(Shape))
+	{
+		return FVector::DistSquared(Location, Transform.GetLocation()) <= FMath::Square(Sphere->GetScaledSphereRadius() + Radius);
+	}
+
+	if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(Shape))
+	{
+		const FVector Axis = Capsule->GetUpVector();
+		const float HalfSegment = Capsule->GetScaledCapsuleHalfHeight_WithoutHemisphere();
+		const float AlongAxis = FMath::Clamp(FVector::DotProduct(Location - Transform.GetLocation(), Axis), -HalfSegment, HalfSegment);
+		return FVector::DistSquared(Location, Transform.GetLocation() + Axis * AlongAxis) <= FMath::Square(Capsule->GetScaledCapsuleRadius() + Radius);
+	}
+
+	if (const UBrushComponent* Brush = Cast<UBrushComponent>(Shape))
+	{
+		if (Brush->BrushBodySetup)
+		{
+			// 0 inside the brush, negative if the distance can't be computed
+			const float Distance = Brush->BrushBodySetup->GetShortestDistanceToPoint(Location, Transform);
+			return Distance >= 0.0f && Distance <= Radius;
+		}
+		return false;
+	}
+
+	return Shape->Bounds.GetBox().ComputeSquaredDistanceToPoint(Location) <= FMath::Square(Radius);
+}
@@ -3,8 +3,6 @@
 #include "Components/ArrowComponent.h"
 #include "InteractionComponent.generated.h"
 
-class APlayerCameraManager;
-
 DECLARE_MULTICAST_DELEGATE_OneParam(FPlayerInInteractionEvent, TWeakObjectPtr<class UInteractionComponent> /*Interaction*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FInteractionComponentEvent);
 
@@ -29,10 +27,10 @@ public:
 
 private:
 	bool bCanInteract;
-	TWeakObjectPtr<APlayerCameraManager> CameraManager;
 	
 public:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void Enable();
@@ -40,8 +38,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void Disable();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+private:
+	friend class UInteractionSubsystem;
+
+	// called by UInteractionSubsystem when the camera enters or leaves Distance
+	void SetPlayerInRange(const bool bInRange);
 
+	void OnTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+public:
 	UPROPERTY(BlueprintAssignable, Category = "Interaction")
 	FInteractionComponentEvent OnUsed;
 };
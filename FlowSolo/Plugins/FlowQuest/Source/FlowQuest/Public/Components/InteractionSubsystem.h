@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionSubsystem.generated.h"
+
+class UInteractionComponent;
+
+/**
+ * Keeps enabled interactions in a uniform 2D spatial hash (X/Y), only the cells around the camera are tested each frame
+ * Interactions don't tick, entering and leaving range is reported through UInteractionComponent::OnPlayerEnter/OnPlayerExit
+ */
+UCLASS()
+class FLOWQUEST_API UInteractionSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UInteractionComponent>>> Cells;
+	TMap<TWeakObjectPtr<UInteractionComponent>, FIntPoint> ComponentCells;
+
+	// interactions the player is in range of
+	TArray<TWeakObjectPtr<UInteractionComponent>> InRange;
+
+	float CellSize = 500.0f;
+	
+	// largest distance of the registered interactions, defines how many cells are tested around the camera
+	float MaxDistance = 0.0f;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(UInteractionComponent* Interaction);
+	void Unregister(UInteractionComponent* Interaction);
+
+	// re-hash a moved interaction
+	void UpdateLocation(UInteractionComponent* Interaction);
+
+private:
+	FIntPoint GetCell(const FVector& Location) const;
+	void RemoveFromCell(UInteractionComponent* Interaction, const FIntPoint& Cell);
+
+	void AddInRange(UInteractionComponent* Interaction, const FVector& CameraLocation, TArray<TWeakObjectPtr<UInteractionComponent>, TInlineAllocator<16>>& OutInRange) const;
+
+	// broadcasts exit for every interaction in range
+	void ClearInRange();
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "Components/SpawnComponent.h"
+#include "SpawnSubsystem.generated.h"
+
+class AAIController;
+
+DECLARE_DELEGATE_OneParam(FQuestSpawnBatchCompleted, const TArray<TWeakObjectPtr<USpawnComponent>>& /*SpawnedComponents*/);
+
+struct FQuestSpawnBatch
+{
+	int32 Id = 0;
+	FQuestSpawnParams SpawnParams;
+
+	TArray<TWeakObjectPtr<USpawnComponent>> PendingComponents;
+	TArray<TWeakObjectPtr<USpawnComponent>> SpawnedComponents;
+
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	FQuestSpawnBatchCompleted OnCompleted;
+};
+
+USTRUCT()
+struct FQuestPooledActor
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Actor = nullptr;
+
+	// kept with its pawn, possesses it again when reused
+	UPROPERTY()
+	TObjectPtr<AAIController> Controller = nullptr;
+};
+
+USTRUCT()
+struct FQuestActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FQuestPooledActor> FreeActors;
+};
+
+/**
+ * Spreads quest spawns over several frames, loads spawn assets asynchronously and recycles despawned actors per class
+ */
+UCLASS()
+class FLOWQUEST_API USpawnSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	FStreamableManager StreamableManager;
+
+	TArray<FQuestSpawnBatch> Batches;
+	int32 NextBatchId = 1;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FQuestActorPool> Pools;
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// spawns on every component once spawn assets are loaded, a few per frame
+	int32 RequestSpawn(const TArray<TWeakObjectPtr<USpawnComponent>>& SpawnComponents, const FQuestSpawnParams& SpawnParams, FQuestSpawnBatchCompleted OnCompleted);
+
+	// stops the batch, returns the components that already spawned so the caller can still despawn them
+	TArray<TWeakObjectPtr<USpawnComponent>> CancelSpawn(const int32 BatchId);
+
+	// returns a pooled actor moved to the transform and reset (AActor::Reset, only OnReset in blueprints for pawns), nullptr if the pool is empty
+	AActor* AcquireActor(UClass* ActorClass, const FTransform& Transform);
+	void ReleaseActor(AActor* Actor);
+
+private:
+	static void DeactivateActor(AActor* Actor);
+};
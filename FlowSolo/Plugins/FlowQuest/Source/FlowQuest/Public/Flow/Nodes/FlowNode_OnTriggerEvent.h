@@ -19,7 +19,13 @@ protected:
 
 	bool bReactOnOverlapping;
 
+	// Overlapped Actor Tags are tracked by the Flow Trigger Subsystem while observing
+	bool bTrackingActorTags;
+
 	virtual void ExecuteInput(const FName& PinName) override;
+
+	virtual void StartObserving() override;
+	virtual void StopObserving() override;
 	
 	virtual void ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
 	virtual void ForgetActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) override;
@@ -11,6 +11,7 @@
 
 /**
  * Spawn by Gameplay Tag
+ * Spawns are spread over frames by USpawnSubsystem, Spawned is triggered once all of them completed
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "Spawn by Gameplay Tag"))
 class FLOWQUEST_API UFlowNode_SpawnByGameplayTag : public UFlowNode
@@ -25,10 +26,16 @@ protected:
 	FQuestSpawnParams SpawnParams;
 
 	TSet<TWeakObjectPtr<USpawnComponent>> SpawnComponents;
+
+	// spawn batch in progress
+	int32 SpawnBatchId;
 	
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void Cleanup() override;
+
+	void OnSpawnCompleted(const TArray<TWeakObjectPtr<USpawnComponent>>& SpawnedComponents);
+	void CancelSpawn();
 	
 #if WITH_EDITOR
 public:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
 #include "Templates/SubclassOf.h"
 #include "QuestSettings.generated.h"
 
@@ -18,4 +19,25 @@ class FLOWQUEST_API UQuestSettings final : public UDeveloperSettings
 
 	UPROPERTY(Config, EditAnywhere, Category = "Widgets")
 	TSubclassOf<UUserWidget> InteractionWidget;
+
+	// size of the spatial hash cells used to find interactions near the camera, cells are columns along Z
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = 100.0f))
+	float InteractionCellSize;
+
+	// quest spawns are spread over frames, this many actors per frame
+	UPROPERTY(Config, EditAnywhere, Category = "Spawn", meta = (ClampMin = 1))
+	int32 SpawnsPerFrame;
+
+	// despawned actors kept for reuse, per class
+	UPROPERTY(Config, EditAnywhere, Category = "Spawn", meta = (ClampMin = 0))
+	int32 MaxPooledActorsPerClass;
+
+	// actors with Flow Component identified by any of these tags are tested against enabled triggers, on top of tags used by active On Trigger Event nodes
+	// if empty, all actors with Flow Component are tested
+	UPROPERTY(Config, EditAnywhere, Category = "Trigger")
+	FGameplayTagContainer TriggerTrackedActorTags;
+
+	// size of the spatial hash cells used to find triggers around tracked actors
+	UPROPERTY(Config, EditAnywhere, Category = "Trigger", meta = (ClampMin = 100.0f))
+	float TriggerCellSize;
 };
@@ -7,6 +7,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowTriggerComponentEvent, const b
 
 /**
 * Trigger-specific Flow component - encapsulates communication between triggers and Flow graph
+* Overlaps are detected by UFlowTriggerSubsystem, trigger shapes don't generate physics overlaps
 */
 UCLASS(meta = (BlueprintSpawnableComponent))
 class FLOWQUEST_API UFlowTriggerComponent final : public UFlowComponent
@@ -22,6 +23,7 @@ class FLOWQUEST_API UFlowTriggerComponent final : public UFlowComponent
 	UPROPERTY(BlueprintAssignable, Category = "FlowTrigger")
 	FFlowTriggerComponentEvent OnTriggerEvent;
 	
+	// trigger shapes, tested by UFlowTriggerSubsystem while overlap is enabled
 	TArray<TWeakObjectPtr<UPrimitiveComponent>> CollisionComponents;
 
 protected:
@@ -35,9 +37,9 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 private:
-	UFUNCTION()
-	void OnComponentBeginOverlap(UPrimitiveComponent* InOverlappedComponent, AActor* InOtherActor, UPrimitiveComponent* InOtherComp, int32 InOtherBodyIndex, bool bFromSweep, const FHitResult& InSweepResult);
-	
-	UFUNCTION()
-	void OnComponentEndOverlap(UPrimitiveComponent* InOverlappedComponent, AActor* InOtherActor, UPrimitiveComponent* InOtherComp, int32 InOtherBodyIndex);
+	void GatherCollisionComponents();
+
+	friend class UFlowTriggerSubsystem;
+
+	void SetOverlapping(const bool bOverlapping, UFlowComponent* OtherFlowComponent);
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "FlowTriggerSubsystem.generated.h"
+
+class UFlowComponent;
+class UFlowSubsystem;
+class UFlowTriggerComponent;
+class UPrimitiveComponent;
+
+// trigger shapes registered in the spatial hash
+struct FFlowTriggerShapes
+{
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Shapes;
+	TArray<FIntVector> Cells;
+
+	// re-hashed every tick
+	bool bMovable = false;
+};
+
+using FFlowTriggerOverlap = TPair<TWeakObjectPtr<UFlowTriggerComponent>, TWeakObjectPtr<UFlowComponent>>;
+
+/**
+ * Broadphase for Flow triggers, replaces physics overlap events
+ * Enabled triggers are kept in a uniform spatial hash and only tested against tracked actors
+ * Tracked actors are identified by UQuestSettings::TriggerTrackedActorTags and the Overlapped Actor Tags of active On Trigger Event nodes
+ * If the setting is empty, every Flow Component is tracked
+ * Disabled triggers aren't registered at all, so they cost neither physics nor tick time
+ */
+UCLASS()
+class FLOWQUEST_API UFlowTriggerSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	TMap<FIntVector, TArray<TWeakObjectPtr<UFlowTriggerComponent>>> Cells;
+	TMap<TWeakObjectPtr<UFlowTriggerComponent>, FFlowTriggerShapes> Triggers;
+
+	TArray<TWeakObjectPtr<UFlowComponent>> TrackedComponents;
+	TArray<FFlowTriggerOverlap> Overlaps;
+
+	// tags from settings, followed by tags requested by active nodes
+	FGameplayTagContainer ConfiguredActorTags;
+	TMap<FGameplayTag, int32> RequestedActorTags;
+	FGameplayTagContainer TrackedActorTags;
+	bool bTrackAllComponents = false;
+
+	float CellSize = 2000.0f;
+	int32 NumMovableTriggers = 0;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void Register(UFlowTriggerComponent* Trigger, const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Shapes);
+	void Unregister(UFlowTriggerComponent* Trigger);
+
+	// ref-counted, called by nodes reacting on specific actors overlapping triggers
+	void AddTrackedActorTags(const FGameplayTagContainer& Tags);
+	void RemoveTrackedActorTags(const FGameplayTagContainer& Tags);
+
+private:
+	UFUNCTION()
+	void OnComponentRegistered(UFlowComponent* Component);
+
+	UFUNCTION()
+	void OnComponentUnregistered(UFlowComponent* Component);
+
+	UFUNCTION()
+	void OnComponentTagAdded(UFlowComponent* Component, const FGameplayTagContainer& Tags);
+
+	UFUNCTION()
+	void OnComponentTagRemoved(UFlowComponent* Component, const FGameplayTagContainer& Tags);
+
+	void Track(UFlowComponent* Component);
+	void Untrack(UFlowComponent* Component);
+	bool ShouldTrack(const UFlowComponent* Component) const;
+
+	UFlowSubsystem* GetFlowSubsystem() const;
+
+	FIntVector GetCell(const FVector& Location) const;
+	void AddToCells(UFlowTriggerComponent* Trigger, FFlowTriggerShapes& Entry);
+	void RemoveFromCells(UFlowTriggerComponent* Trigger, FFlowTriggerShapes& Entry);
+
+	static bool IsOverlapping(const UPrimitiveComponent* Shape, const FVector& Location, const float Radius);
+};
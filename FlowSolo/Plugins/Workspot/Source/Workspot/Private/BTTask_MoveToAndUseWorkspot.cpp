@@ -10,6 +10,9 @@
 #include "SmartObjectTypes.h"
 #include "GameplayBehaviorSmartObjectBehaviorDefinition.h"
 #include "WorkspotHelpers.h"
+#include "WorkspotClaimSubsystem.h"
+#include "WorkspotPreloadSubsystem.h"
+#include "WorkspotBehaviorConfig.h"
 #include "WorkspotSubsystem.h"
 #include "WorkspotInstance.h"
 #include "Workspot.h"
@@ -34,25 +37,19 @@ EBTNodeResult::Type UBTTask_MoveToAndUseWorkspot::ExecuteTask(UBehaviorTreeCompo
 	Memory->WorkspotInstance.Reset();
 	Memory->bMovementComplete = false;
 	Memory->bWorkspotStarted = false;
+	Memory->ClaimRequestId = 0;
+	Memory->PreloadConfig.Reset();
 
-	UE_LOG(LogWorkspot, Log, TEXT("BTTask_MoveToAndUseWorkspot - START"));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("BTTask_MoveToAndUseWorkspot - START"));
 
-	// Step 1: Find and claim SmartObject
+	// Step 1: Find SmartObject and queue the claim
 	if (!FindAndClaimSmartObject(OwnerComp, Memory))
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("BTTask_MoveToAndUseWorkspot - Failed to find/claim SmartObject"));
 		return EBTNodeResult::Failed;
 	}
 
-	// Step 2: Move to slot location
-	if (!MoveToSlotLocation(OwnerComp, Memory))
-	{
-		UE_LOG(LogWorkspot, Error, TEXT("BTTask_MoveToAndUseWorkspot - Failed to move to slot"));
-		ReleaseSlot(OwnerComp, Memory);
-		return EBTNodeResult::Failed;
-	}
-
-	// Movement started, wait for completion in Tick
+	// Step 2: Movement starts in OnSlotClaimed, wait for completion in Tick
 	return EBTNodeResult::InProgress;
 }
 
@@ -62,6 +59,16 @@ EBTNodeResult::Type UBTTask_MoveToAndUseWorkspot::AbortTask(UBehaviorTreeCompone
 
 	UE_LOG(LogWorkspot, Warning, TEXT("BTTask_MoveToAndUseWorkspot - ABORTED"));
 
+	// Drop the claim if it hasn't been resolved yet
+	if (Memory->ClaimRequestId != 0)
+	{
+		if (UWorkspotClaimSubsystem* ClaimSubsystem = OwnerComp.GetWorld()->GetSubsystem<UWorkspotClaimSubsystem>())
+		{
+			ClaimSubsystem->CancelClaim(Memory->ClaimRequestId);
+		}
+		Memory->ClaimRequestId = 0;
+	}
+
 	// Stop workspot if running
 	if (Memory->WorkspotInstance.IsValid())
 	{
@@ -81,6 +88,13 @@ EBTNodeResult::Type UBTTask_MoveToAndUseWorkspot::AbortTask(UBehaviorTreeCompone
 void UBTTask_MoveToAndUseWorkspot::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
 	FTaskMemory* Memory = CastInstanceNodeMemory<FTaskMemory>(NodeMemory);
+
+	// Claim not resolved yet, OnSlotClaimed finishes the task if it fails
+	if (Memory->ClaimRequestId != 0)
+	{
+		return;
+	}
+
 	AAIController* AIController = OwnerComp.GetAIOwner();
 
 	if (!AIController)
@@ -110,7 +124,7 @@ void UBTTask_MoveToAndUseWorkspot::TickTask(UBehaviorTreeComponent& OwnerComp, u
 		{
 			// Movement completed successfully
 			Memory->bMovementComplete = true;
-			UE_LOG(LogWorkspot, Log, TEXT("BTTask_MoveToAndUseWorkspot - Movement complete"));
+			UE_WORKSPOT_CLAIM_LOG(TEXT("BTTask_MoveToAndUseWorkspot - Movement complete"));
 		}
 		else
 		{
@@ -125,6 +139,14 @@ void UBTTask_MoveToAndUseWorkspot::TickTask(UBehaviorTreeComponent& OwnerComp, u
 	// Start workspot if not started yet
 	if (Memory->bMovementComplete && !Memory->bWorkspotStarted)
 	{
+		// Wait at the slot until the tree is resident
+		const UWorkspotBehaviorConfig* PreloadConfig = Memory->PreloadConfig.Get();
+		const UWorkspotPreloadSubsystem* PreloadSubsystem = OwnerComp.GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>();
+		if (PreloadConfig && PreloadSubsystem && PreloadSubsystem->IsTreeLoading(PreloadConfig->WorkspotTree))
+		{
+			return;
+		}
+
 		if (!StartWorkspotFromSlot(OwnerComp, Memory))
 		{
 			UE_LOG(LogWorkspot, Error, TEXT("BTTask_MoveToAndUseWorkspot - Failed to start workspot"));
@@ -148,6 +170,7 @@ void UBTTask_MoveToAndUseWorkspot::TickTask(UBehaviorTreeComponent& OwnerComp, u
 			{
 				ReleaseSlot(OwnerComp, Memory);
 			}
+			ReleasePreload(OwnerComp, Memory);
 
 			FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 			return;
@@ -204,51 +227,60 @@ bool UBTTask_MoveToAndUseWorkspot::FindAndClaimSmartObject(UBehaviorTreeComponen
 		return false;
 	}
 
-	// Create request to find available slots
-	FSmartObjectRequest Request;
-	Request.QueryBox = FBox(Pawn->GetActorLocation(), Pawn->GetActorLocation()).ExpandBy(SearchRadius);
-	Request.Filter.BehaviorDefinitionClasses = { UGameplayBehaviorSmartObjectBehaviorDefinition::StaticClass() };
-
-	// Find available slots
-	TArray<FSmartObjectRequestResult> Results;
-	SmartObjectSubsystem->FindSmartObjects(Request, Results, FConstStructView()); // Add missing UserData parameter
-
-	// Filter results to only include our target SmartObject
-	FSmartObjectRequestResult* TargetResult = Results.FindByPredicate([SmartObjectHandle](const FSmartObjectRequestResult& Result)
-	{
-		return Result.SmartObjectHandle == SmartObjectHandle && Result.IsValid();
-	});
-
-	if (!TargetResult)
+	// Search and claim are batched with the other agents of the frame
+	UWorkspotClaimSubsystem* ClaimSubsystem = World->GetSubsystem<UWorkspotClaimSubsystem>();
+	if (!ClaimSubsystem)
 	{
-		UE_LOG(LogWorkspot, Error, TEXT("No available slots found on SmartObject '%s'"), *SmartObjectActor->GetName());
+		UE_LOG(LogWorkspot, Error, TEXT("No WorkspotClaimSubsystem found"));
 		return false;
 	}
 
-	// Check if slot can be claimed
-	if (!SmartObjectSubsystem->CanBeClaimed(TargetResult->SlotHandle))
+	Memory->ClaimRequestId = ClaimSubsystem->RequestClaim(
+		Pawn,
+		SearchRadius,
+		SmartObjectHandle,
+		FOnWorkspotSlotClaimed::CreateUObject(this, &UBTTask_MoveToAndUseWorkspot::OnSlotClaimed, TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp), Memory));
+
+	return Memory->ClaimRequestId != 0;
+}
+
+bool UBTTask_MoveToAndUseWorkspot::OnSlotClaimed(const FSmartObjectClaimHandle& ClaimHandle, TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp, FTaskMemory* Memory)
+{
+	UBehaviorTreeComponent* OwnerComp = WeakOwnerComp.Get();
+	if (!OwnerComp)
 	{
-		UE_LOG(LogWorkspot, Error, TEXT("Slot cannot be claimed (already in use or disabled)"));
 		return false;
 	}
 
-	// Claim the slot using MarkSlotAsClaimed
-	// UserData can be used to associate user-specific data with the claim
-	FSmartObjectClaimHandle ClaimHandle = SmartObjectSubsystem->MarkSlotAsClaimed(
-		TargetResult->SlotHandle,
-		ESmartObjectClaimPriority::Normal,
-		FConstStructView() // No user data for now
-	);
+	Memory->ClaimRequestId = 0;
 
 	if (!ClaimHandle.IsValid())
 	{
-		UE_LOG(LogWorkspot, Error, TEXT("Failed to claim SmartObject slot"));
+		UE_LOG(LogWorkspot, Error, TEXT("BTTask_MoveToAndUseWorkspot - No available slot could be claimed"));
+		FinishLatentTask(*OwnerComp, EBTNodeResult::Failed);
 		return false;
 	}
 
 	Memory->ClaimHandle = ClaimHandle;
-	UE_LOG(LogWorkspot, Log, TEXT("✅ Claimed SmartObject slot"));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ Claimed SmartObject slot"));
+
+	// Stream the tree while walking to the slot
+	const UWorkspotBehaviorConfig* Config = UWorkspotHelpers::GetWorkspotConfigFromClaimHandle(OwnerComp, ClaimHandle);
+	UWorkspotPreloadSubsystem* PreloadSubsystem = OwnerComp->GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>();
+	if (Config && PreloadSubsystem)
+	{
+		PreloadSubsystem->AcquireTree(Config->WorkspotTree);
+		Memory->PreloadConfig = Config;
+	}
+
+	if (!MoveToSlotLocation(*OwnerComp, Memory))
+	{
+		UE_LOG(LogWorkspot, Error, TEXT("BTTask_MoveToAndUseWorkspot - Failed to move to slot"));
+		ReleaseSlot(*OwnerComp, Memory);
+		FinishLatentTask(*OwnerComp, EBTNodeResult::Failed);
+	}
 
+	// The slot is ours (or already released)
 	return true;
 }
 
@@ -291,7 +323,7 @@ bool UBTTask_MoveToAndUseWorkspot::MoveToSlotLocation(UBehaviorTreeComponent& Ow
 
 	if (MoveResult.Code == EPathFollowingRequestResult::RequestSuccessful)
 	{
-		UE_LOG(LogWorkspot, Log, TEXT("✅ Started movement to slot location"));
+		UE_WORKSPOT_CLAIM_LOG(TEXT("✅ Started movement to slot location"));
 		return true;
 	}
 	else
@@ -338,12 +370,14 @@ bool UBTTask_MoveToAndUseWorkspot::StartWorkspotFromSlot(UBehaviorTreeComponent&
 		Memory->WorkspotInstance = WorkspotSubsystem->GetActiveWorkspot(Pawn);
 	}
 
-	UE_LOG(LogWorkspot, Log, TEXT("✅ Workspot started successfully"));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ Workspot started successfully"));
 	return true;
 }
 
 void UBTTask_MoveToAndUseWorkspot::ReleaseSlot(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory)
 {
+	ReleasePreload(OwnerComp, Memory);
+
 	if (!Memory->ClaimHandle.IsValid())
 	{
 		return;
@@ -357,7 +391,7 @@ void UBTTask_MoveToAndUseWorkspot::ReleaseSlot(UBehaviorTreeComponent& OwnerComp
 		bool bReleased = SmartObjectSubsystem->MarkSlotAsFree(Memory->ClaimHandle);
 		if (bReleased)
 		{
-			UE_LOG(LogWorkspot, Log, TEXT("✅ Released SmartObject slot"));
+			UE_WORKSPOT_CLAIM_LOG(TEXT("✅ Released SmartObject slot"));
 		}
 		else
 		{
@@ -367,3 +401,19 @@ void UBTTask_MoveToAndUseWorkspot::ReleaseSlot(UBehaviorTreeComponent& OwnerComp
 
 	Memory->ClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
 }
+
+void UBTTask_MoveToAndUseWorkspot::ReleasePreload(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory)
+{
+	const UWorkspotBehaviorConfig* PreloadConfig = Memory->PreloadConfig.Get();
+	if (!PreloadConfig)
+	{
+		return;
+	}
+
+	if (UWorkspotPreloadSubsystem* PreloadSubsystem = OwnerComp.GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>())
+	{
+		PreloadSubsystem->ReleaseTree(PreloadConfig->WorkspotTree);
+	}
+
+	Memory->PreloadConfig.Reset();
+}
@@ -163,7 +163,7 @@ void UBTTask_UseWorkspotSmartObject::LogDiagnostics(UBehaviorTreeComponent& Owne
 	UE_LOG(LogWorkspot, Display, TEXT("✅ Config is UWorkspotBehaviorConfig"));
 
 	// Check WorkspotTree
-	if (!WorkspotConfig->WorkspotTree)
+	if (WorkspotConfig->WorkspotTree.IsNull())
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("❌ WorkspotTree is NULL in config"));
 		UE_LOG(LogWorkspot, Error, TEXT("   → Open Config and assign WorkspotTree"));
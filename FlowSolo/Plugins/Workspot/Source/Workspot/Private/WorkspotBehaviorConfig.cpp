@@ -23,15 +23,34 @@ UWorkspotBehaviorConfig::UWorkspotBehaviorConfig()
 	bTakeCharacterControl = true;
 }
 
+UWorkspotTree* UWorkspotBehaviorConfig::LoadWorkspotTree() const
+{
+	if (WorkspotTree.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UWorkspotTree* Tree = WorkspotTree.Get())
+	{
+		return Tree;
+	}
+
+	UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotBehaviorConfig: Loading '%s' synchronously, it wasn't preloaded"),
+		*WorkspotTree.ToString());
+
+	return WorkspotTree.LoadSynchronous();
+}
+
 bool UWorkspotBehaviorConfig::IsValid() const
 {
-	if (!WorkspotTree)
+	if (WorkspotTree.IsNull())
 	{
 		UE_LOG(LogWorkspot, Warning, TEXT("WorkspotBehaviorConfig: No WorkspotTree assigned"));
 		return false;
 	}
 
-	if (!WorkspotTree->IsValid())
+	// Trees that aren't resident yet are validated when they start
+	if (WorkspotTree.IsValid() && !WorkspotTree->IsValid())
 	{
 		UE_LOG(LogWorkspot, Warning, TEXT("WorkspotBehaviorConfig: WorkspotTree is invalid"));
 		return false;
@@ -57,12 +76,12 @@ EDataValidationResult UWorkspotBehaviorConfig::IsDataValid(FDataValidationContex
 {
 	EDataValidationResult Result = Super::IsDataValid(Context);
 
-	if (!WorkspotTree)
+	if (WorkspotTree.IsNull())
 	{
 		Context.AddError(FText::FromString(TEXT("WorkspotBehaviorConfig has no WorkspotTree assigned")));
 		Result = EDataValidationResult::Invalid;
 	}
-	else if (!WorkspotTree->IsValid())
+	else if (!LoadWorkspotTree() || !WorkspotTree->IsValid())
 	{
 		Context.AddError(FText::FromString(TEXT("WorkspotBehaviorConfig's WorkspotTree is invalid")));
 		Result = EDataValidationResult::Invalid;
@@ -0,0 +1,218 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WorkspotClaimSubsystem.h"
+#include "Workspot.h"
+#include "SmartObjectRequestTypes.h"
+#include "GameplayBehaviorSmartObjectBehaviorDefinition.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Console Variables
+//////////////////////////////////////////////////////////////////////////
+
+namespace UE::Workspot
+{
+	static float ClaimRegionSize = 5000.0f;
+	static FAutoConsoleVariableRef CVarClaimRegionSize(
+		TEXT("workspot.Claim.RegionSize"),
+		ClaimRegionSize,
+		TEXT("Size of the grid cells used to group slot claims, one SmartObject query is made per cell and frame."),
+		ECVF_Default);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Subsystem Implementation
+//////////////////////////////////////////////////////////////////////////
+
+void UWorkspotClaimSubsystem::Deinitialize()
+{
+	PendingRequests.Reset();
+
+	Super::Deinitialize();
+}
+
+void UWorkspotClaimSubsystem::Tick(float DeltaTime)
+{
+	if (PendingRequests.Num() == 0)
+	{
+		return;
+	}
+
+	ProcessingRequests = MoveTemp(PendingRequests);
+	PendingRequests.Reset();
+	ProcessingResults.Init(FSmartObjectClaimHandle::InvalidHandle, ProcessingRequests.Num());
+
+	USmartObjectSubsystem* SmartObjectSubsystem = GetWorld()->GetSubsystem<USmartObjectSubsystem>();
+	if (SmartObjectSubsystem)
+	{
+		const float RegionSize = FMath::Max(UE::Workspot::ClaimRegionSize, 100.0f);
+
+		// Requests keep their order inside a region, first come first served
+		TMap<FIntVector, TArray<int32, TInlineAllocator<8>>> Regions;
+		for (int32 Index = 0; Index < ProcessingRequests.Num(); Index++)
+		{
+			const FWorkspotClaimRequest& Request = ProcessingRequests[Index];
+			if (!Request.Requester.IsValid())
+			{
+				continue;
+			}
+
+			const FIntVector Cell(
+				FMath::FloorToInt(Request.Location.X / RegionSize),
+				FMath::FloorToInt(Request.Location.Y / RegionSize),
+				FMath::FloorToInt(Request.Location.Z / RegionSize));
+			Regions.FindOrAdd(Cell).Add(Index);
+		}
+
+		for (const auto& Pair : Regions)
+		{
+			ProcessRegion(*SmartObjectSubsystem, Pair.Value);
+		}
+	}
+
+	UE_WORKSPOT_CLAIM_LOG(TEXT("WorkspotClaimSubsystem::Tick - Processed %d claim request(s)"), ProcessingRequests.Num());
+
+	// Callbacks may queue or cancel requests
+	for (int32 Index = 0; Index < ProcessingRequests.Num(); Index++)
+	{
+		FWorkspotClaimRequest& Request = ProcessingRequests[Index];
+		const FSmartObjectClaimHandle& ClaimHandle = ProcessingResults[Index];
+
+		const bool bAccepted = !Request.bCancelled && Request.OnClaimed.IsBound() && Request.OnClaimed.Execute(ClaimHandle);
+		if (!bAccepted && ClaimHandle.IsValid() && SmartObjectSubsystem)
+		{
+			SmartObjectSubsystem->MarkSlotAsFree(ClaimHandle);
+		}
+	}
+
+	ProcessingRequests.Reset();
+	ProcessingResults.Reset();
+}
+
+TStatId UWorkspotClaimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWorkspotClaimSubsystem, STATGROUP_Tickables);
+}
+
+uint32 UWorkspotClaimSubsystem::RequestClaim(AActor* Requester, float SearchRadius, FSmartObjectHandle TargetSmartObject, FOnWorkspotSlotClaimed OnClaimed)
+{
+	if (!Requester || !OnClaimed.IsBound())
+	{
+		return 0;
+	}
+
+	FWorkspotClaimRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.Id = NextRequestId++;
+	Request.Requester = Requester;
+	Request.Location = Requester->GetActorLocation();
+	Request.SearchRadius = SearchRadius;
+	Request.TargetSmartObject = TargetSmartObject;
+	Request.OnClaimed = MoveTemp(OnClaimed);
+
+	// 0 is reserved for invalid requests
+	if (NextRequestId == 0)
+	{
+		NextRequestId = 1;
+	}
+
+	return Request.Id;
+}
+
+void UWorkspotClaimSubsystem::CancelClaim(uint32 RequestId)
+{
+	if (RequestId == 0)
+	{
+		return;
+	}
+
+	PendingRequests.RemoveAll([RequestId](const FWorkspotClaimRequest& Request)
+	{
+		return Request.Id == RequestId;
+	});
+
+	for (FWorkspotClaimRequest& Request : ProcessingRequests)
+	{
+		if (Request.Id == RequestId)
+		{
+			Request.bCancelled = true;
+		}
+	}
+}
+
+void UWorkspotClaimSubsystem::ProcessRegion(USmartObjectSubsystem& SmartObjectSubsystem, TConstArrayView<int32> RequestIndices)
+{
+	// One query covering every request of the region
+	FBox QueryBox(ForceInit);
+	for (const int32 Index : RequestIndices)
+	{
+		const FWorkspotClaimRequest& Request = ProcessingRequests[Index];
+		QueryBox += FBox(Request.Location, Request.Location).ExpandBy(Request.SearchRadius);
+	}
+
+	FSmartObjectRequest Query;
+	Query.QueryBox = QueryBox;
+	Query.Filter.BehaviorDefinitionClasses = { UGameplayBehaviorSmartObjectBehaviorDefinition::StaticClass() };
+
+	TArray<FSmartObjectRequestResult> Results;
+	SmartObjectSubsystem.FindSmartObjects(Query, Results, FConstStructView());
+
+	if (Results.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector> SlotLocations;
+	SlotLocations.Reserve(Results.Num());
+	for (const FSmartObjectRequestResult& Result : Results)
+	{
+		const TOptional<FVector> SlotLocation = SmartObjectSubsystem.GetSlotLocation(Result.SlotHandle);
+		SlotLocations.Add(SlotLocation.Get(FVector(UE_BIG_NUMBER)));
+	}
+
+	TArray<TPair<double, int32>, TInlineAllocator<16>> Candidates;
+	for (const int32 Index : RequestIndices)
+	{
+		const FWorkspotClaimRequest& Request = ProcessingRequests[Index];
+		const double MaxDistanceSquared = FMath::Square(static_cast<double>(Request.SearchRadius));
+
+		Candidates.Reset();
+		for (int32 ResultIndex = 0; ResultIndex < Results.Num(); ResultIndex++)
+		{
+			const FSmartObjectRequestResult& Result = Results[ResultIndex];
+			if (!Result.IsValid() || (Request.TargetSmartObject.IsValid() && Result.SmartObjectHandle != Request.TargetSmartObject))
+			{
+				continue;
+			}
+
+			// Targeted requests only need the SmartObject, its bounds were in range of the query
+			const double DistanceSquared = FVector::DistSquared(Request.Location, SlotLocations[ResultIndex]);
+			if (Request.TargetSmartObject.IsValid() || DistanceSquared <= MaxDistanceSquared)
+			{
+				Candidates.Emplace(DistanceSquared, ResultIndex);
+			}
+		}
+
+		Candidates.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B)
+		{
+			return A.Key < B.Key;
+		});
+
+		// Slots claimed by earlier requests of the batch can't be claimed anymore
+		for (const TPair<double, int32>& Candidate : Candidates)
+		{
+			const FSmartObjectSlotHandle SlotHandle = Results[Candidate.Value].SlotHandle;
+			if (!SmartObjectSubsystem.CanBeClaimed(SlotHandle))
+			{
+				continue;
+			}
+
+			const FSmartObjectClaimHandle ClaimHandle = SmartObjectSubsystem.MarkSlotAsClaimed(SlotHandle, ESmartObjectClaimPriority::Normal, FConstStructView());
+			if (ClaimHandle.IsValid())
+			{
+				ProcessingResults[Index] = ClaimHandle;
+				break;
+			}
+		}
+	}
+}
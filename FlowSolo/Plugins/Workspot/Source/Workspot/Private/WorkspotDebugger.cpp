@@ -240,8 +240,8 @@ void UWorkspotDebugger::DrawDebugInfo(UWorld* World)
 			GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::White, StateText);
 
 			// Show current Entry type (Iterator)
-			TSharedPtr<FWorkspotIterator> Iterator = Instance->GetIterator();
-			if (Iterator.IsValid())
+			const FWorkspotIterator* Iterator = Instance->GetIterator();
+			if (Iterator)
 			{
 				FString EntryText = FString::Printf(TEXT("   📋 Entry: %s"), *Iterator->GetDebugString());
 				GEngine->AddOnScreenDebugMessage(-1, 0.0f, FColor::Yellow, EntryText);
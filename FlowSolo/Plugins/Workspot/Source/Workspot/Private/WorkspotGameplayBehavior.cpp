@@ -2,6 +2,7 @@
 
 #include "WorkspotGameplayBehavior.h"
 #include "WorkspotBehaviorConfig.h"
+#include "WorkspotPreloadSubsystem.h"
 #include "WorkspotSubsystem.h"
 #include "WorkspotInstance.h"
 #include "WorkspotTree.h"
@@ -31,10 +32,28 @@ bool UGameplayBehavior_Workspot::Trigger(AActor& Avatar, const UGameplayBehavior
 
 	CachedConfig = WorkspotConfig;
 
+	// Stream the tree instead of loading it on the game thread, the workspot starts once it is resident
+	UWorkspotPreloadSubsystem* PreloadSubsystem = Avatar.GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>();
+	if (PreloadSubsystem && !WorkspotConfig->WorkspotTree.IsNull())
+	{
+		PreloadSubsystem->AcquireTree(WorkspotConfig->WorkspotTree);
+		bTreeAcquired = true;
+
+		if (PreloadSubsystem->IsTreeLoading(WorkspotConfig->WorkspotTree))
+		{
+			UE_LOG(LogWorkspot, Log, TEXT("UGameplayBehavior_Workspot::Trigger - Waiting for '%s' on %s"),
+				*WorkspotConfig->WorkspotTree.ToString(), *Avatar.GetName());
+
+			PreloadSubsystem->CallWhenTreeLoaded(WorkspotConfig->WorkspotTree, FSimpleDelegate::CreateUObject(this, &UGameplayBehavior_Workspot::OnTreeLoaded));
+			return Super::Trigger(Avatar, Config, SmartObjectOwner);
+		}
+	}
+
 	// Start the workspot
 	if (!StartWorkspot(&Avatar, WorkspotConfig))
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("UGameplayBehavior_Workspot::Trigger - Failed to start workspot on %s"), *Avatar.GetName());
+		ReleaseTree(&Avatar);
 		return false;
 	}
 
@@ -52,6 +71,7 @@ void UGameplayBehavior_Workspot::EndBehavior(AActor& Avatar, const bool bInterru
 
 	// Stop the workspot
 	StopWorkspot(&Avatar, bInterrupted);
+	ReleaseTree(&Avatar);
 
 	// Cleanup
 	ActiveWorkspotInstance.Reset();
@@ -68,7 +88,8 @@ bool UGameplayBehavior_Workspot::StartWorkspot(AActor* Avatar, const UWorkspotBe
 		return false;
 	}
 
-	if (!Config->WorkspotTree)
+	UWorkspotTree* WorkspotTree = Config->LoadWorkspotTree();
+	if (!WorkspotTree)
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("StartWorkspot: UWorkspotBehaviorConfig has no WorkspotTree assigned"));
 		return false;
@@ -94,7 +115,7 @@ bool UGameplayBehavior_Workspot::StartWorkspot(AActor* Avatar, const UWorkspotBe
 	// Start workspot through subsystem
 	UWorkspotInstance* Instance = Subsystem->StartWorkspot(
 		Avatar,
-		Config->WorkspotTree,
+		WorkspotTree,
 		Config->PreferredEntryPoint
 	);
 
@@ -111,7 +132,7 @@ bool UGameplayBehavior_Workspot::StartWorkspot(AActor* Avatar, const UWorkspotBe
 	Instance->OnCompleted.AddUObject(this, &UGameplayBehavior_Workspot::OnWorkspotCompleted);
 
 	UE_LOG(LogWorkspot, Log, TEXT("StartWorkspot: Successfully started WorkspotTree '%s' on %s"),
-		*Config->WorkspotTree->GetName(), *Avatar->GetName());
+		*WorkspotTree->GetName(), *Avatar->GetName());
 
 	return true;
 }
@@ -160,6 +181,40 @@ bool UGameplayBehavior_Workspot::IsWorkspotFinished(AActor* Avatar) const
 	return !Instance || Instance->IsFinished();
 }
 
+void UGameplayBehavior_Workspot::OnTreeLoaded()
+{
+	// Behavior ended while the tree was streaming
+	AActor* Avatar = CachedAvatar.Get();
+	if (!Avatar || !CachedConfig || ActiveWorkspotInstance.IsValid())
+	{
+		return;
+	}
+
+	if (!StartWorkspot(Avatar, CachedConfig))
+	{
+		UE_LOG(LogWorkspot, Error, TEXT("UGameplayBehavior_Workspot::OnTreeLoaded - Failed to start workspot on %s"), *Avatar->GetName());
+		EndBehavior(*Avatar, true);
+		return;
+	}
+
+	StartTime = GetWorld()->GetTimeSeconds();
+}
+
+void UGameplayBehavior_Workspot::ReleaseTree(AActor* Avatar)
+{
+	if (!bTreeAcquired || !Avatar || !CachedConfig)
+	{
+		return;
+	}
+
+	if (UWorkspotPreloadSubsystem* PreloadSubsystem = Avatar->GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>())
+	{
+		PreloadSubsystem->ReleaseTree(CachedConfig->WorkspotTree);
+	}
+
+	bTreeAcquired = false;
+}
+
 void UGameplayBehavior_Workspot::OnWorkspotCompleted(UWorkspotInstance* Instance)
 {
 	// Workspot completed, end behavior
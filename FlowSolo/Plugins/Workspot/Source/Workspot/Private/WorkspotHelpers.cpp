@@ -101,7 +101,8 @@ bool UWorkspotHelpers::StartWorkspotFromClaimHandle(AActor* Avatar, const FSmart
 		return false;
 	}
 
-	if (!Config->WorkspotTree)
+	UWorkspotTree* WorkspotTree = Config->LoadWorkspotTree();
+	if (!WorkspotTree)
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("StartWorkspotFromClaimHandle: Config has no WorkspotTree"));
 		return false;
@@ -118,7 +119,7 @@ bool UWorkspotHelpers::StartWorkspotFromClaimHandle(AActor* Avatar, const FSmart
 	// Start workspot
 	UWorkspotInstance* Instance = Subsystem->StartWorkspot(
 		Avatar,
-		Config->WorkspotTree,
+		WorkspotTree,
 		Config->PreferredEntryPoint
 	);
 
@@ -129,7 +130,7 @@ bool UWorkspotHelpers::StartWorkspotFromClaimHandle(AActor* Avatar, const FSmart
 	}
 
 	UE_LOG(LogWorkspot, Log, TEXT("StartWorkspotFromClaimHandle: Successfully started workspot '%s' on %s"),
-		*Config->WorkspotTree->GetName(), *Avatar->GetName());
+		*WorkspotTree->GetName(), *Avatar->GetName());
 
 	return true;
 }
@@ -226,11 +227,6 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 	const FSmartObjectClaimHandle& ClaimHandle,
 	bool bLockAILogic)
 {
-	UE_LOG(LogWorkspot, Display, TEXT(""));
-	UE_LOG(LogWorkspot, Display, TEXT("═══════════════════════════════════════════"));
-	UE_LOG(LogWorkspot, Display, TEXT("  ⭐ ClaimAndUseWorkspotSlot - START"));
-	UE_LOG(LogWorkspot, Display, TEXT("═══════════════════════════════════════════"));
-
 	// Step 1: Validate input
 	if (!Controller)
 	{
@@ -251,7 +247,7 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Display, TEXT("✅ [1/6] Validation passed (Controller: %s, Pawn: %s)"),
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [1/6] Validation passed (Controller: %s, Pawn: %s)"),
 		*Controller->GetName(), *Pawn->GetName());
 
 	// Step 2: Use the slot (mark as occupied)
@@ -262,7 +258,7 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Display, TEXT("✅ [2/6] Slot marked as occupied"));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [2/6] Slot marked as occupied"));
 
 	// Step 3: Get WorkspotBehaviorConfig from BehaviorDefinition
 	const UWorkspotBehaviorConfig* WorkspotConfig = Cast<UWorkspotBehaviorConfig>(BehaviorDef->GameplayBehaviorConfig);
@@ -274,10 +270,10 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Display, TEXT("✅ [3/6] WorkspotBehaviorConfig found"));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [3/6] WorkspotBehaviorConfig found"));
 
 	// Step 4: Get WorkspotTree from config
-	UWorkspotTree* WorkspotTree = WorkspotConfig->WorkspotTree;
+	UWorkspotTree* WorkspotTree = WorkspotConfig->LoadWorkspotTree();
 	if (!WorkspotTree)
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("❌ [4/6] WorkspotBehaviorConfig has no WorkspotTree"));
@@ -290,17 +286,17 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Display, TEXT("✅ [4/6] WorkspotTree valid: %s"), *WorkspotTree->GetName());
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [4/6] WorkspotTree valid: %s"), *WorkspotTree->GetName());
 
 	// Step 5: Lock AI logic if requested
 	if (bLockAILogic)
 	{
 		LockAILogic(Controller);
-		UE_LOG(LogWorkspot, Display, TEXT("✅ [5/6] AI logic locked"));
+		UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [5/6] AI logic locked"));
 	}
 	else
 	{
-		UE_LOG(LogWorkspot, Display, TEXT("⏭️  [5/6] AI logic NOT locked (bLockAILogic = false)"));
+		UE_WORKSPOT_CLAIM_LOG(TEXT("⏭️  [5/6] AI logic NOT locked (bLockAILogic = false)"));
 	}
 
 	// Step 6: Start Workspot via WorkspotSubsystem
@@ -331,14 +327,7 @@ UWorkspotInstance* UWorkspotHelpers::ClaimAndUseWorkspotSlot(
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Display, TEXT("✅ [6/6] Workspot started successfully!"));
-	UE_LOG(LogWorkspot, Display, TEXT(""));
-	UE_LOG(LogWorkspot, Display, TEXT("═══════════════════════════════════════════"));
-	UE_LOG(LogWorkspot, Display, TEXT("  ✅ SUCCESS - Workspot is now playing"));
-	UE_LOG(LogWorkspot, Display, TEXT("  Tree: %s"), *WorkspotTree->GetName());
-	UE_LOG(LogWorkspot, Display, TEXT("  Pawn: %s"), *Pawn->GetName());
-	UE_LOG(LogWorkspot, Display, TEXT("═══════════════════════════════════════════"));
-	UE_LOG(LogWorkspot, Display, TEXT(""));
+	UE_WORKSPOT_CLAIM_LOG(TEXT("✅ [6/6] Workspot '%s' started on '%s'"), *WorkspotTree->GetName(), *Pawn->GetName());
 
 	return Instance;
 }
@@ -389,7 +378,7 @@ const UGameplayBehaviorSmartObjectBehaviorDefinition* UWorkspotHelpers::UseSmart
 		return nullptr;
 	}
 
-	UE_LOG(LogWorkspot, Log, TEXT("UseSmartObjectSlot: Slot marked as occupied, BehaviorDef: %s"),
+	UE_WORKSPOT_CLAIM_LOG(TEXT("UseSmartObjectSlot: Slot marked as occupied, BehaviorDef: %s"),
 		*BehaviorDef->GetName());
 
 	return BehaviorDef;
@@ -410,10 +399,10 @@ void UWorkspotHelpers::LockAILogic(AAIController* Controller)
 	if (BrainComp)
 	{
 		BrainComp->PauseLogic(TEXT("Workspot"));
-		UE_LOG(LogWorkspot, Log, TEXT("LockAILogic: Paused BrainComponent for '%s'"), *Controller->GetName());
+		UE_WORKSPOT_CLAIM_LOG(TEXT("LockAILogic: Paused BrainComponent for '%s'"), *Controller->GetName());
 	}
 
-	UE_LOG(LogWorkspot, Log, TEXT("LockAILogic: AI movement stopped for '%s'"), *Controller->GetName());
+	UE_WORKSPOT_CLAIM_LOG(TEXT("LockAILogic: AI movement stopped for '%s'"), *Controller->GetName());
 }
 
 void UWorkspotHelpers::UnlockAILogic(AAIController* Controller)
@@ -428,10 +417,10 @@ void UWorkspotHelpers::UnlockAILogic(AAIController* Controller)
 	if (BrainComp)
 	{
 		BrainComp->ResumeLogic(TEXT("Workspot"));
-		UE_LOG(LogWorkspot, Log, TEXT("UnlockAILogic: Resumed BrainComponent for '%s'"), *Controller->GetName());
+		UE_WORKSPOT_CLAIM_LOG(TEXT("UnlockAILogic: Resumed BrainComponent for '%s'"), *Controller->GetName());
 	}
 
-	UE_LOG(LogWorkspot, Log, TEXT("UnlockAILogic: AI logic unlocked for '%s'"), *Controller->GetName());
+	UE_WORKSPOT_CLAIM_LOG(TEXT("UnlockAILogic: AI logic unlocked for '%s'"), *Controller->GetName());
 }
 
 bool UWorkspotHelpers::VerifySmartObjectConfiguration(UObject* WorldContextObject, const FSmartObjectClaimHandle& ClaimHandle)
@@ -527,13 +516,13 @@ bool UWorkspotHelpers::VerifySmartObjectConfiguration(UObject* WorldContextObjec
 	UE_LOG(LogWorkspot, Display, TEXT(""));
 	UE_LOG(LogWorkspot, Display, TEXT("📋 ADDITIONAL CHECKS:"));
 
-	if (!WorkspotConfig->WorkspotTree)
+	if (WorkspotConfig->WorkspotTree.IsNull())
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("  ❌ WorkspotTree is NULL in config"));
 		UE_LOG(LogWorkspot, Error, TEXT("     → Assign a WorkspotTree asset in the config"));
 		return false;
 	}
-	UE_LOG(LogWorkspot, Display, TEXT("  ✅ WorkspotTree: %s"), *WorkspotConfig->WorkspotTree->GetName());
+	UE_LOG(LogWorkspot, Display, TEXT("  ✅ WorkspotTree: %s"), *WorkspotConfig->WorkspotTree.GetAssetName());
 
 	//if (!WorkspotConfig->BehaviorClass)
 	//{
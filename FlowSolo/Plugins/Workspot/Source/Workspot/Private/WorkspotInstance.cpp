@@ -4,6 +4,7 @@
 #include "WorkspotTree.h"
 #include "WorkspotIterator.h"
 #include "WorkspotEntry.h"
+#include "WorkspotPropPool.h"
 #include "Workspot.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
@@ -35,10 +36,13 @@ bool UWorkspotInstance::Setup(AActor* InActor, UWorkspotTree* InTree, FName Entr
 	// Store references
 	Actor = InActor;
 	WorkspotTree = InTree;
+	SkeletalMeshComponent = MeshComp;
 	State = EWorkspotState::Starting;
 	CurrentIdleAnim = "stand";
 	PreviousIdleAnim = "stand";
-	CurrentPlayTime = 0.0f;
+	PlayStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	bCurrentAnimationFinished = false;
+	bRequiresPolling = MeshComp->GetAnimInstance() == nullptr;
 
 	// Create context (pure data context for Iterator traversal)
 	FWorkspotContext Context;
@@ -47,9 +51,15 @@ bool UWorkspotInstance::Setup(AActor* InActor, UWorkspotTree* InTree, FName Entr
 	Context.CurrentIdle = CurrentIdleAnim;
 	Context.PreviousIdle = PreviousIdleAnim;
 
-	// Create iterator
-	Iterator = InTree->RootEntry->CreateIterator(Context);
-	if (!Iterator.IsValid())
+	// Trees created or modified at runtime may not have been compiled
+	if (!InTree->GetProgram().IsValid())
+	{
+		InTree->CompileProgram();
+	}
+
+	// Start iterator
+	Iterator.Start(InTree);
+	if (!Iterator.IsRunning())
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("WorkspotInstance::Setup - Failed to create iterator"));
 		State = EWorkspotState::Inactive;
@@ -57,13 +67,13 @@ bool UWorkspotInstance::Setup(AActor* InActor, UWorkspotTree* InTree, FName Entr
 	}
 
 	// Start first entry
-	if (Iterator->Next(Context))
+	if (Iterator.Next(Context))
 	{
 		// Log initial Entry type
 		UE_LOG(LogWorkspot, Log, TEXT("  ➡️  WorkspotInstance - Initial Entry: %s"),
-			*Iterator->GetDebugString());
+			*Iterator.GetDebugString());
 
-		if (Iterator->GetData(CurrentEntryData))
+		if (Iterator.GetData(CurrentEntryData))
 		{
 			PlayCurrentAnimation();
 			State = EWorkspotState::Playing;
@@ -82,63 +92,84 @@ bool UWorkspotInstance::Setup(AActor* InActor, UWorkspotTree* InTree, FName Entr
 
 void UWorkspotInstance::Tick(float DeltaTime)
 {
-	if (State != EWorkspotState::Playing || !Iterator.IsValid())
+	if (State != EWorkspotState::Playing || !Iterator.IsRunning())
 	{
 		return;
 	}
 
-	AActor* CurrentActor = Actor.Get();
-	if (!CurrentActor)
+	if (!Actor.IsValid())
 	{
 		Stop(true);
 		return;
 	}
 
+	// Finished entries are skipped by FastForward when promoted
+	if (UpdateBucket == EWorkspotUpdateBucket::Frozen)
+	{
+		return;
+	}
+
 	// Check if current animation finished
 	if (IsCurrentAnimationFinished())
 	{
-		// Create context for next iteration
-		FWorkspotContext Context;
-		Context.User = CurrentActor;
-		Context.Tree = WorkspotTree.Get();
-		Context.CurrentIdle = CurrentIdleAnim;
-		Context.PreviousIdle = PreviousIdleAnim;
+		AdvanceIterator();
+	}
+}
 
-		// Advance to next entry
-		if (Iterator->Next(Context))
-		{
-			// Log current Entry type for debugging
-			UE_LOG(LogWorkspot, Log, TEXT("  ➡️  WorkspotInstance - Executing Entry: %s"),
-				*Iterator->GetDebugString());
+bool UWorkspotInstance::AdvanceIterator(bool bPlayAnimation)
+{
+	bCurrentAnimationFinished = false;
 
-			FWorkspotEntryData NewEntryData;
-			if (Iterator->GetData(NewEntryData))
-			{
-				// Check for idle change
-				if (NewEntryData.IdleAnim != CurrentIdleAnim)
-				{
-					HandleIdleChange(NewEntryData.IdleAnim);
-				}
+	// Create context for next iteration
+	FWorkspotContext Context;
+	Context.User = Actor.Get();
+	Context.Tree = WorkspotTree.Get();
+	Context.CurrentIdle = CurrentIdleAnim;
+	Context.PreviousIdle = PreviousIdleAnim;
 
-				CurrentEntryData = NewEntryData;
-				PlayCurrentAnimation();
+	// Advance to next entry
+	if (Iterator.Next(Context))
+	{
+		// Log current Entry type for debugging
+		UE_LOG(LogWorkspot, Log, TEXT("  ➡️  WorkspotInstance - Executing Entry: %s"),
+			*Iterator.GetDebugString());
+
+		FWorkspotEntryData NewEntryData;
+		if (Iterator.GetData(NewEntryData))
+		{
+			// Check for idle change
+			if (NewEntryData.IdleAnim != CurrentIdleAnim)
+			{
+				HandleIdleChange(NewEntryData.IdleAnim);
 			}
-			else
+
+			CurrentEntryData = NewEntryData;
+			if (bPlayAnimation)
 			{
-				UE_LOG(LogWorkspot, Warning, TEXT("WorkspotInstance::Tick - Iterator returned true but no data"));
-				Stop(false);
+				PlayCurrentAnimation();
 			}
 		}
 		else
 		{
-			// Iterator finished
-			UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::Tick - Workspot completed"));
+			UE_LOG(LogWorkspot, Warning, TEXT("WorkspotInstance::Tick - Iterator returned true but no data"));
 			Stop(false);
-			OnCompleted.Broadcast(this);
 		}
 	}
+	else
+	{
+		// Iterator finished
+		UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::Tick - Workspot completed"));
+		Stop(false);
+		OnCompleted.Broadcast(this);
+	}
 
-	CurrentPlayTime += DeltaTime;
+	return State == EWorkspotState::Playing;
+}
+
+float UWorkspotInstance::GetCurrentPlayTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? static_cast<float>(World->GetTimeSeconds() - PlayStartTime) : 0.0f;
 }
 
 void UWorkspotInstance::Stop(bool bForceStop)
@@ -151,6 +182,8 @@ void UWorkspotInstance::Stop(bool bForceStop)
 	UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::Stop - Stopping workspot (Force: %s)"),
 		bForceStop ? TEXT("Yes") : TEXT("No"));
 
+	RestoreMeshTick();
+
 	// Stop animation
 	USkeletalMeshComponent* MeshComp = GetSkeletalMeshComponent();
 	if (MeshComp && CurrentEntryData.AnimMontage)
@@ -171,8 +204,12 @@ void UWorkspotInstance::Stop(bool bForceStop)
 	// Despawn props
 	DespawnAllProps();
 
+	// Montage events of the stopped animation are ignored from now on
+	PlaybackSerial++;
+	bCurrentAnimationFinished = false;
+
 	// Reset state
-	Iterator.Reset();
+	Iterator.Clear();
 	CurrentEntryData = FWorkspotEntryData();
 	State = EWorkspotState::Finished;
 
@@ -203,25 +240,27 @@ UAnimInstance* UWorkspotInstance::GetAnimInstance() const
 
 USkeletalMeshComponent* UWorkspotInstance::GetSkeletalMeshComponent() const
 {
-	if (AActor* CurrentActor = Actor.Get())
-	{
-		return CurrentActor->FindComponentByClass<USkeletalMeshComponent>();
-	}
-	return nullptr;
+	return SkeletalMeshComponent.Get();
 }
 
-void UWorkspotInstance::PlayCurrentAnimation()
+void UWorkspotInstance::PlayCurrentAnimation(float StartPosition)
 {
+	PlaybackSerial++;
+	bCurrentAnimationFinished = false;
+	PlayStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() - StartPosition : 0.0;
+
 	USkeletalMeshComponent* MeshComp = GetSkeletalMeshComponent();
 	if (!MeshComp)
 	{
 		UE_LOG(LogWorkspot, Error, TEXT("WorkspotInstance::PlayCurrentAnimation - No SkeletalMeshComponent"));
+		RequestUpdate();
 		return;
 	}
 
 	if (!CurrentEntryData.AnimMontage)
 	{
 		UE_LOG(LogWorkspot, Warning, TEXT("WorkspotInstance::PlayCurrentAnimation - No montage to play"));
+		RequestUpdate();
 		return;
 	}
 
@@ -234,11 +273,26 @@ void UWorkspotInstance::PlayCurrentAnimation()
 			CurrentEntryData.AnimMontage,
 			1.0f, // Play rate
 			EMontagePlayReturnType::MontageLength,
-			0.0f, // Start position
+			StartPosition,
 			true  // Stop all montages
 		);
 
-		CurrentPlayTime = 0.0f;
+		if (PlayLength > 0.0f)
+		{
+			// Blend out is when Montage_IsPlaying starts returning false, end covers montages stopped without blending
+			FOnMontageBlendingOutStarted BlendingOutDelegate = FOnMontageBlendingOutStarted::CreateUObject(
+				this, &UWorkspotInstance::OnMontageFinished, PlaybackSerial);
+			AnimInst->Montage_SetBlendingOutDelegate(BlendingOutDelegate, CurrentEntryData.AnimMontage);
+
+			FOnMontageEnded EndDelegate = FOnMontageEnded::CreateUObject(
+				this, &UWorkspotInstance::OnMontageFinished, PlaybackSerial);
+			AnimInst->Montage_SetEndDelegate(EndDelegate, CurrentEntryData.AnimMontage);
+		}
+		else
+		{
+			// Montage couldn't play, move on next update
+			RequestUpdate();
+		}
 
 		UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::PlayCurrentAnimation - Playing '%s' via AnimInstance (Idle: %s, Length: %.2f)"),
 			*CurrentEntryData.AnimMontage->GetName(),
@@ -250,8 +304,6 @@ void UWorkspotInstance::PlayCurrentAnimation()
 		// No AnimInstance, play animation directly on SkeletalMeshComponent
 		MeshComp->PlayAnimation(CurrentEntryData.AnimMontage, false);
 
-		CurrentPlayTime = 0.0f;
-
 		UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::PlayCurrentAnimation - Playing '%s' directly on SkeletalMeshComponent (Idle: %s)"),
 			*CurrentEntryData.AnimMontage->GetName(),
 			*CurrentEntryData.IdleAnim.ToString());
@@ -260,7 +312,7 @@ void UWorkspotInstance::PlayCurrentAnimation()
 
 bool UWorkspotInstance::IsCurrentAnimationFinished() const
 {
-	if (!CurrentEntryData.AnimMontage)
+	if (!CurrentEntryData.AnimMontage || bCurrentAnimationFinished)
 	{
 		return true;
 	}
@@ -271,29 +323,188 @@ bool UWorkspotInstance::IsCurrentAnimationFinished() const
 		return true;
 	}
 
-	// Check if using AnimInstance
-	UAnimInstance* AnimInst = MeshComp->GetAnimInstance();
-	if (AnimInst)
+	// Montage events set bCurrentAnimationFinished, only direct playback needs to be checked
+	if (bRequiresPolling && !MeshComp->GetAnimInstance())
 	{
-		// Check if montage is still playing through AnimInstance
-		return !AnimInst->Montage_IsPlaying(CurrentEntryData.AnimMontage);
+		return !MeshComp->IsPlaying();
 	}
-	else
+
+	return false;
+}
+
+void UWorkspotInstance::SetUpdateBucket(EWorkspotUpdateBucket NewBucket, float ReducedTickInterval)
+{
+	USkeletalMeshComponent* MeshComp = GetSkeletalMeshComponent();
+	if (State != EWorkspotState::Playing || bRequiresPolling || !MeshComp)
+	{
+		return;
+	}
+
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	if (NewBucket == UpdateBucket)
+	{
+		// Finite trees still have to complete while nobody looks at them
+		if (UpdateBucket == EWorkspotUpdateBucket::Frozen)
+		{
+			FastForward(static_cast<float>(Now - FrozenTime), false);
+		}
+		return;
+	}
+
+	const EWorkspotUpdateBucket OldBucket = UpdateBucket;
+	UpdateBucket = NewBucket;
+
+	if (OldBucket == EWorkspotUpdateBucket::Full)
+	{
+		MeshTickInterval = MeshComp->GetComponentTickInterval();
+		bMeshTickEnabled = MeshComp->IsComponentTickEnabled();
+	}
+
+	if (OldBucket == EWorkspotUpdateBucket::Frozen)
+	{
+		MeshComp->SetComponentTickInterval(MeshTickInterval);
+		MeshComp->SetComponentTickEnabled(bMeshTickEnabled);
+		FastForward(static_cast<float>(Now - FrozenTime), true);
+
+		if (State != EWorkspotState::Playing)
+		{
+			return;
+		}
+	}
+
+	switch (NewBucket)
 	{
-		return MeshComp->IsPlaying();
-		// Direct playback - check if animation is still playing on component
-	//UAnimationAsset* CurrentAnim = MeshComp->GetAnimationAsset();
-	//if (CurrentAnim == CurrentEntryData.AnimMontage)
-	//{
-	//	// Animation is still playing
-	//	return !MeshComp->IsPlaying();
-	//}
-	//else
-	//{
-	//	// Different animation is playing (or none)
-	//	return true;
-	//}
+	case EWorkspotUpdateBucket::Full:
+		MeshComp->SetComponentTickInterval(MeshTickInterval);
+		break;
+
+	case EWorkspotUpdateBucket::Reduced:
+		MeshComp->SetComponentTickInterval(FMath::Max(MeshTickInterval, ReducedTickInterval));
+		break;
+
+	case EWorkspotUpdateBucket::Frozen:
+		{
+			UAnimInstance* AnimInst = MeshComp->GetAnimInstance();
+			FrozenTime = Now;
+			FrozenPosition = AnimInst && CurrentEntryData.AnimMontage ? AnimInst->Montage_GetPosition(CurrentEntryData.AnimMontage) : 0.0f;
+			bAdvancedWhileFrozen = false;
+			MeshComp->SetComponentTickEnabled(false);
+		}
+		break;
+	}
+
+	UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotInstance::SetUpdateBucket - '%s' %d -> %d"),
+		Actor.IsValid() ? *Actor->GetName() : TEXT("NULL"), (int32)OldBucket, (int32)NewBucket);
+}
+
+void UWorkspotInstance::FastForward(float ElapsedTime, bool bResume)
+{
+	// Bounds the work after a long freeze, the time left once reached is dropped
+	constexpr int32 MaxSkippedEntries = 32;
+
+	float Position = FrozenPosition;
+	float Remaining = bCurrentAnimationFinished || !CurrentEntryData.AnimMontage
+		? 0.0f
+		: FMath::Max(CurrentEntryData.AnimMontage->GetPlayLength() - Position, 0.0f);
+
+	int32 SkippedEntries = 0;
+	int32 ZeroLengthEntries = 0;
+	while (ElapsedTime >= Remaining)
+	{
+		// Zero length entries take no time, a longer run of them than the budget means there is nothing timed to skip to
+		if (Remaining <= 0.0f)
+		{
+			if (++ZeroLengthEntries > MaxSkippedEntries)
+			{
+				ElapsedTime = 0.0f;
+				break;
+			}
+		}
+		else if (++SkippedEntries > MaxSkippedEntries)
+		{
+			ElapsedTime = 0.0f;
+			break;
+		}
+		else
+		{
+			ZeroLengthEntries = 0;
+		}
+
+		ElapsedTime -= Remaining;
+		bAdvancedWhileFrozen = true;
+
+		if (!AdvanceIterator(false))
+		{
+			return;
+		}
+
+		Position = 0.0f;
+		Remaining = CurrentEntryData.AnimMontage ? CurrentEntryData.AnimMontage->GetPlayLength() : 0.0f;
+	}
+
+	const float StartPosition = Position + ElapsedTime;
+
+	// Still frozen, only the iterator moves
+	if (!bResume)
+	{
+		FrozenTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+		FrozenPosition = StartPosition;
+		return;
+	}
+
+	// Still on the same clip, only move the montage
+	UAnimInstance* AnimInst = GetAnimInstance();
+	if (!bAdvancedWhileFrozen && AnimInst && CurrentEntryData.AnimMontage && AnimInst->Montage_IsActive(CurrentEntryData.AnimMontage))
+	{
+		AnimInst->Montage_SetPosition(CurrentEntryData.AnimMontage, StartPosition);
+		PlayStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() - StartPosition : 0.0;
+		return;
+	}
+
+	PlayCurrentAnimation(StartPosition);
+}
+
+void UWorkspotInstance::RestoreMeshTick()
+{
+	if (UpdateBucket == EWorkspotUpdateBucket::Full)
+	{
+		return;
+	}
+
+	if (USkeletalMeshComponent* MeshComp = GetSkeletalMeshComponent())
+	{
+		MeshComp->SetComponentTickInterval(MeshTickInterval);
+		MeshComp->SetComponentTickEnabled(bMeshTickEnabled);
 	}
+
+	UpdateBucket = EWorkspotUpdateBucket::Full;
+}
+
+void UWorkspotInstance::RequestUpdate()
+{
+	if (bCurrentAnimationFinished)
+	{
+		return;
+	}
+
+	bCurrentAnimationFinished = true;
+	OnUpdateRequested.Broadcast(this);
+}
+
+void UWorkspotInstance::OnMontageFinished(UAnimMontage* Montage, bool bInterrupted, uint32 Serial)
+{
+	// Events from a montage we already moved past, or from stopping
+	if (Serial != PlaybackSerial || State != EWorkspotState::Playing)
+	{
+		return;
+	}
+
+	UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotInstance::OnMontageFinished - '%s' (Interrupted: %s)"),
+		Montage ? *Montage->GetName() : TEXT("NULL"),
+		bInterrupted ? TEXT("Yes") : TEXT("No"));
+
+	RequestUpdate();
 }
 
 void UWorkspotInstance::HandleIdleChange(FName NewIdle)
@@ -387,29 +598,16 @@ void UWorkspotInstance::SpawnProp(const FWorkspotGlobalProp& PropDef)
 
 	AActor* CurrentActor = Actor.Get();
 	USkeletalMeshComponent* MeshComp = GetSkeletalMeshComponent();
-	if (!CurrentActor || !MeshComp)
+	UWorkspotPropPool* PropPool = GetWorld() ? GetWorld()->GetSubsystem<UWorkspotPropPool>() : nullptr;
+	if (!CurrentActor || !MeshComp || !PropPool)
 	{
 		return;
 	}
 
-	// Spawn prop actor
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = CurrentActor;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AActor* PropActor = GetWorld()->SpawnActor<AActor>(
-		PropDef.PropClass,
-		FTransform::Identity,
-		SpawnParams);
-
+	// Recycled from the pool and attached to the socket
+	AActor* PropActor = PropPool->AcquireProp(PropDef.PropClass, CurrentActor, MeshComp, PropDef.AttachSocketName);
 	if (PropActor)
 	{
-		// Attach to socket
-		PropActor->AttachToComponent(
-			MeshComp,
-			FAttachmentTransformRules::SnapToTargetIncludingScale,
-			PropDef.AttachSocketName);
-
 		SpawnedProps.Add(PropDef.PropId, PropActor);
 
 		UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::SpawnProp - Spawned '%s' on socket '%s'"),
@@ -423,7 +621,7 @@ void UWorkspotInstance::DespawnProp(FName PropId)
 	TObjectPtr<AActor>* FoundProp = SpawnedProps.Find(PropId);
 	if (FoundProp && *FoundProp)
 	{
-		(*FoundProp)->Destroy();
+		ReleaseProp(*FoundProp);
 		SpawnedProps.Remove(PropId);
 
 		UE_LOG(LogWorkspot, Log, TEXT("WorkspotInstance::DespawnProp - Despawned '%s'"),
@@ -437,10 +635,23 @@ void UWorkspotInstance::DespawnAllProps()
 	{
 		if (Pair.Value)
 		{
-			Pair.Value->Destroy();
+			ReleaseProp(Pair.Value);
 		}
 	}
 	SpawnedProps.Empty();
 
 	UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotInstance::DespawnAllProps - Cleared all props"));
 }
+
+void UWorkspotInstance::ReleaseProp(AActor* PropActor)
+{
+	UWorkspotPropPool* PropPool = GetWorld() ? GetWorld()->GetSubsystem<UWorkspotPropPool>() : nullptr;
+	if (PropPool)
+	{
+		PropPool->ReleaseProp(PropActor);
+	}
+	else
+	{
+		PropActor->Destroy();
+	}
+}
@@ -814,3 +814,289 @@ bool FSelectorIterator::TryInsertTransitionAnim(FName FromIdle, FName ToIdle, FW
 	bPlayingTransition = true;
 	return true;
 }
+
+//////////////////////////////////////////////////////////////////////////
+// FWorkspotProgramIterator
+//////////////////////////////////////////////////////////////////////////
+
+void FWorkspotProgramIterator::Start(const UWorkspotTree* InTree)
+{
+	Clear();
+
+	if (InTree && InTree->GetProgram().IsValid())
+	{
+		Tree = InTree;
+		Program = &InTree->GetProgram();
+		ProgramRevision = InTree->GetProgramRevision();
+	}
+}
+
+void FWorkspotProgramIterator::Clear()
+{
+	Tree = nullptr;
+	Program = nullptr;
+	Reset();
+}
+
+void FWorkspotProgramIterator::Reset()
+{
+	Stack.Reset();
+	CurrentClip = INDEX_NONE;
+	TransitionMontage = nullptr;
+	TransitionIdle = NAME_None;
+	PendingChild = INDEX_NONE;
+	bStarted = false;
+}
+
+bool FWorkspotProgramIterator::IsProgramValid() const
+{
+	return Tree && Program && Tree->GetProgramRevision() == ProgramRevision;
+}
+
+bool FWorkspotProgramIterator::Next(FWorkspotContext& Context)
+{
+	if (!IsProgramValid())
+	{
+		return false;
+	}
+
+	CurrentClip = INDEX_NONE;
+	TransitionMontage = nullptr;
+
+	if (!bStarted)
+	{
+		bStarted = true;
+		PushNode(0, Context);
+	}
+	else if (PendingChild != INDEX_NONE)
+	{
+		// Transition played, enter the selected child
+		PushNode(PendingChild, Context);
+		PendingChild = INDEX_NONE;
+	}
+
+	return Run(Context);
+}
+
+void FWorkspotProgramIterator::PushNode(int32 NodeIndex, FWorkspotContext& Context)
+{
+	const FWorkspotProgramNode& Node = Program->Nodes[NodeIndex];
+
+	int32 Counter = 0;
+	if (Node.Type == EWorkspotProgramNodeType::RandomList)
+	{
+		Counter = FMath::Min(Context.RandomGen.RandRange(Node.MinClips, Node.MaxClips), Node.NumChildren);
+	}
+
+	Stack.Add({ NodeIndex, -1, Counter });
+}
+
+bool FWorkspotProgramIterator::Run(FWorkspotContext& Context)
+{
+	while (Stack.Num() > 0)
+	{
+		FFrame& Frame = Stack.Top();
+		const FWorkspotProgramNode& Node = Program->Nodes[Frame.Node];
+		int32 Child = INDEX_NONE;
+
+		switch (Node.Type)
+		{
+		case EWorkspotProgramNodeType::Clip:
+			if (Frame.Cursor < 0)
+			{
+				Frame.Cursor = 0;
+				CurrentClip = Node.Clip;
+				return true;
+			}
+			break;
+
+		case EWorkspotProgramNodeType::Sequence:
+			if (++Frame.Cursor < Node.NumChildren)
+			{
+				Child = Program->Children[Node.FirstChild + Frame.Cursor];
+			}
+			else if (Node.bLoopInfinitely || Frame.Counter < Node.MaxLoops - 1)
+			{
+				Frame.Counter++;
+				Frame.Cursor = -1;
+
+				// Play the idle loop between iterations
+				if (Node.bLoopInfinitely && Node.Clip != INDEX_NONE)
+				{
+					CurrentClip = Node.Clip;
+					return true;
+				}
+				continue;
+			}
+			break;
+
+		case EWorkspotProgramNodeType::RandomList:
+			if (Frame.Counter-- > 0)
+			{
+				Child = Program->ChooseChild(Node, Context.RandomGen);
+			}
+			break;
+
+		case EWorkspotProgramNodeType::Selector:
+			{
+				Child = Program->ChooseChild(Node, Context.RandomGen);
+
+				// IdleGuard: play a transition before entering a child with another idle
+				const FName ChildIdle = Program->Nodes[Child].IdleAnim;
+				if (Context.CurrentIdle != ChildIdle)
+				{
+					UAnimMontage* Transition = Tree->FindTransitionAnim(Context.CurrentIdle, ChildIdle);
+					Context.PreviousIdle = Context.CurrentIdle;
+					Context.CurrentIdle = ChildIdle;
+
+					if (Transition)
+					{
+						TransitionMontage = Transition;
+						TransitionIdle = ChildIdle;
+						PendingChild = Child;
+						return true;
+					}
+				}
+			}
+			break;
+		}
+
+		if (Child == INDEX_NONE)
+		{
+			Stack.Pop(EAllowShrinking::No);
+			continue;
+		}
+
+		PushNode(Child, Context);
+	}
+
+	return false;
+}
+
+bool FWorkspotProgramIterator::GetData(FWorkspotEntryData& OutData) const
+{
+	if (!IsProgramValid())
+	{
+		return false;
+	}
+
+	if (TransitionMontage)
+	{
+		OutData = FWorkspotEntryData();
+		OutData.AnimMontage = TransitionMontage;
+		OutData.IdleAnim = TransitionIdle; // Transition ends in new idle
+		OutData.BlendInTime = 0.2f;
+		OutData.BlendOutTime = 0.2f;
+		OutData.bIsValid = true;
+		return true;
+	}
+
+	if (CurrentClip == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutData = Program->Clips[CurrentClip];
+
+	// ⭐ 2077 Core Feature: Clips without animation play the idle loop of the closest sequence
+	if (OutData.AnimMontage == nullptr && OutData.bIsValid)
+	{
+		for (int32 FrameIndex = Stack.Num() - 2; FrameIndex >= 0; --FrameIndex)
+		{
+			const FWorkspotProgramNode& Node = Program->Nodes[Stack[FrameIndex].Node];
+			if (Node.Type == EWorkspotProgramNodeType::Sequence && Node.Clip != INDEX_NONE)
+			{
+				const FWorkspotEntryData& IdleLoopData = Program->Clips[Node.Clip];
+				OutData.AnimMontage = IdleLoopData.AnimMontage;
+				OutData.BlendInTime = IdleLoopData.BlendInTime;
+				OutData.BlendOutTime = IdleLoopData.BlendOutTime;
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FWorkspotProgramIterator::HasNext() const
+{
+	if (!IsProgramValid())
+	{
+		return false;
+	}
+
+	if (!bStarted || PendingChild != INDEX_NONE)
+	{
+		return true;
+	}
+
+	for (const FFrame& Frame : Stack)
+	{
+		const FWorkspotProgramNode& Node = Program->Nodes[Frame.Node];
+		switch (Node.Type)
+		{
+		case EWorkspotProgramNodeType::Sequence:
+			if (Frame.Cursor + 1 < Node.NumChildren || Node.bLoopInfinitely || Frame.Counter < Node.MaxLoops - 1)
+			{
+				return true;
+			}
+			break;
+
+		case EWorkspotProgramNodeType::RandomList:
+			if (Frame.Counter > 0)
+			{
+				return true;
+			}
+			break;
+
+		case EWorkspotProgramNodeType::Selector:
+			return true;
+
+		default:
+			break;
+		}
+	}
+
+	return false;
+}
+
+FString FWorkspotProgramIterator::GetDetailString() const
+{
+	if (!IsProgramValid())
+	{
+		return TEXT("NULL");
+	}
+
+	if (TransitionMontage)
+	{
+		return TEXT("[Transition]");
+	}
+
+	FString Result;
+	for (const FFrame& Frame : Stack)
+	{
+		const FWorkspotProgramNode& Node = Program->Nodes[Frame.Node];
+		if (!Result.IsEmpty())
+		{
+			Result += TEXT(" -> ");
+		}
+
+		switch (Node.Type)
+		{
+		case EWorkspotProgramNodeType::Clip:
+			Result += TEXT("Clip");
+			break;
+		case EWorkspotProgramNodeType::Sequence:
+			Result += FString::Printf(TEXT("Sequence [%d/%d]"), FMath::Max(Frame.Cursor, 0) + 1, Node.NumChildren);
+			break;
+		case EWorkspotProgramNodeType::RandomList:
+			Result += FString::Printf(TEXT("RandomList [%d left]"), Frame.Counter);
+			break;
+		case EWorkspotProgramNodeType::Selector:
+			Result += TEXT("Selector");
+			break;
+		}
+	}
+
+	return Result.IsEmpty() ? TEXT("[Initializing]") : Result;
+}
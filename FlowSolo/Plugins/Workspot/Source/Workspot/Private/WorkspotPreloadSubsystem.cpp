@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WorkspotPreloadSubsystem.h"
+#include "WorkspotTree.h"
+#include "Workspot.h"
+#include "Engine/World.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Console Variables
+//////////////////////////////////////////////////////////////////////////
+
+namespace UE::Workspot
+{
+	static float PreloadKeepResidentTime = 30.0f;
+	static FAutoConsoleVariableRef CVarPreloadKeepResidentTime(
+		TEXT("workspot.Preload.KeepResidentTime"),
+		PreloadKeepResidentTime,
+		TEXT("Seconds a workspot tree stays resident after its last user released it."),
+		ECVF_Default);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Subsystem Implementation
+//////////////////////////////////////////////////////////////////////////
+
+void UWorkspotPreloadSubsystem::Deinitialize()
+{
+	for (auto& Pair : Entries)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->ReleaseHandle();
+		}
+	}
+	Entries.Reset();
+	NumUnusedEntries = 0;
+
+	Super::Deinitialize();
+}
+
+void UWorkspotPreloadSubsystem::Tick(float DeltaTime)
+{
+	if (NumUnusedEntries == 0)
+	{
+		return;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FWorkspotPreloadEntry& Entry = It.Value();
+		if (Entry.RefCount > 0 || Now < Entry.ReleaseTime)
+		{
+			continue;
+		}
+
+		UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotPreloadSubsystem - Releasing '%s'"), *It.Key().ToString());
+
+		if (Entry.Handle.IsValid())
+		{
+			Entry.Handle->ReleaseHandle();
+		}
+		It.RemoveCurrent();
+		NumUnusedEntries--;
+	}
+}
+
+TStatId UWorkspotPreloadSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWorkspotPreloadSubsystem, STATGROUP_Tickables);
+}
+
+void UWorkspotPreloadSubsystem::AcquireTree(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree)
+{
+	if (WorkspotTree.IsNull())
+	{
+		return;
+	}
+
+	const FSoftObjectPath& Path = WorkspotTree.ToSoftObjectPath();
+
+	FWorkspotPreloadEntry* Entry = Entries.Find(Path);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(Path);
+
+		// The tree hard references its montages, transitions and prop classes, they stream with it
+		Entry->Handle = StreamableManager.RequestAsyncLoad(Path,
+			FStreamableDelegate::CreateUObject(this, &UWorkspotPreloadSubsystem::HandleTreeLoaded, Path),
+			FStreamableManager::AsyncLoadHighPriority);
+
+		UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotPreloadSubsystem - Streaming '%s'"), *Path.ToString());
+	}
+	else if (Entry->RefCount == 0)
+	{
+		NumUnusedEntries--;
+	}
+
+	Entry->RefCount++;
+}
+
+void UWorkspotPreloadSubsystem::ReleaseTree(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree)
+{
+	FWorkspotPreloadEntry* Entry = Entries.Find(WorkspotTree.ToSoftObjectPath());
+	if (!Entry || Entry->RefCount == 0)
+	{
+		return;
+	}
+
+	if (--Entry->RefCount == 0)
+	{
+		Entry->ReleaseTime = GetWorld()->GetTimeSeconds() + UE::Workspot::PreloadKeepResidentTime;
+		NumUnusedEntries++;
+	}
+}
+
+bool UWorkspotPreloadSubsystem::IsTreeLoading(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree) const
+{
+	const FWorkspotPreloadEntry* Entry = Entries.Find(WorkspotTree.ToSoftObjectPath());
+	return Entry && Entry->Handle.IsValid() && Entry->Handle->IsLoadingInProgress();
+}
+
+void UWorkspotPreloadSubsystem::CallWhenTreeLoaded(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree, FSimpleDelegate Callback)
+{
+	FWorkspotPreloadEntry* Entry = Entries.Find(WorkspotTree.ToSoftObjectPath());
+	if (Entry && Entry->Handle.IsValid() && Entry->Handle->IsLoadingInProgress())
+	{
+		Entry->LoadedCallbacks.Add(MoveTemp(Callback));
+		return;
+	}
+
+	Callback.ExecuteIfBound();
+}
+
+void UWorkspotPreloadSubsystem::HandleTreeLoaded(FSoftObjectPath Path)
+{
+	FWorkspotPreloadEntry* Entry = Entries.Find(Path);
+	if (!Entry)
+	{
+		return;
+	}
+
+	// Callbacks may acquire other trees
+	TArray<FSimpleDelegate> Callbacks = MoveTemp(Entry->LoadedCallbacks);
+	for (const FSimpleDelegate& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
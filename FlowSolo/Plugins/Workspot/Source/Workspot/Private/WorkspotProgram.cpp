@@ -0,0 +1,218 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WorkspotProgram.h"
+#include "WorkspotEntry.h"
+#include "Workspot.h"
+#include "Animation/AnimMontage.h"
+
+void FWorkspotProgram::Compile(const UWorkspotEntry* RootEntry)
+{
+	Clips.Reset();
+	Nodes.Reset();
+	Children.Reset();
+	AliasProbabilities.Reset();
+	AliasIndices.Reset();
+
+	if (RootEntry && CompileEntry(RootEntry) == INDEX_NONE)
+	{
+		// Root was an empty container
+		Nodes.Reset();
+	}
+
+	UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotProgram::Compile - %d nodes, %d clips"), Nodes.Num(), Clips.Num());
+}
+
+int32 FWorkspotProgram::ChooseChild(const FWorkspotProgramNode& Node, FRandomStream& Random) const
+{
+	const int32 Column = Random.RandRange(0, Node.NumChildren - 1);
+	const int32 Index = Node.FirstChild + Column;
+	const int32 Selected = Random.FRand() < AliasProbabilities[Index] ? Column : AliasIndices[Index];
+
+	return Children[Node.FirstChild + Selected];
+}
+
+int32 FWorkspotProgram::CompileEntry(const UWorkspotEntry* Entry)
+{
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	Nodes[NodeIndex].IdleAnim = Entry->IdleAnim;
+
+	// Leaves
+	FWorkspotEntryData Data;
+	Data.IdleAnim = Entry->IdleAnim;
+	Data.bIsValid = true;
+
+	if (const UWorkspotAnimClip* AnimClip = Cast<UWorkspotAnimClip>(Entry))
+	{
+		Data.AnimMontage = AnimClip->AnimMontage;
+		Data.BlendInTime = AnimClip->BlendInTime;
+		Data.BlendOutTime = AnimClip->BlendOutTime;
+	}
+	else if (const UWorkspotEntryAnim* EntryAnim = Cast<UWorkspotEntryAnim>(Entry))
+	{
+		Data.AnimMontage = EntryAnim->AnimMontage;
+		Data.BlendInTime = 0.3f;
+		Data.BlendOutTime = 0.3f;
+	}
+	else if (const UWorkspotExitAnim* ExitAnim = Cast<UWorkspotExitAnim>(Entry))
+	{
+		Data.AnimMontage = ExitAnim->AnimMontage;
+		Data.BlendInTime = ExitAnim->bFastExit ? 0.1f : 0.3f;
+		Data.BlendOutTime = ExitAnim->bFastExit ? 0.1f : 0.3f;
+	}
+	else if (const UWorkspotPause* Pause = Cast<UWorkspotPause>(Entry))
+	{
+		// No montage makes the parent sequence inject its idle loop
+		Data.AnimMontage = Pause->bUseParentIdle ? nullptr : Pause->CustomIdleMontage.Get();
+		Data.BlendInTime = Pause->PauseBlendTime;
+		Data.BlendOutTime = Pause->PauseBlendTime;
+	}
+	else
+	{
+		Data.bIsValid = false;
+	}
+
+	if (Data.bIsValid)
+	{
+		Nodes[NodeIndex].Type = EWorkspotProgramNodeType::Clip;
+		Nodes[NodeIndex].Clip = Clips.Add(Data);
+		return NodeIndex;
+	}
+
+	// Containers, children are compiled first so their range is contiguous
+	const TArray<TObjectPtr<UWorkspotEntry>>* Entries = nullptr;
+	const TArray<float>* Weights = nullptr;
+
+	if (const UWorkspotSequence* Sequence = Cast<UWorkspotSequence>(Entry))
+	{
+		Nodes[NodeIndex].Type = EWorkspotProgramNodeType::Sequence;
+		Nodes[NodeIndex].bLoopInfinitely = Sequence->bLoopInfinitely;
+		Nodes[NodeIndex].MaxLoops = Sequence->MaxLoops;
+
+		if (Sequence->IdleLoopMontage)
+		{
+			FWorkspotEntryData IdleLoopData;
+			IdleLoopData.AnimMontage = Sequence->IdleLoopMontage;
+			IdleLoopData.IdleAnim = Sequence->IdleAnim;
+			IdleLoopData.BlendInTime = Sequence->IdleLoopBlendTime;
+			IdleLoopData.BlendOutTime = Sequence->IdleLoopBlendTime;
+			IdleLoopData.bIsValid = true;
+			Nodes[NodeIndex].Clip = Clips.Add(IdleLoopData);
+		}
+
+		Entries = &Sequence->Entries;
+	}
+	else if (const UWorkspotRandomList* RandomList = Cast<UWorkspotRandomList>(Entry))
+	{
+		Nodes[NodeIndex].Type = EWorkspotProgramNodeType::RandomList;
+		Nodes[NodeIndex].MinClips = FMath::Max(RandomList->MinClips, 1);
+		Nodes[NodeIndex].MaxClips = FMath::Max(RandomList->MaxClips, Nodes[NodeIndex].MinClips);
+
+		Entries = &RandomList->Entries;
+		Weights = &RandomList->Weights;
+	}
+	else if (const UWorkspotSelector* Selector = Cast<UWorkspotSelector>(Entry))
+	{
+		Nodes[NodeIndex].Type = EWorkspotProgramNodeType::Selector;
+
+		Entries = &Selector->Entries;
+		Weights = &Selector->Weights;
+	}
+	else
+	{
+		UE_LOG(LogWorkspot, Warning, TEXT("WorkspotProgram::Compile - Unsupported entry type '%s', skipping"),
+			*Entry->GetClass()->GetName());
+	}
+
+	TArray<int32> ChildNodes;
+	TArray<float> ChildWeights;
+	if (Entries)
+	{
+		for (int32 EntryIndex = 0; EntryIndex < Entries->Num(); EntryIndex++)
+		{
+			const UWorkspotEntry* Child = (*Entries)[EntryIndex];
+			if (!Child)
+			{
+				continue;
+			}
+
+			const int32 ChildNode = CompileEntry(Child);
+			if (ChildNode != INDEX_NONE)
+			{
+				ChildNodes.Add(ChildNode);
+				ChildWeights.Add(Weights && Weights->IsValidIndex(EntryIndex) ? FMath::Max((*Weights)[EntryIndex], 0.0f) : 0.0f);
+			}
+		}
+	}
+
+	// Empty containers never produce anything, drop them so looping parents can't spin
+	if (ChildNodes.Num() == 0)
+	{
+		check(NodeIndex == Nodes.Num() - 1);
+		if (Nodes[NodeIndex].Clip != INDEX_NONE)
+		{
+			Clips.Pop();
+		}
+		Nodes.Pop();
+		return INDEX_NONE;
+	}
+
+	AddChildren(NodeIndex, ChildNodes, ChildWeights);
+	return NodeIndex;
+}
+
+void FWorkspotProgram::AddChildren(int32 NodeIndex, TConstArrayView<int32> ChildNodes, TConstArrayView<float> Weights)
+{
+	const int32 NumChildren = ChildNodes.Num();
+	const int32 FirstChild = Children.Num();
+
+	Nodes[NodeIndex].FirstChild = FirstChild;
+	Nodes[NodeIndex].NumChildren = NumChildren;
+
+	Children.Append(ChildNodes.GetData(), NumChildren);
+	AliasProbabilities.AddUninitialized(NumChildren);
+	AliasIndices.AddUninitialized(NumChildren);
+
+	float* Probabilities = AliasProbabilities.GetData() + FirstChild;
+	int32* Aliases = AliasIndices.GetData() + FirstChild;
+
+	float TotalWeight = 0.0f;
+	for (float Weight : Weights)
+	{
+		TotalWeight += Weight;
+	}
+
+	// Uniform when all weights are zero
+	for (int32 Column = 0; Column < NumChildren; Column++)
+	{
+		Probabilities[Column] = TotalWeight > 0.0f ? Weights[Column] * NumChildren / TotalWeight : 1.0f;
+		Aliases[Column] = Column;
+	}
+
+	TArray<int32> Small;
+	TArray<int32> Large;
+	for (int32 Column = 0; Column < NumChildren; Column++)
+	{
+		(Probabilities[Column] < 1.0f ? Small : Large).Add(Column);
+	}
+
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+
+		Aliases[Less] = More;
+		Probabilities[More] = (Probabilities[More] + Probabilities[Less]) - 1.0f;
+
+		(Probabilities[More] < 1.0f ? Small : Large).Add(More);
+	}
+
+	// Leftovers are only off by rounding
+	for (int32 Column : Small)
+	{
+		Probabilities[Column] = 1.0f;
+	}
+	for (int32 Column : Large)
+	{
+		Probabilities[Column] = 1.0f;
+	}
+}
@@ -0,0 +1,310 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "WorkspotPropPool.h"
+#include "WorkspotTree.h"
+#include "Workspot.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Console Variables & Commands
+//////////////////////////////////////////////////////////////////////////
+
+namespace UE::Workspot
+{
+	static bool bPropPoolEnabled = true;
+	static FAutoConsoleVariableRef CVarPropPoolEnabled(
+		TEXT("workspot.PropPool.Enabled"),
+		bPropPoolEnabled,
+		TEXT("Recycle workspot props instead of spawning and destroying them.\n")
+		TEXT("0: Props are destroyed on release\n")
+		TEXT("1: Enabled (default)"),
+		ECVF_Default);
+
+	static int32 PropPoolMaxFreePerClass = 8;
+	static FAutoConsoleVariableRef CVarPropPoolMaxFreePerClass(
+		TEXT("workspot.PropPool.MaxFreePerClass"),
+		PropPoolMaxFreePerClass,
+		TEXT("Maximum number of free props kept per class, extra released props are destroyed."),
+		ECVF_Default);
+
+	static int32 PropPoolMaxFree = 64;
+	static FAutoConsoleVariableRef CVarPropPoolMaxFree(
+		TEXT("workspot.PropPool.MaxFree"),
+		PropPoolMaxFree,
+		TEXT("Maximum number of free props kept for all classes."),
+		ECVF_Default);
+
+	static int32 PropPoolPrewarmCount = 2;
+	static FAutoConsoleVariableRef CVarPropPoolPrewarmCount(
+		TEXT("workspot.PropPool.PrewarmCount"),
+		PropPoolPrewarmCount,
+		TEXT("Free props kept ready for each prop class of a started workspot tree."),
+		ECVF_Default);
+
+	static int32 PropPoolPrewarmPerFrame = 2;
+	static FAutoConsoleVariableRef CVarPropPoolPrewarmPerFrame(
+		TEXT("workspot.PropPool.PrewarmPerFrame"),
+		PropPoolPrewarmPerFrame,
+		TEXT("Maximum number of props spawned each frame to prewarm the pool."),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdDumpPropPool(
+		TEXT("workspot.PropPool.Dump"),
+		TEXT("Logs workspot prop pool stats to console."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, const UWorld* World, FOutputDevice& OutputDevice)
+			{
+				if (const UWorkspotPropPool* Pool = World->GetSubsystem<UWorkspotPropPool>())
+				{
+					const FWorkspotPropPoolStats Stats = Pool->GetStats();
+					OutputDevice.Logf(ELogVerbosity::Log, TEXT("Workspot prop pool: %d in use, %d free | %d spawned, %d reused, %d destroyed"),
+						Stats.NumInUse, Stats.NumFree, Stats.NumSpawned, Stats.NumReused, Stats.NumDestroyed);
+
+					for (const auto& Pair : Pool->GetBuckets())
+					{
+						OutputDevice.Logf(ELogVerbosity::Log, TEXT("    %s: %d in use, %d free (prewarm %d)"),
+							*GetNameSafe(Pair.Key), Pair.Value.NumInUse, Pair.Value.FreeProps.Num(), Pair.Value.PrewarmCount);
+					}
+				}
+				else
+				{
+					OutputDevice.Log(ELogVerbosity::Error, TEXT("Unable to access WorkspotPropPool"));
+				}
+			})
+	);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Subsystem Implementation
+//////////////////////////////////////////////////////////////////////////
+
+void UWorkspotPropPool::Deinitialize()
+{
+	UE_LOG(LogWorkspot, Log, TEXT("WorkspotPropPool::Deinitialize - %d spawned, %d reused"), Stats.NumSpawned, Stats.NumReused);
+
+	// Actors go away with the world
+	Buckets.Reset();
+	InUseProps.Reset();
+	PrewarmQueue.Reset();
+
+	Super::Deinitialize();
+}
+
+void UWorkspotPropPool::Tick(float DeltaTime)
+{
+	int32 Budget = UE::Workspot::PropPoolPrewarmPerFrame;
+
+	while (PrewarmQueue.Num() > 0 && Budget > 0)
+	{
+		UClass* PropClass = PrewarmQueue.Last();
+		FWorkspotPropPoolBucket& Bucket = Buckets.FindOrAdd(PropClass);
+
+		const int32 Target = FMath::Min(Bucket.PrewarmCount, UE::Workspot::PropPoolMaxFreePerClass);
+		if (!UE::Workspot::bPropPoolEnabled || Bucket.FreeProps.Num() >= Target || Stats.NumFree >= UE::Workspot::PropPoolMaxFree)
+		{
+			PrewarmQueue.Pop(EAllowShrinking::No);
+			continue;
+		}
+
+		AActor* Prop = SpawnProp(PropClass, true);
+		if (!Prop)
+		{
+			PrewarmQueue.Pop(EAllowShrinking::No);
+			continue;
+		}
+
+		DeactivateProp(Prop);
+		Bucket.FreeProps.Add(Prop);
+		Stats.NumFree++;
+		Budget--;
+	}
+}
+
+TStatId UWorkspotPropPool::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWorkspotPropPool, STATGROUP_Tickables);
+}
+
+AActor* UWorkspotPropPool::AcquireProp(TSubclassOf<AActor> PropClass, AActor* Owner, USceneComponent* AttachParent, FName SocketName)
+{
+	if (!PropClass || !AttachParent)
+	{
+		return nullptr;
+	}
+
+	FWorkspotPropPoolBucket& Bucket = Buckets.FindOrAdd(PropClass.Get());
+
+	AActor* Prop = PopFreeProp(Bucket);
+	if (Prop)
+	{
+		Stats.NumReused++;
+	}
+	else
+	{
+		Prop = SpawnProp(PropClass);
+		if (!Prop)
+		{
+			return nullptr;
+		}
+	}
+
+	ActivateProp(Prop, Owner, AttachParent, SocketName);
+
+	InUseProps.Add(Prop);
+	Bucket.NumInUse++;
+	Stats.NumInUse++;
+
+	return Prop;
+}
+
+void UWorkspotPropPool::ReleaseProp(AActor* Prop)
+{
+	if (!Prop)
+	{
+		return;
+	}
+
+	const bool bFromPool = InUseProps.Remove(Prop) > 0;
+	if (bFromPool)
+	{
+		FWorkspotPropPoolBucket& Bucket = Buckets.FindOrAdd(Prop->GetClass());
+		Bucket.NumInUse--;
+		Stats.NumInUse--;
+	}
+
+	// Destroyed while in use (level teardown, gameplay code), nothing to recycle
+	if (!IsValid(Prop))
+	{
+		return;
+	}
+
+	if (!bFromPool)
+	{
+		UE_LOG(LogWorkspot, Verbose, TEXT("WorkspotPropPool::ReleaseProp - '%s' doesn't come from the pool, destroying it"), *Prop->GetName());
+		Prop->Destroy();
+		return;
+	}
+
+	FWorkspotPropPoolBucket& Bucket = Buckets.FindOrAdd(Prop->GetClass());
+	const bool bOverCap = Bucket.FreeProps.Num() >= UE::Workspot::PropPoolMaxFreePerClass
+		|| Stats.NumFree >= UE::Workspot::PropPoolMaxFree;
+
+	if (!UE::Workspot::bPropPoolEnabled || bOverCap)
+	{
+		Prop->Destroy();
+		Stats.NumDestroyed++;
+		return;
+	}
+
+	DeactivateProp(Prop);
+	Bucket.FreeProps.Add(Prop);
+	Stats.NumFree++;
+}
+
+void UWorkspotPropPool::Prewarm(TSubclassOf<AActor> PropClass, int32 Count)
+{
+	if (!PropClass || Count <= 0)
+	{
+		return;
+	}
+
+	FWorkspotPropPoolBucket& Bucket = Buckets.FindOrAdd(PropClass.Get());
+	Bucket.PrewarmCount = FMath::Max(Bucket.PrewarmCount, Count);
+
+	if (Bucket.FreeProps.Num() < Bucket.PrewarmCount)
+	{
+		PrewarmQueue.AddUnique(PropClass.Get());
+	}
+}
+
+void UWorkspotPropPool::PrewarmTree(const UWorkspotTree* WorkspotTree)
+{
+	if (!WorkspotTree || !UE::Workspot::bPropPoolEnabled)
+	{
+		return;
+	}
+
+	for (const FWorkspotGlobalProp& Prop : WorkspotTree->GlobalProps)
+	{
+		Prewarm(Prop.PropClass, UE::Workspot::PropPoolPrewarmCount);
+	}
+}
+
+void UWorkspotPropPool::Trim()
+{
+	for (auto& Pair : Buckets)
+	{
+		for (AActor* Prop : Pair.Value.FreeProps)
+		{
+			if (IsValid(Prop))
+			{
+				Prop->Destroy();
+				Stats.NumDestroyed++;
+			}
+		}
+		Pair.Value.FreeProps.Reset();
+		Pair.Value.PrewarmCount = 0;
+	}
+
+	PrewarmQueue.Reset();
+	Stats.NumFree = 0;
+}
+
+AActor* UWorkspotPropPool::SpawnProp(UClass* PropClass, bool bDeactivated)
+{
+	AActor* Prop = GetWorld()->SpawnActorDeferred<AActor>(PropClass, FTransform::Identity, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Prop)
+	{
+		return nullptr;
+	}
+
+	// Components register hidden and without collision, prewarmed props never show up or create physics state at the origin
+	if (bDeactivated)
+	{
+		Prop->SetActorHiddenInGame(true);
+		Prop->SetActorEnableCollision(false);
+	}
+
+	Prop->FinishSpawning(FTransform::Identity);
+	Stats.NumSpawned++;
+
+	return Prop;
+}
+
+void UWorkspotPropPool::DeactivateProp(AActor* Prop)
+{
+	Prop->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Prop->SetOwner(nullptr);
+	Prop->SetActorHiddenInGame(true);
+	Prop->SetActorEnableCollision(false);
+	Prop->SetActorTickEnabled(false);
+}
+
+void UWorkspotPropPool::ActivateProp(AActor* Prop, AActor* Owner, USceneComponent* AttachParent, FName SocketName)
+{
+	const AActor* Defaults = Prop->GetClass()->GetDefaultObject<AActor>();
+
+	Prop->SetOwner(Owner);
+	Prop->AttachToComponent(AttachParent, FAttachmentTransformRules::SnapToTargetIncludingScale, SocketName);
+	Prop->SetActorHiddenInGame(Defaults->IsHidden());
+	Prop->SetActorEnableCollision(Defaults->GetActorEnableCollision());
+	Prop->SetActorTickEnabled(Defaults->PrimaryActorTick.bStartWithTickEnabled);
+}
+
+AActor* UWorkspotPropPool::PopFreeProp(FWorkspotPropPoolBucket& Bucket)
+{
+	while (Bucket.FreeProps.Num() > 0)
+	{
+		AActor* Prop = Bucket.FreeProps.Pop(EAllowShrinking::No);
+		Stats.NumFree--;
+
+		// Destroyed behind our back (level teardown, gameplay code)
+		if (IsValid(Prop))
+		{
+			return Prop;
+		}
+	}
+
+	return nullptr;
+}
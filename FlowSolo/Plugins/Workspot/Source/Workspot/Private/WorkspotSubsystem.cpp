@@ -2,6 +2,7 @@
 
 #include "WorkspotSubsystem.h"
 #include "WorkspotInstance.h"
+#include "WorkspotPropPool.h"
 #include "WorkspotTree.h"
 #include "WorkspotDebugger.h"
 #include "Workspot.h"
@@ -34,6 +35,47 @@ namespace UE::Workspot
 		TEXT("3: VeryVerbose"),
 		ECVF_Default);
 
+	// Significance based update rates
+	static bool bSignificanceEnabled = true;
+	static FAutoConsoleVariableRef CVarSignificanceEnabled(
+		TEXT("workspot.Significance.Enabled"),
+		bSignificanceEnabled,
+		TEXT("Reduce or freeze the update rate of workspot instances far from the view or not rendered.\n")
+		TEXT("0: Every instance updates at full rate\n")
+		TEXT("1: Enabled (default)"),
+		ECVF_Default);
+
+	// Frozen instances skip montage notifies and prop events of the entries they fast forward through
+	static bool bFreezeEnabled = false;
+	static FAutoConsoleVariableRef CVarFreezeEnabled(
+		TEXT("workspot.Significance.Freeze"),
+		bFreezeEnabled,
+		TEXT("Stop updating hidden instances far from every view, they are fast forwarded when seen again.\n")
+		TEXT("0: Hidden instances far away are reduced (default)\n")
+		TEXT("1: Hidden instances far away are frozen"),
+		ECVF_Default);
+
+	static float FullRateDistance = 2500.0f;
+	static FAutoConsoleVariableRef CVarFullRateDistance(
+		TEXT("workspot.Significance.FullRateDistance"),
+		FullRateDistance,
+		TEXT("Visible instances closer than this to a view update at full rate, hidden ones closer than this are reduced instead of frozen."),
+		ECVF_Default);
+
+	static float ReducedTickInterval = 0.1f;
+	static FAutoConsoleVariableRef CVarReducedTickInterval(
+		TEXT("workspot.Significance.ReducedTickInterval"),
+		ReducedTickInterval,
+		TEXT("Mesh tick interval in seconds for instances in the reduced bucket."),
+		ECVF_Default);
+
+	static int32 SignificanceUpdatesPerFrame = 32;
+	static FAutoConsoleVariableRef CVarSignificanceUpdatesPerFrame(
+		TEXT("workspot.Significance.UpdatesPerFrame"),
+		SignificanceUpdatesPerFrame,
+		TEXT("Number of instances whose update bucket is evaluated each frame."),
+		ECVF_Default);
+
 	// Dump all active instances
 	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdDumpInstances(
 		TEXT("workspot.Dump"),
@@ -60,10 +102,11 @@ namespace UE::Workspot
 							UWorkspotTree* Tree = Instance->GetWorkspotTree();
 							OutputDevice.Logf(ELogVerbosity::Log, TEXT("[%d] Actor: %s"), Index++, *Actor->GetName());
 							OutputDevice.Logf(ELogVerbosity::Log, TEXT("    Tree: %s"), Tree ? *Tree->GetName() : TEXT("NULL"));
-							OutputDevice.Logf(ELogVerbosity::Log, TEXT("    State: %d | Idle: %s | PlayTime: %.2fs"),
+							OutputDevice.Logf(ELogVerbosity::Log, TEXT("    State: %d | Idle: %s | PlayTime: %.2fs | Bucket: %d"),
 								(int32)Instance->GetState(),
 								*Instance->GetCurrentIdleAnim().ToString(),
-								Instance->GetCurrentPlayTime());
+								Instance->GetCurrentPlayTime(),
+								(int32)Instance->GetUpdateBucket());
 							OutputDevice.Logf(ELogVerbosity::Log, TEXT(""));
 						}
 					}
@@ -115,6 +158,8 @@ namespace UE::Workspot
 //////////////////////////////////////////////////////////////////////////
 
 #include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 
 void UWorkspotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -135,17 +180,41 @@ void UWorkspotSubsystem::Deinitialize()
 
 void UWorkspotSubsystem::Tick(float DeltaTime)
 {
-	// Tick all active instances
-	for (auto& Pair : ActiveInstances)
+	UpdateSignificance();
+
+	// Only instances whose montage ended have work to do
+	if (PendingUpdates.Num() > 0)
 	{
-		if (UWorkspotInstance* Instance = Pair.Value)
+		TArray<TWeakObjectPtr<UWorkspotInstance>> Updates = MoveTemp(PendingUpdates);
+		PendingUpdates.Reset();
+
+		for (const TWeakObjectPtr<UWorkspotInstance>& InstancePtr : Updates)
 		{
-			Instance->Tick(DeltaTime);
+			if (UWorkspotInstance* Instance = InstancePtr.Get())
+			{
+				Instance->Tick(DeltaTime);
+			}
 		}
 	}
 
+	// Direct playback on the mesh doesn't send montage events
+	for (int32 Index = PolledInstances.Num() - 1; Index >= 0; --Index)
+	{
+		UWorkspotInstance* Instance = PolledInstances[Index].Get();
+		if (!Instance || Instance->IsFinished())
+		{
+			PolledInstances.RemoveAtSwap(Index);
+			continue;
+		}
+
+		Instance->Tick(DeltaTime);
+	}
+
 	// Cleanup completed instances
-	CleanupCompletedInstances();
+	if (PendingRemoval.Num() > 0)
+	{
+		CleanupCompletedInstances();
+	}
 
 	// Draw debug info if enabled via console variable
 	if (UE::Workspot::bShowDebug)
@@ -177,9 +246,33 @@ UWorkspotInstance* UWorkspotSubsystem::StartWorkspot(AActor* Actor, UWorkspotTre
 	// Bind completion callback
 	Instance->OnCompleted.AddUObject(this, &UWorkspotSubsystem::OnInstanceCompleted);
 
+	// First entry may have finished during setup (no montage)
+	Instance->OnUpdateRequested.AddUObject(this, &UWorkspotSubsystem::OnInstanceUpdateRequested);
+	if (Instance->HasPendingUpdate())
+	{
+		PendingUpdates.Add(Instance);
+	}
+
+	if (Instance->RequiresPolling())
+	{
+		PolledInstances.Add(Instance);
+	}
+	else
+	{
+		SignificanceInstances.Add(Instance);
+	}
+
+	Actor->OnEndPlay.AddUniqueDynamic(this, &UWorkspotSubsystem::OnActorEndPlay);
+
 	// Store in active instances
 	ActiveInstances.Add(Actor, Instance);
 
+	// Keep spare props ready for the next actors using this tree
+	if (UWorkspotPropPool* PropPool = GetWorld()->GetSubsystem<UWorkspotPropPool>())
+	{
+		PropPool->PrewarmTree(WorkspotTree);
+	}
+
 	UE_LOG(LogWorkspot, Log, TEXT("WorkspotSubsystem::StartWorkspot - Started workspot '%s' on '%s'"),
 		*WorkspotTree->GetName(), *Actor->GetName());
 
@@ -244,30 +337,22 @@ void UWorkspotSubsystem::StopAllWorkspots(bool bForceStop)
 
 void UWorkspotSubsystem::CleanupCompletedInstances()
 {
-	// Remove instances marked for removal
+	// Instances only finish through Stop, which queues their actor here
 	for (TWeakObjectPtr<AActor> ActorPtr : PendingRemoval)
 	{
-		if (ActorPtr.IsValid())
+		// A new workspot may have been started on the same actor since
+		const TObjectPtr<UWorkspotInstance>* InstancePtr = ActiveInstances.Find(ActorPtr);
+		if (InstancePtr && (!*InstancePtr || (*InstancePtr)->IsFinished()))
 		{
 			ActiveInstances.Remove(ActorPtr);
-		}
-	}
-	PendingRemoval.Empty();
 
-	// Remove instances with invalid actors or finished state
-	TArray<TWeakObjectPtr<AActor>> ToRemove;
-	for (const auto& Pair : ActiveInstances)
-	{
-		if (!Pair.Key.IsValid() || !Pair.Value || Pair.Value->IsFinished())
-		{
-			ToRemove.Add(Pair.Key);
+			if (AActor* Actor = ActorPtr.Get())
+			{
+				Actor->OnEndPlay.RemoveDynamic(this, &UWorkspotSubsystem::OnActorEndPlay);
+			}
 		}
 	}
-
-	for (TWeakObjectPtr<AActor> ActorPtr : ToRemove)
-	{
-		ActiveInstances.Remove(ActorPtr);
-	}
+	PendingRemoval.Empty();
 }
 
 void UWorkspotSubsystem::OnInstanceCompleted(UWorkspotInstance* Instance)
@@ -286,3 +371,87 @@ void UWorkspotSubsystem::OnInstanceCompleted(UWorkspotInstance* Instance)
 		PendingRemoval.AddUnique(Actor);
 	}
 }
+
+void UWorkspotSubsystem::UpdateSignificance()
+{
+	if (SignificanceInstances.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+
+	int32 NumToUpdate = FMath::Min(UE::Workspot::SignificanceUpdatesPerFrame, SignificanceInstances.Num());
+	while (NumToUpdate-- > 0 && SignificanceInstances.Num() > 0)
+	{
+		if (SignificanceCursor >= SignificanceInstances.Num())
+		{
+			SignificanceCursor = 0;
+		}
+
+		UWorkspotInstance* Instance = SignificanceInstances[SignificanceCursor].Get();
+		if (!Instance || Instance->IsFinished())
+		{
+			SignificanceInstances.RemoveAtSwap(SignificanceCursor);
+			continue;
+		}
+
+		SignificanceCursor++;
+
+		const EWorkspotUpdateBucket Bucket = UE::Workspot::bSignificanceEnabled
+			? ComputeUpdateBucket(Instance, ViewLocations)
+			: EWorkspotUpdateBucket::Full;
+
+		Instance->SetUpdateBucket(Bucket, UE::Workspot::ReducedTickInterval);
+	}
+}
+
+EWorkspotUpdateBucket UWorkspotSubsystem::ComputeUpdateBucket(const UWorkspotInstance* Instance, TConstArrayView<FVector> ViewLocations) const
+{
+	const AActor* Actor = Instance->GetActor();
+	if (!Actor || ViewLocations.Num() == 0)
+	{
+		return EWorkspotUpdateBucket::Full;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	double MinDistanceSquared = TNumericLimits<double>::Max();
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, FVector::DistSquared(Location, ViewLocation));
+	}
+
+	const bool bNear = MinDistanceSquared <= FMath::Square(UE::Workspot::FullRateDistance);
+	if (Actor->WasRecentlyRendered(0.2f))
+	{
+		return bNear ? EWorkspotUpdateBucket::Full : EWorkspotUpdateBucket::Reduced;
+	}
+
+	return bNear || !UE::Workspot::bFreezeEnabled ? EWorkspotUpdateBucket::Reduced : EWorkspotUpdateBucket::Frozen;
+}
+
+void UWorkspotSubsystem::OnInstanceUpdateRequested(UWorkspotInstance* Instance)
+{
+	if (Instance)
+	{
+		PendingUpdates.Add(Instance);
+	}
+}
+
+void UWorkspotSubsystem::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorkspotInstance* Instance = GetActiveWorkspot(Actor))
+	{
+		Instance->Stop(true);
+	}
+
+	PendingRemoval.AddUnique(Actor);
+}
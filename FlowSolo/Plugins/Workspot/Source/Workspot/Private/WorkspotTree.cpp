@@ -5,8 +5,10 @@
 #include "Workspot.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/Skeleton.h"
+#include "UObject/ObjectSaveContext.h"
 
 #if WITH_EDITOR
+#include "AssetRegistry/IAssetRegistry.h"
 #include "Misc/DataValidation.h"
 #endif
 
@@ -18,21 +20,92 @@ UWorkspotTree::UWorkspotTree()
 	InertializationDurationExitForced = 0.2f;
 }
 
-UAnimMontage* UWorkspotTree::FindTransitionAnim(FName FromIdle, FName ToIdle) const
+void UWorkspotTree::PostLoad()
+{
+	Super::PostLoad();
+
+	// Cooked data already has the program baked at save time
+	if (!FPlatformProperties::RequiresCookedData() || !Program.IsValid())
+	{
+		CompileProgram();
+	}
+	else
+	{
+		// Table isn't saved, only the transitions it is built from
+		BuildTransitionTable();
+	}
+}
+
+void UWorkspotTree::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+#if WITH_EDITOR
+	ResolveConventionTransitions();
+#endif
+	CompileProgram();
+}
+
+#if WITH_EDITOR
+void UWorkspotTree::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Searching the asset registry is slow, only done when the idles or transitions may have changed, PreSave catches the rest
+	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UWorkspotTree, RootEntry)
+		|| MemberPropertyName == GET_MEMBER_NAME_CHECKED(UWorkspotTree, CustomTransitionAnims)
+		|| MemberPropertyName == GET_MEMBER_NAME_CHECKED(UWorkspotTree, WorkspotSkeleton))
+	{
+		ResolveConventionTransitions();
+	}
+
+	CompileProgram();
+}
+#endif
+
+void UWorkspotTree::CompileProgram()
 {
-	// 1. Check custom transitions first (higher priority)
+	Program.Compile(RootEntry);
+	BuildTransitionTable();
+	ProgramRevision++;
+}
+
+void UWorkspotTree::BuildTransitionTable()
+{
+	TransitionTable.Reset();
+	TransitionTable.Reserve(CustomTransitionAnims.Num() + ConventionTransitionAnims.Num());
+
+	for (const FWorkspotTransitionAnim& Transition : ConventionTransitionAnims)
+	{
+		if (Transition.TransitionMontage)
+		{
+			TransitionTable.Add(MakeTuple(Transition.FromIdle, Transition.ToIdle), Transition.TransitionMontage);
+		}
+	}
+
+	// Custom transitions have priority, first one wins like the previous linear search
+	TSet<TPair<FName, FName>> CustomPairs;
 	for (const FWorkspotTransitionAnim& Transition : CustomTransitionAnims)
 	{
-		if (Transition.FromIdle == FromIdle && Transition.ToIdle == ToIdle)
+		const TPair<FName, FName> Key = MakeTuple(Transition.FromIdle, Transition.ToIdle);
+
+		bool bAlreadyInSet = false;
+		CustomPairs.Add(Key, &bAlreadyInSet);
+		if (!bAlreadyInSet)
 		{
-			return Transition.TransitionMontage;
+			TransitionTable.Add(Key, Transition.TransitionMontage);
 		}
 	}
+}
 
-	// 2. Check naming convention: "FromIdle__2__ToIdle"
-	// Note: This would require searching through animation assets
-	// For now, only custom transitions are supported
-	// TODO: Implement animation asset search by name
+UAnimMontage* UWorkspotTree::FindTransitionAnim(FName FromIdle, FName ToIdle) const
+{
+	// Custom and naming convention transitions, resolved when the program is built
+	if (UAnimMontage* const* TransitionMontage = TransitionTable.Find(MakeTuple(FromIdle, ToIdle)))
+	{
+		return *TransitionMontage;
+	}
 
 	return nullptr;
 }
@@ -83,6 +156,14 @@ void UWorkspotTree::GetReferencedAnimations(TArray<UAnimMontage*>& OutAnimations
 			OutAnimations.AddUnique(Transition.TransitionMontage);
 		}
 	}
+
+	for (const FWorkspotTransitionAnim& Transition : ConventionTransitionAnims)
+	{
+		if (Transition.TransitionMontage)
+		{
+			OutAnimations.AddUnique(Transition.TransitionMontage);
+		}
+	}
 }
 
 int32 UWorkspotTree::GetEntryCount() const
@@ -202,4 +283,66 @@ void UWorkspotTree::RegenerateEntryIds()
 		}
 	});
 }
+
+void UWorkspotTree::ResolveConventionTransitions()
+{
+	ConventionTransitionAnims.Reset();
+
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (!RootEntry || !AssetRegistry)
+	{
+		return;
+	}
+
+	// Idles this tree can be in, instances start standing
+	TSet<FName> Idles;
+	Idles.Add("stand");
+	RootEntry->ForEachNode([&Idles](const UWorkspotEntry* Entry)
+	{
+		Idles.Add(Entry->IdleAnim);
+	});
+
+	TArray<FAssetData> Montages;
+	AssetRegistry->GetAssetsByClass(UAnimMontage::StaticClass()->GetClassPathName(), Montages);
+
+	TMap<FName, const FAssetData*> TransitionAssets;
+	for (const FAssetData& Montage : Montages)
+	{
+		if (Montage.AssetName.ToString().Contains(TEXT("__2__")))
+		{
+			TransitionAssets.Add(Montage.AssetName, &Montage);
+		}
+	}
+
+	for (const FName FromIdle : Idles)
+	{
+		for (const FName ToIdle : Idles)
+		{
+			if (FromIdle == ToIdle)
+			{
+				continue;
+			}
+
+			const bool bHasCustom = CustomTransitionAnims.ContainsByPredicate([FromIdle, ToIdle](const FWorkspotTransitionAnim& Transition)
+			{
+				return Transition.FromIdle == FromIdle && Transition.ToIdle == ToIdle;
+			});
+
+			const FAssetData* const* Asset = TransitionAssets.Find(*FString::Printf(TEXT("%s__2__%s"), *FromIdle.ToString(), *ToIdle.ToString()));
+			if (bHasCustom || !Asset)
+			{
+				continue;
+			}
+
+			UAnimMontage* Montage = Cast<UAnimMontage>((*Asset)->GetAsset());
+			if (Montage && (!WorkspotSkeleton || Montage->GetSkeleton() == WorkspotSkeleton))
+			{
+				FWorkspotTransitionAnim& Transition = ConventionTransitionAnims.AddDefaulted_GetRef();
+				Transition.FromIdle = FromIdle;
+				Transition.ToIdle = ToIdle;
+				Transition.TransitionMontage = Montage;
+			}
+		}
+	}
+}
 #endif
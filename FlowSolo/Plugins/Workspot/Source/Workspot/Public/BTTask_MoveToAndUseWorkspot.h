@@ -8,6 +8,7 @@
 #include "BTTask_MoveToAndUseWorkspot.generated.h"
 
 class UWorkspotInstance;
+class UWorkspotBehaviorConfig;
 DECLARE_DELEGATE_RetVal(bool,FMyBookDel)
 /**
  * BTTask: Move to SmartObject and use Workspot
@@ -17,9 +18,9 @@ DECLARE_DELEGATE_RetVal(bool,FMyBookDel)
  *
  * Workflow:
  * 1. Find SmartObject by tag/query
- * 2. Claim the slot
- * 3. Move to the slot location
- * 4. Start Workspot from the slot's WorkspotBehaviorConfig
+ * 2. Claim the slot (batched with other agents by UWorkspotClaimSubsystem, resolved next frame)
+ * 3. Move to the slot location, streaming the slot's WorkspotTree meanwhile
+ * 4. Start Workspot from the slot's WorkspotBehaviorConfig once its tree is resident
  * 5. Wait for Workspot to complete
  * 6. Release the slot
  */
@@ -67,14 +68,18 @@ private:
 	{
 		FSmartObjectClaimHandle ClaimHandle;
 		TWeakObjectPtr<UWorkspotInstance> WorkspotInstance;
+		uint32 ClaimRequestId = 0;
+		TWeakObjectPtr<const UWorkspotBehaviorConfig> PreloadConfig;
 		bool bMovementComplete = false;
 		bool bWorkspotStarted = false;
 	};
 
 	bool FindAndClaimSmartObject(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory);
+	bool OnSlotClaimed(const FSmartObjectClaimHandle& ClaimHandle, TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp, FTaskMemory* Memory);
 	bool MoveToSlotLocation(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory);
 	bool StartWorkspotFromSlot(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory);
 	void ReleaseSlot(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory);
+	void ReleasePreload(UBehaviorTreeComponent& OwnerComp, FTaskMemory* Memory);
 
 	virtual uint16 GetInstanceMemorySize() const override { return sizeof(FTaskMemory); }
 };
@@ -7,6 +7,20 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogWorkspot, Log, All);
 
+/**
+ * Success path logging of slot claim and use, called for every agent using a workspot
+ * Compiled out of shipping and test builds, define WORKSPOT_CLAIM_LOGGING to override
+ */
+#ifndef WORKSPOT_CLAIM_LOGGING
+#define WORKSPOT_CLAIM_LOGGING !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if WORKSPOT_CLAIM_LOGGING
+#define UE_WORKSPOT_CLAIM_LOG(Format, ...) UE_LOG(LogWorkspot, Verbose, Format, ##__VA_ARGS__)
+#else
+#define UE_WORKSPOT_CLAIM_LOG(Format, ...)
+#endif
+
 class FWorkspotModule : public IModuleInterface
 {
 public:
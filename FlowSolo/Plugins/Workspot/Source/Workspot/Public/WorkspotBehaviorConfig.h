@@ -37,9 +37,12 @@ public:
 	// Core Configuration
 	//////////////////////////////////////////////////////////////////////////
 
-	/** The workspot tree to execute when this behavior is triggered */
+	/**
+	 * The workspot tree to execute when this behavior is triggered
+	 * Streamed when a slot is claimed (see UWorkspotPreloadSubsystem), not with the SmartObject definition
+	 */
 	UPROPERTY(EditAnywhere, Category = "Workspot")
-	TObjectPtr<UWorkspotTree> WorkspotTree;
+	TSoftObjectPtr<UWorkspotTree> WorkspotTree;
 
 	//////////////////////////////////////////////////////////////////////////
 	// Entry Point Selection
@@ -92,10 +95,15 @@ public:
 
 public:
 	/**
-	 * Get the workspot tree for this config
+	 * Get the workspot tree for this config, nullptr if it isn't resident
 	 */
 	UFUNCTION(BlueprintPure, Category = "Workspot")
-	UWorkspotTree* GetWorkspotTree() const { return WorkspotTree; }
+	UWorkspotTree* GetWorkspotTree() const { return WorkspotTree.Get(); }
+
+	/**
+	 * Get the workspot tree, loading it synchronously if it wasn't preloaded
+	 */
+	UWorkspotTree* LoadWorkspotTree() const;
 
 	/**
 	 * Validate configuration
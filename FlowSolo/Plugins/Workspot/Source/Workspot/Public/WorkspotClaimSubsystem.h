@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SmartObjectSubsystem.h"
+#include "WorkspotClaimSubsystem.generated.h"
+
+class AActor;
+
+/**
+ * Called with the claimed slot (invalid if nothing could be claimed)
+ * Return false to refuse the claim, the slot is then released
+ */
+DECLARE_DELEGATE_RetVal_OneParam(bool, FOnWorkspotSlotClaimed, const FSmartObjectClaimHandle& /*ClaimHandle*/);
+
+/**
+ * Pending slot claim
+ */
+struct FWorkspotClaimRequest
+{
+	uint32 Id = 0;
+	TWeakObjectPtr<AActor> Requester;
+	FVector Location = FVector::ZeroVector;
+	float SearchRadius = 0.0f;
+
+	/** Only slots of this SmartObject (invalid = any) */
+	FSmartObjectHandle TargetSmartObject;
+
+	FOnWorkspotSlotClaimed OnClaimed;
+	bool bCancelled = false;
+};
+
+/**
+ * WorkspotClaimSubsystem - Batched SmartObject slot search and claim
+ *
+ * Requests made during a frame are grouped by region and resolved on the next tick with a
+ * single FindSmartObjects query per region. Slots are handed out in request order, closest
+ * first, so agents re-planning in the same frame don't race for the same slot.
+ *
+ * Usage:
+ *   UWorkspotClaimSubsystem* ClaimSubsystem = GetWorld()->GetSubsystem<UWorkspotClaimSubsystem>();
+ *   const uint32 RequestId = ClaimSubsystem->RequestClaim(Pawn, 1000.0f, SmartObjectHandle, OnClaimed);
+ */
+UCLASS()
+class WORKSPOT_API UWorkspotClaimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//////////////////////////////////////////////////////////////////////////
+	// Subsystem Interface
+	//////////////////////////////////////////////////////////////////////////
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Claim API
+	//////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * Queue a slot claim, resolved on the next tick
+	 * @param Requester - Actor that will use the slot, the search is centered on it
+	 * @param SearchRadius - Slots further than this are ignored
+	 * @param TargetSmartObject - Only claim slots of this SmartObject (invalid = any)
+	 * @param OnClaimed - Result callback
+	 * @return Request id for CancelClaim, 0 if the request is invalid
+	 */
+	uint32 RequestClaim(AActor* Requester, float SearchRadius, FSmartObjectHandle TargetSmartObject, FOnWorkspotSlotClaimed OnClaimed);
+
+	/**
+	 * Drop a pending request, its callback won't be called
+	 */
+	void CancelClaim(uint32 RequestId);
+
+	int32 GetNumPendingRequests() const { return PendingRequests.Num(); }
+
+private:
+	/** Query a region once and assign its slots to the requests */
+	void ProcessRegion(USmartObjectSubsystem& SmartObjectSubsystem, TConstArrayView<int32> RequestIndices);
+
+private:
+	TArray<FWorkspotClaimRequest> PendingRequests;
+
+	/** Requests of the current tick, kept so callbacks can cancel other requests of the batch */
+	TArray<FWorkspotClaimRequest> ProcessingRequests;
+	TArray<FSmartObjectClaimHandle> ProcessingResults;
+
+	uint32 NextRequestId = 1;
+};
@@ -57,6 +57,12 @@ private:
 	/** Callback when workspot instance completes */
 	void OnWorkspotCompleted(UWorkspotInstance* Instance);
 
+	/** Start the workspot deferred by Trigger, once the tree is resident */
+	void OnTreeLoaded();
+
+	/** Release the tree acquired by Trigger */
+	void ReleaseTree(AActor* Avatar);
+
 private:
 	/** The avatar actor (cached for callbacks) */
 	TWeakObjectPtr<AActor> CachedAvatar;
@@ -74,4 +80,7 @@ private:
 
 	/** Whether we should force-stop on next tick */
 	bool bPendingForceStop;
+
+	/** Tree of CachedConfig is kept resident by the preload subsystem */
+	bool bTreeAcquired = false;
 };
@@ -5,12 +5,13 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "WorkspotTypes.h"
+#include "WorkspotIterator.h"
 #include "WorkspotInstance.generated.h"
 
 class UWorkspotTree;
-class FWorkspotIterator;
 class UAnimInstance;
 class UAnimMontage;
+class USkeletalMeshComponent;
 struct FWorkspotGlobalProp;
 
 /**
@@ -26,8 +27,11 @@ struct FWorkspotGlobalProp;
  * Lifecycle:
  * 1. Created by Subsystem->StartWorkspot()
  * 2. Setup() - Initialize with tree and actor
- * 3. Tick() - Update animation and iterator
+ * 3. Tick() - Advance the iterator when the current montage has ended
  * 4. OnCompleted() - Cleanup when finished
+ *
+ * Montage end is reported through blend out / end delegates, the subsystem only
+ * ticks instances that requested an update (or that have no AnimInstance to report it).
  */
 UCLASS()
 class WORKSPOT_API UWorkspotInstance : public UObject
@@ -49,7 +53,7 @@ public:
 	bool Setup(AActor* InActor, UWorkspotTree* InTree, FName EntryPointTag = NAME_None);
 
 	/**
-	 * Update the workspot instance
+	 * Advance to the next entry if the current one has finished
 	 * @param DeltaTime - Time since last tick
 	 */
 	void Tick(float DeltaTime);
@@ -70,6 +74,27 @@ public:
 	 */
 	bool IsFinished() const { return State == EWorkspotState::Inactive || State == EWorkspotState::Finished; }
 
+	/**
+	 * Check if the current entry finished and the iterator is waiting to advance
+	 */
+	bool HasPendingUpdate() const { return bCurrentAnimationFinished; }
+
+	/**
+	 * Check if montage end can't be reported by events (no AnimInstance), these are ticked every frame
+	 */
+	bool RequiresPolling() const { return bRequiresPolling; }
+
+	/**
+	 * Change how often the mesh is updated
+	 * Leaving Frozen fast forwards the iterator by the time spent frozen
+	 * @param NewBucket - Update rate to use
+	 * @param ReducedTickInterval - Mesh tick interval used by the Reduced bucket
+	 */
+	void SetUpdateBucket(EWorkspotUpdateBucket NewBucket, float ReducedTickInterval);
+
+	/** Get current update rate */
+	EWorkspotUpdateBucket GetUpdateBucket() const { return UpdateBucket; }
+
 	//////////////////////////////////////////////////////////////////////////
 	// State Access
 	//////////////////////////////////////////////////////////////////////////
@@ -90,13 +115,13 @@ public:
 	FName GetCurrentIdleAnim() const { return CurrentIdleAnim; }
 
 	/** Get current play time */
-	float GetCurrentPlayTime() const { return CurrentPlayTime; }
+	float GetCurrentPlayTime() const;
 
 	/** Get current entry data */
 	const FWorkspotEntryData& GetCurrentEntryData() const { return CurrentEntryData; }
 
 	/** Get iterator (for debug only) */
-	TSharedPtr<FWorkspotIterator> GetIterator() const { return Iterator; }
+	const FWorkspotIterator* GetIterator() const { return Iterator.IsRunning() ? &Iterator : nullptr; }
 
 	//////////////////////////////////////////////////////////////////////////
 	// Callbacks
@@ -110,6 +135,10 @@ public:
 	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnIdleChanged, FName /*OldIdle*/, FName /*NewIdle*/);
 	FOnIdleChanged OnIdleChanged;
 
+	/** Current entry finished, Tick needs to be called to advance the iterator */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnWorkspotUpdateRequested, UWorkspotInstance*);
+	FOnWorkspotUpdateRequested OnUpdateRequested;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Advanced
 	//////////////////////////////////////////////////////////////////////////
@@ -138,8 +167,8 @@ private:
 	UPROPERTY(Transient)
 	EWorkspotState State;
 
-	/** Iterator for traversing the entry tree */
-	TSharedPtr<FWorkspotIterator> Iterator;
+	/** Cursor over the compiled program of the tree */
+	FWorkspotProgramIterator Iterator;
 
 	/** Current entry data being played */
 	FWorkspotEntryData CurrentEntryData;
@@ -150,8 +179,35 @@ private:
 	/** Previous idle animation name */
 	FName PreviousIdleAnim;
 
-	/** Current animation play time */
-	float CurrentPlayTime;
+	/** World time when the current animation started */
+	double PlayStartTime = 0.0;
+
+	/** Skeletal mesh resolved once in Setup */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<USkeletalMeshComponent> SkeletalMeshComponent;
+
+	/** Incremented on every play, montage events from older plays are ignored */
+	uint32 PlaybackSerial = 0;
+
+	/** Current animation ended and the iterator hasn't advanced yet */
+	bool bCurrentAnimationFinished = false;
+
+	/** Playing directly on the mesh, no montage events available */
+	bool bRequiresPolling = false;
+
+	/** Current update rate */
+	EWorkspotUpdateBucket UpdateBucket = EWorkspotUpdateBucket::Full;
+
+	/** Mesh tick settings before leaving the Full bucket */
+	float MeshTickInterval = 0.0f;
+	bool bMeshTickEnabled = true;
+
+	/** World time and montage position when frozen */
+	double FrozenTime = 0.0;
+	float FrozenPosition = 0.0f;
+
+	/** Iterator moved on since the mesh was frozen, the montage on the mesh is stale */
+	bool bAdvancedWhileFrozen = false;
 
 	/** Spawned props (PropId -> Actor) */
 	UPROPERTY(Transient)
@@ -168,11 +224,34 @@ private:
 	class USkeletalMeshComponent* GetSkeletalMeshComponent() const;
 
 	/** Play current animation */
-	void PlayCurrentAnimation();
+	void PlayCurrentAnimation(float StartPosition = 0.0f);
 
 	/** Check if current animation has finished */
 	bool IsCurrentAnimationFinished() const;
 
+	/**
+	 * Advance the iterator to the next entry
+	 * @param bPlayAnimation - Play the new entry, false when fast forwarding
+	 * @return true if the workspot is still playing
+	 */
+	bool AdvanceIterator(bool bPlayAnimation = true);
+
+	/**
+	 * Skip entries that would have finished in ElapsedTime
+	 * @param ElapsedTime - Time since FrozenTime
+	 * @param bResume - Play the current entry from the right position, otherwise only move the iterator and FrozenTime
+	 */
+	void FastForward(float ElapsedTime, bool bResume);
+
+	/** Restore mesh tick settings changed by the update bucket */
+	void RestoreMeshTick();
+
+	/** Mark the current animation as finished and notify the subsystem */
+	void RequestUpdate();
+
+	/** Bound to montage blend out and end delegates */
+	void OnMontageFinished(UAnimMontage* Montage, bool bInterrupted, uint32 Serial);
+
 	/** Handle idle state change */
 	void HandleIdleChange(FName NewIdle);
 
@@ -187,4 +266,7 @@ private:
 
 	/** Despawn all props */
 	void DespawnAllProps();
+
+	/** Return a prop to the world's prop pool */
+	void ReleaseProp(AActor* PropActor);
 };
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "WorkspotEntry.h"
 #include "WorkspotTypes.h"
+#include "WorkspotProgram.h"
 
 class UWorkspotExitAnim;
 class UWorkspotEntryAnim;
@@ -220,3 +221,65 @@ private:
 	int32 ChooseWeightedRandom(const TArray<float>& Weights, FRandomStream& Random) const;
 	bool TryInsertTransitionAnim(FName FromIdle, FName ToIdle, FWorkspotContext& Context);
 };
+
+/**
+ * Cursor over a compiled FWorkspotProgram
+ * Used by WorkspotInstance instead of the per-entry iterators above, holds no allocation
+ * for trees up to 8 levels deep.
+ */
+class WORKSPOT_API FWorkspotProgramIterator : public FWorkspotIterator
+{
+public:
+	/**
+	 * Start running the program of a tree
+	 * @param InTree - Tree whose program is run, must outlive the iterator
+	 */
+	void Start(const UWorkspotTree* InTree);
+
+	/** Stop running, IsRunning returns false afterwards */
+	void Clear();
+
+	/** Check if a program is being run */
+	bool IsRunning() const { return Tree != nullptr; }
+
+	virtual bool Next(FWorkspotContext& Context) override;
+	virtual bool GetData(FWorkspotEntryData& OutData) const override;
+	virtual void Reset() override;
+	virtual bool HasNext() const override;
+	virtual const TCHAR* GetTypeName() const override { return TEXT("Program"); }
+	virtual FString GetDetailString() const override;
+
+private:
+	struct FFrame
+	{
+		int32 Node;
+
+		// Sequence: child position. Clip: played when >= 0
+		int32 Cursor;
+
+		// Sequence: loops done. RandomList: clips left
+		int32 Counter;
+	};
+
+	const UWorkspotTree* Tree = nullptr;
+	const FWorkspotProgram* Program = nullptr;
+
+	/** Program revision at Start, the program is not used anymore if the tree recompiles it */
+	int32 ProgramRevision = 0;
+
+	TArray<FFrame, TInlineAllocator<8>> Stack;
+
+	/** Clip returned by GetData */
+	int32 CurrentClip = INDEX_NONE;
+
+	/** Selector transition returned by GetData, child to enter on next */
+	UAnimMontage* TransitionMontage = nullptr;
+	FName TransitionIdle;
+	int32 PendingChild = INDEX_NONE;
+
+	bool bStarted = false;
+
+	bool IsProgramValid() const;
+	void PushNode(int32 NodeIndex, FWorkspotContext& Context);
+	bool Run(FWorkspotContext& Context);
+};
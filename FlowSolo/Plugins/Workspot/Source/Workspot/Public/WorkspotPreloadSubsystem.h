@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "WorkspotPreloadSubsystem.generated.h"
+
+class UWorkspotTree;
+
+/**
+ * Streaming state of one tree
+ */
+struct FWorkspotPreloadEntry
+{
+	TSharedPtr<FStreamableHandle> Handle;
+
+	/** Users that acquired the tree and didn't release it yet */
+	int32 RefCount = 0;
+
+	/** World time after which an unused tree is released */
+	double ReleaseTime = 0.0;
+
+	/** Called once the async request completes */
+	TArray<FSimpleDelegate> LoadedCallbacks;
+};
+
+/**
+ * WorkspotPreloadSubsystem - Async streaming and residency of workspot trees
+ *
+ * Claiming a slot acquires the tree of its config, which streams the tree and everything it
+ * references (montages, transitions, prop classes) without blocking the game thread. The start
+ * of the workspot waits until the tree is resident.
+ *
+ * Trees are refcounted and stay resident for workspot.Preload.KeepResidentTime seconds after
+ * their last user released them, so popular trees don't reload between uses.
+ *
+ * Usage:
+ *   UWorkspotPreloadSubsystem* Preload = GetWorld()->GetSubsystem<UWorkspotPreloadSubsystem>();
+ *   Preload->AcquireTree(Config->WorkspotTree);
+ *   ...
+ *   if (!Preload->IsTreeLoading(Config->WorkspotTree)) { start }
+ *   ...
+ *   Preload->ReleaseTree(Config->WorkspotTree);
+ */
+UCLASS()
+class WORKSPOT_API UWorkspotPreloadSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//////////////////////////////////////////////////////////////////////////
+	// Subsystem Interface
+	//////////////////////////////////////////////////////////////////////////
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Preload API
+	//////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * Start streaming a tree (if needed) and keep it resident until released
+	 */
+	void AcquireTree(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree);
+
+	/**
+	 * Release a tree acquired with AcquireTree
+	 */
+	void ReleaseTree(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree);
+
+	/**
+	 * Check if the async request of a tree is still in flight
+	 */
+	bool IsTreeLoading(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree) const;
+
+	/**
+	 * Call back once an acquired tree is resident, right away if it already is
+	 */
+	void CallWhenTreeLoaded(const TSoftObjectPtr<UWorkspotTree>& WorkspotTree, FSimpleDelegate Callback);
+
+	int32 GetNumResidentTrees() const { return Entries.Num(); }
+
+private:
+	/** Async request of a tree completed */
+	void HandleTreeLoaded(FSoftObjectPath Path);
+
+	FStreamableManager StreamableManager;
+
+	TMap<FSoftObjectPath, FWorkspotPreloadEntry> Entries;
+
+	/** Trees without users, waiting for their release time */
+	int32 NumUnusedEntries = 0;
+};
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorkspotTypes.h"
+#include "WorkspotProgram.generated.h"
+
+class UWorkspotEntry;
+
+/**
+ * Node type in a compiled workspot program
+ */
+UENUM()
+enum class EWorkspotProgramNodeType : uint8
+{
+	Clip,		// AnimClip, EntryAnim, ExitAnim, Pause
+	Sequence,
+	RandomList,
+	Selector
+};
+
+/**
+ * Flattened UWorkspotEntry, children are a range in FWorkspotProgram::Children
+ */
+USTRUCT()
+struct WORKSPOT_API FWorkspotProgramNode
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EWorkspotProgramNodeType Type = EWorkspotProgramNodeType::Clip;
+
+	/** Idle of the source entry, used by the selector idle guard */
+	UPROPERTY()
+	FName IdleAnim = "stand";
+
+	/** Clip: data to play. Sequence: idle loop data (INDEX_NONE if none) */
+	UPROPERTY()
+	int32 Clip = INDEX_NONE;
+
+	UPROPERTY()
+	int32 FirstChild = 0;
+
+	UPROPERTY()
+	int32 NumChildren = 0;
+
+	/** Sequence */
+	UPROPERTY()
+	bool bLoopInfinitely = false;
+
+	UPROPERTY()
+	int32 MaxLoops = 1;
+
+	/** RandomList */
+	UPROPERTY()
+	int32 MinClips = 1;
+
+	UPROPERTY()
+	int32 MaxClips = 1;
+};
+
+/**
+ * Flat, index based representation of a workspot entry tree
+ *
+ * Built by UWorkspotTree when it's loaded, saved or edited. Runtime instances only keep
+ * a small cursor over this data (see FWorkspotProgramIterator) instead of allocating
+ * an iterator per entry.
+ *
+ * Weighted children are picked with alias tables (Vose), constant time per pick.
+ */
+USTRUCT()
+struct WORKSPOT_API FWorkspotProgram
+{
+	GENERATED_BODY()
+
+	/** Data of leaf entries and sequence idle loops */
+	UPROPERTY()
+	TArray<FWorkspotEntryData> Clips;
+
+	/** Nodes[0] is the root */
+	UPROPERTY()
+	TArray<FWorkspotProgramNode> Nodes;
+
+	/** Child node indices, each container owns the range [FirstChild, FirstChild + NumChildren) */
+	UPROPERTY()
+	TArray<int32> Children;
+
+	/** Alias tables, parallel to Children */
+	UPROPERTY()
+	TArray<float> AliasProbabilities;
+
+	UPROPERTY()
+	TArray<int32> AliasIndices;
+
+	/** Check if there is anything to run */
+	bool IsValid() const { return Nodes.Num() > 0; }
+
+	/** Rebuild from an entry tree, null entries and empty containers are dropped */
+	void Compile(const UWorkspotEntry* RootEntry);
+
+	/** Weighted random child of a RandomList or Selector, returns a node index */
+	int32 ChooseChild(const FWorkspotProgramNode& Node, FRandomStream& Random) const;
+
+private:
+	int32 CompileEntry(const UWorkspotEntry* Entry);
+	void AddChildren(int32 NodeIndex, TConstArrayView<int32> ChildNodes, TConstArrayView<float> Weights);
+};
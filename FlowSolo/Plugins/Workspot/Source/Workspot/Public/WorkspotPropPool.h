@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorkspotPropPool.generated.h"
+
+class AActor;
+class USceneComponent;
+class UWorkspotTree;
+
+/**
+ * Prop pool counters, since the world started
+ */
+USTRUCT(BlueprintType)
+struct WORKSPOT_API FWorkspotPropPoolStats
+{
+	GENERATED_BODY()
+
+	/** Actors created by the pool (prewarm included) */
+	UPROPERTY(BlueprintReadOnly, Category = "Workspot")
+	int32 NumSpawned = 0;
+
+	/** Acquires served from the free list */
+	UPROPERTY(BlueprintReadOnly, Category = "Workspot")
+	int32 NumReused = 0;
+
+	/** Actors destroyed because the free list was over its cap */
+	UPROPERTY(BlueprintReadOnly, Category = "Workspot")
+	int32 NumDestroyed = 0;
+
+	/** Props currently attached to an actor */
+	UPROPERTY(BlueprintReadOnly, Category = "Workspot")
+	int32 NumInUse = 0;
+
+	/** Hidden props waiting to be reused */
+	UPROPERTY(BlueprintReadOnly, Category = "Workspot")
+	int32 NumFree = 0;
+};
+
+/**
+ * Free props of one class
+ */
+USTRUCT()
+struct FWorkspotPropPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> FreeProps;
+
+	/** Free props to keep ready, filled a few per frame */
+	int32 PrewarmCount = 0;
+
+	int32 NumInUse = 0;
+};
+
+/**
+ * WorkspotPropPool - Per world pool of workspot prop actors
+ *
+ * Props (cups, brooms, books...) are recycled instead of spawned and destroyed each time
+ * a workspot needs them. Released props are detached, hidden and have collision and tick
+ * disabled, acquiring one re-attaches it to the requested socket.
+ *
+ * Starting a workspot prewarms the prop classes of its tree, spawning a few props per frame.
+ *
+ * Usage:
+ *   UWorkspotPropPool* Pool = GetWorld()->GetSubsystem<UWorkspotPropPool>();
+ *   AActor* Prop = Pool->AcquireProp(PropClass, Owner, MeshComp, SocketName);
+ *   Pool->ReleaseProp(Prop);
+ */
+UCLASS()
+class WORKSPOT_API UWorkspotPropPool : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//////////////////////////////////////////////////////////////////////////
+	// Subsystem Interface
+	//////////////////////////////////////////////////////////////////////////
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Pool API
+	//////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * Get a prop from the pool (or spawn one) and attach it
+	 * @param PropClass - Exact class of the prop
+	 * @param Owner - Actor using the prop
+	 * @param AttachParent - Component to attach to
+	 * @param SocketName - Socket on AttachParent
+	 * @return The prop, nullptr if it couldn't be spawned
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Workspot")
+	AActor* AcquireProp(TSubclassOf<AActor> PropClass, AActor* Owner, USceneComponent* AttachParent, FName SocketName);
+
+	/**
+	 * Return a prop to the pool, props not acquired from the pool are destroyed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Workspot")
+	void ReleaseProp(AActor* Prop);
+
+	/**
+	 * Keep at least Count free props of a class, spawned over the next frames
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Workspot")
+	void Prewarm(TSubclassOf<AActor> PropClass, int32 Count);
+
+	/**
+	 * Prewarm every prop class used by a tree
+	 */
+	void PrewarmTree(const UWorkspotTree* WorkspotTree);
+
+	/**
+	 * Destroy all free props
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Workspot")
+	void Trim();
+
+	UFUNCTION(BlueprintPure, Category = "Workspot")
+	FWorkspotPropPoolStats GetStats() const { return Stats; }
+
+	const TMap<TObjectPtr<UClass>, FWorkspotPropPoolBucket>& GetBuckets() const { return Buckets; }
+
+private:
+	/**
+	 * Spawn a new prop at the origin
+	 * @param bDeactivated - Spawn it hidden and without collision, for props going straight to the free list
+	 */
+	AActor* SpawnProp(UClass* PropClass, bool bDeactivated = false);
+
+	/** Detach, hide and stop a released prop */
+	void DeactivateProp(AActor* Prop);
+
+	/** Attach and restore a prop to its class defaults */
+	void ActivateProp(AActor* Prop, AActor* Owner, USceneComponent* AttachParent, FName SocketName);
+
+	/** Free props that are still valid, pops destroyed ones */
+	AActor* PopFreeProp(FWorkspotPropPoolBucket& Bucket);
+
+private:
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FWorkspotPropPoolBucket> Buckets;
+
+	/** Props acquired from the pool and not released yet */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<AActor>> InUseProps;
+
+	/** Classes with a pending prewarm */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UClass>> PrewarmQueue;
+
+	FWorkspotPropPoolStats Stats;
+};
@@ -3,7 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "WorkspotTypes.h"
 #include "WorkspotSubsystem.generated.h"
 
 class UWorkspotTree;
@@ -17,7 +19,8 @@ class AActor;
  * - Manages all active workspot instances
  * - Creates and destroys WorkspotInstance objects
  * - Provides API for starting/stopping workspots
- * - Ticks all active instances
+ * - Advances instances whose current montage ended (event driven, idle instances are not ticked)
+ * - Assigns update buckets (full, reduced, frozen) from distance and visibility, a few instances per frame
  *
  * Usage:
  *   UWorkspotSubsystem* Subsystem = GetWorld()->GetSubsystem<UWorkspotSubsystem>();
@@ -93,6 +96,19 @@ private:
 	/** Handle instance completion callback */
 	void OnInstanceCompleted(UWorkspotInstance* Instance);
 
+	/** Re-evaluate the update bucket of the next instances in round robin */
+	void UpdateSignificance();
+
+	/** Pick the update bucket from distance to the closest view and visibility */
+	EWorkspotUpdateBucket ComputeUpdateBucket(const UWorkspotInstance* Instance, TConstArrayView<FVector> ViewLocations) const;
+
+	/** Queue an instance whose current entry finished */
+	void OnInstanceUpdateRequested(UWorkspotInstance* Instance);
+
+	/** Stop the workspot of an actor leaving the world */
+	UFUNCTION()
+	void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
 private:
 	/** Map of Actor -> WorkspotInstance for all active workspots */
 	UPROPERTY(Transient)
@@ -100,4 +116,16 @@ private:
 
 	/** Instances pending removal (to avoid iterator invalidation) */
 	TArray<TWeakObjectPtr<AActor>> PendingRemoval;
+
+	/** Instances that need to advance their iterator on the next tick */
+	TArray<TWeakObjectPtr<UWorkspotInstance>> PendingUpdates;
+
+	/** Instances without montage events, checked every tick */
+	TArray<TWeakObjectPtr<UWorkspotInstance>> PolledInstances;
+
+	/** Instances whose update bucket is evaluated, visited in round robin */
+	TArray<TWeakObjectPtr<UWorkspotInstance>> SignificanceInstances;
+
+	/** Next instance in SignificanceInstances to evaluate */
+	int32 SignificanceCursor = 0;
 };
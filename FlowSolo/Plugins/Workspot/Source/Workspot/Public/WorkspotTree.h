@@ -6,6 +6,7 @@
 #include "UObject/Object.h"
 #include "GameplayTagContainer.h"
 #include "WorkspotTypes.h"
+#include "WorkspotProgram.h"
 #include "WorkspotTree.generated.h"
 
 class UWorkspotEntry;
@@ -168,9 +169,34 @@ public:
 public:
 	UWorkspotTree();
 
+	//~ Begin UObject Interface
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
+	/**
+	 * Flat representation of RootEntry run by WorkspotInstance
+	 */
+	const FWorkspotProgram& GetProgram() const { return Program; }
+
+	/**
+	 * Incremented every time the program is rebuilt, running cursors stop using an outdated program
+	 */
+	int32 GetProgramRevision() const { return ProgramRevision; }
+
+	/**
+	 * Rebuild the program and transition table from RootEntry and transitions
+	 * Done on load, save and edit, call it after modifying entries at runtime
+	 */
+	void CompileProgram();
+
 	/**
 	 * Find transition animation between two idle states
 	 * Priority: Custom > Naming convention ("FromIdle__2__ToIdle")
+	 * Constant time lookup in the table built with the program
 	 */
 	UAnimMontage* FindTransitionAnim(FName FromIdle, FName ToIdle) const;
 
@@ -197,5 +223,24 @@ public:
 
 	/** Generate unique IDs for entries that don't have one */
 	void RegenerateEntryIds();
+
+	/** Search animation assets named "FromIdle__2__ToIdle" for idles used by this tree */
+	void ResolveConventionTransitions();
 #endif
+
+private:
+	/** Baked from RootEntry, saved with the asset so cooked builds don't rebuild it */
+	UPROPERTY()
+	FWorkspotProgram Program;
+
+	int32 ProgramRevision = 0;
+
+	/** Naming convention transitions found in the editor, saved so runtime doesn't search assets */
+	UPROPERTY()
+	TArray<FWorkspotTransitionAnim> ConventionTransitionAnims;
+
+	/** (FromIdle, ToIdle) -> montage, custom transitions override convention ones */
+	TMap<TPair<FName, FName>, UAnimMontage*> TransitionTable;
+
+	void BuildTransitionTable();
 };
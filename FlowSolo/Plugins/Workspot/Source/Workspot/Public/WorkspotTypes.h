@@ -91,6 +91,17 @@ enum class EWorkspotState : uint8
 	Finished
 };
 
+/**
+ * Update rate of a workspot instance, chosen by the subsystem from distance and visibility
+ */
+UENUM(BlueprintType)
+enum class EWorkspotUpdateBucket : uint8
+{
+	Full,		// Mesh ticks at its own rate
+	Reduced,	// Mesh ticks at workspot.Significance.ReducedTickInterval
+	Frozen		// Mesh doesn't tick, iterator is fast forwarded when visited and when promoted
+};
+
 /**
  * Entry flags (bitfield)
  */
@@ -41,7 +41,8 @@ public class Workspot : ModuleRules
 			new string[]
 			{
 				"AnimGraphRuntime",
-				"AIModule"
+				"AIModule",
+				"AssetRegistry"  // For naming convention transition lookup
 			}
 		);
 